@@ -214,6 +214,14 @@ namespace gpdbcost
 			virtual
 			CDouble DRowsPerHost(CDouble dRowsTotal) const;
 
+			// return number of rows per host for a skewed hash distribution
+			virtual
+			CDouble DRowsMaxHost(CDouble dRowsTotal, CDouble dMaxValueFreq) const;
+
+			// check if hash distributions are costed by their most loaded host
+			virtual
+			BOOL FCostsHashSkew() const;
+
 			// return cost model parameters
 			virtual
 			ICostModelParams *GetCostModelParams() const
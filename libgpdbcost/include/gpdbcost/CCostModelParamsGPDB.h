@@ -103,6 +103,7 @@ namespace gpopt
 				EcpBitmapNDVThreshold, // bitmap NDV threshold
 				EcpBitmapScanRebindCost, // cost of rebind operation in a bitmap scan
 				EcpPenalizeHJSkewUpperLimit, // upper limit for penalizing a skewed hashjoin operator
+				EcpHashSkewWeight, // weight of the most loaded host in rows per host of hash distributions
 
 				EcpSentinel
 			};
@@ -324,6 +325,10 @@ namespace gpopt
 			static
 			const CDouble DPenalizeHJSkewUpperLimit;
 
+			// weight of the most loaded host in rows per host of hash distributions
+			static
+			const CDouble DHashSkewWeight;
+
 			// private copy ctor
 			CCostModelParamsGPDB(CCostModelParamsGPDB &);
 
@@ -151,6 +151,62 @@ CCostModelGPDB::DRowsPerHost
 }
 
 
+//---------------------------------------------------------------------------
+//	@function:
+//		CCostModelGPDB::DRowsMaxHost
+//
+//	@doc:
+//		Return number of rows per host for a hash distribution whose most
+//		frequent value has the given frequency,
+//
+//		all rows of a value are sent to the same host, so the host receiving
+//		the most frequent value gets at least that value's rows plus its
+//		share of the remaining rows; redistribute and broadcast motions and
+//		hash join builds on such a distribution wait for that host,
+//
+//		the HashSkewWeight cost param interpolates between the average rows
+//		per host (0.0) and the rows of the most loaded host (1.0)
+//
+//---------------------------------------------------------------------------
+CDouble
+CCostModelGPDB::DRowsMaxHost
+	(
+	CDouble dRowsTotal,
+	CDouble dMaxValueFreq
+	)
+	const
+{
+	CDouble dRowsAvg = DRowsPerHost(dRowsTotal);
+
+	const CDouble dWeight = m_cost_model_params->PcpLookup(CCostModelParamsGPDB::EcpHashSkewWeight)->Get();
+	if (CDouble(0.0) >= dWeight || CDouble(0.0) >= dMaxValueFreq)
+	{
+		return dRowsAvg;
+	}
+
+	const DOUBLE dFreq = std::min(dMaxValueFreq.Get(), 1.0);
+	const DOUBLE dRowsMax = dRowsTotal.Get() * (dFreq + (1.0 - dFreq) / m_num_of_segments);
+
+	return CDouble(dRowsAvg.Get() + dWeight.Get() * std::max(0.0, dRowsMax - dRowsAvg.Get()));
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CCostModelGPDB::FCostsHashSkew
+//
+//	@doc:
+//		Check if hash distributions are costed by their most loaded host,
+//		i.e. if the HashSkewWeight cost param is set
+//
+//---------------------------------------------------------------------------
+BOOL
+CCostModelGPDB::FCostsHashSkew() const
+{
+	return CDouble(0.0) < m_cost_model_params->PcpLookup(CCostModelParamsGPDB::EcpHashSkewWeight)->Get();
+}
+
+
 //---------------------------------------------------------------------------
 //	@function:
 //		CCostModelGPDB::~CCostModelGPDB
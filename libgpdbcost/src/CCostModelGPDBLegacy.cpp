@@ -127,6 +127,42 @@ CCostModelGPDBLegacy::DRowsPerHost
 }
 
 
+//---------------------------------------------------------------------------
+//	@function:
+//		CCostModelGPDBLegacy::DRowsMaxHost
+//
+//	@doc:
+//		Return number of rows per host for a skewed hash distribution;
+//		the legacy model does not account for skew
+//
+//---------------------------------------------------------------------------
+CDouble
+CCostModelGPDBLegacy::DRowsMaxHost
+	(
+	CDouble dRowsTotal,
+	CDouble // dMaxValueFreq
+	)
+	const
+{
+	return DRowsPerHost(dRowsTotal);
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CCostModelGPDBLegacy::FCostsHashSkew
+//
+//	@doc:
+//		Check if hash distributions are costed by their most loaded host
+//
+//---------------------------------------------------------------------------
+BOOL
+CCostModelGPDBLegacy::FCostsHashSkew() const
+{
+	return false;
+}
+
+
 //---------------------------------------------------------------------------
 //	@function:
 //		CCostModelGPDBLegacy::~CCostModelGPDBLegacy
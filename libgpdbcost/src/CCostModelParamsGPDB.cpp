@@ -171,6 +171,10 @@ const CDouble CCostModelParamsGPDB::DBitmapScanRebindCost(0.06);
 // see CCostModelGPDB::CostHashJoin() for why this is needed
 const CDouble CCostModelParamsGPDB::DPenalizeHJSkewUpperLimit(10.0);
 
+// see CCostModelGPDB::DRowsMaxHost(); zero costs hash distributions by
+// their average rows per host, one by the rows of the most loaded host
+const CDouble CCostModelParamsGPDB::DHashSkewWeight(0.0);
+
 #define GPOPT_COSTPARAM_NAME_MAX_LENGTH		80
 
 // parameter names in the same order of param enumeration
@@ -226,6 +230,9 @@ const CHAR rgszCostParamNames[CCostModelParamsGPDB::EcpSentinel][GPOPT_COSTPARAM
 	"BitmapPageCostLargerNDV",
 	"BitmapPageCostSmallerNDV",
 	"BitmapNDVThreshold",
+	"BitmapScanRebindCost",
+	"PenalizeHJSkewUpperLimit",
+	"HashSkewWeight",
 	};
 
 //---------------------------------------------------------------------------
@@ -303,6 +310,7 @@ CCostModelParamsGPDB::CCostModelParamsGPDB
 	m_rgpcp[EcpBitmapNDVThreshold] = GPOS_NEW(mp) SCostParam(EcpBitmapNDVThreshold, DBitmapNDVThreshold, DBitmapNDVThreshold - 1.0, DBitmapNDVThreshold + 1.0);
 	m_rgpcp[EcpBitmapScanRebindCost] = GPOS_NEW(mp) SCostParam(EcpBitmapScanRebindCost, DBitmapScanRebindCost, DBitmapScanRebindCost - 1.0, DBitmapScanRebindCost + 1.0);
 	m_rgpcp[EcpPenalizeHJSkewUpperLimit] = GPOS_NEW(mp) SCostParam(EcpPenalizeHJSkewUpperLimit, DPenalizeHJSkewUpperLimit, DPenalizeHJSkewUpperLimit - 1.0, DPenalizeHJSkewUpperLimit + 1.0);
+	m_rgpcp[EcpHashSkewWeight] = GPOS_NEW(mp) SCostParam(EcpHashSkewWeight, DHashSkewWeight, 0.0, 1.0);
 }
 
 
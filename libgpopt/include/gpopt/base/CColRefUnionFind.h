@@ -0,0 +1,127 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (C) 2020 VMware, Inc. or its affiliates.
+//
+//	@filename:
+//		CColRefUnionFind.h
+//
+//	@doc:
+//		Union-find structure for building equivalence classes of columns
+//---------------------------------------------------------------------------
+#ifndef GPOPT_CColRefUnionFind_H
+#define GPOPT_CColRefUnionFind_H
+
+#include "gpos/base.h"
+#include "gpos/common/CHashMap.h"
+#include "gpos/common/CHashMapIter.h"
+#include "gpos/common/CRefCount.h"
+
+#include "gpopt/base/CColRefSet.h"
+
+namespace gpopt
+{
+	using namespace gpos;
+
+	//---------------------------------------------------------------------------
+	//	@class:
+	//		CColRefUnionFind
+	//
+	//	@doc:
+	//		Disjoint sets of columns keyed by column id. Equivalence classes are
+	//		added one at a time and merged with the classes they overlap, at
+	//		nearly constant cost per column instead of a scan over all classes
+	//		found so far.
+	//
+	//		Each class remembers when it was last extended. The resulting array
+	//		lists the classes in that order, which is the order the pairwise
+	//		merge in CUtils::PdrgpcrsAddEquivClass produces when the same
+	//		classes are added one by one.
+	//
+	//---------------------------------------------------------------------------
+	class CColRefUnionFind : public CRefCount
+	{
+		private:
+
+			// entry of a column
+			struct SNode
+			{
+				// column
+				CColRef *m_colref;
+
+				// id of the parent column, the column's own id for a root
+				ULONG m_ulParent;
+
+				// number of columns in the class, maintained for roots only
+				ULONG m_ulSize;
+
+				// sequence number of the last extension of the class,
+				// maintained for roots only
+				ULONG m_ulSeq;
+
+				// ctor
+				SNode(CColRef *colref)
+					:
+					m_colref(colref),
+					m_ulParent(colref->Id()),
+					m_ulSize(1),
+					m_ulSeq(0)
+				{}
+			};
+
+			// map of column id to entry
+			typedef CHashMap<ULONG, SNode, gpos::HashValue<ULONG>, gpos::Equals<ULONG>,
+						CleanupDelete<ULONG>, CleanupDelete<SNode> > UlongToNodeMap;
+
+			// iterator over entries
+			typedef CHashMapIter<ULONG, SNode, gpos::HashValue<ULONG>, gpos::Equals<ULONG>,
+						CleanupDelete<ULONG>, CleanupDelete<SNode> > UlongToNodeMapIter;
+
+			// memory pool
+			CMemoryPool *m_mp;
+
+			// entries of all columns added so far
+			UlongToNodeMap *m_phmulnode;
+
+			// sequence number of the last added class
+			ULONG m_ulSeq;
+
+			// private copy ctor
+			CColRefUnionFind(const CColRefUnionFind &);
+
+			// entry of the given column, added as a singleton if not present
+			SNode *PnodeInsert(CColRef *colref);
+
+			// root entry of the class of the given entry
+			SNode *PnodeRoot(SNode *pnode) const;
+
+			// merge the classes of the given roots, return the new root
+			SNode *PnodeUnion(SNode *pnodeFst, SNode *pnodeSnd);
+
+		public:
+
+			// ctor
+			explicit
+			CColRefUnionFind(CMemoryPool *mp);
+
+			// dtor
+			virtual
+			~CColRefUnionFind();
+
+			// add an equivalence class, merging it with the classes it overlaps
+			void AddEquivClass(const CColRefSet *pcrs);
+
+			// add an array of equivalence classes
+			void AddEquivClasses(const CColRefSetArray *pdrgpcrs);
+
+			// are all the given columns in the same class
+			BOOL FSameClass(const CColRefSet *pcrs) const;
+
+			// equivalence classes added so far
+			CColRefSetArray *PdrgpcrsEquivClasses(CMemoryPool *mp) const;
+
+	}; // class CColRefUnionFind
+}
+
+#endif // !GPOPT_CColRefUnionFind_H
+
+// EOF
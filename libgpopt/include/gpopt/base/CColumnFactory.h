@@ -22,6 +22,12 @@
 #include "naucrates/md/IMDId.h"
 #include "naucrates/md/IMDType.h"
 
+// number of column references per chunk of the id-indexed table
+#define GPOPT_COLFACTORY_CHUNK_SIZE	1024
+
+// number of chunks of the id-indexed table
+#define GPOPT_COLFACTORY_CHUNKS	4096
+
 namespace gpopt
 {
 	class CExpression;
@@ -35,10 +41,18 @@ namespace gpopt
 	//
 	//	@doc:
 	//		Singleton factory class used to generate and manage CColRefs in ORCA.
-	//		The created CColRef objects are maintained in a hash table keyed by
+	//		The created CColRef objects are maintained in a table indexed by
 	//		Column ID.  CColumnFactory provides various overloaded PcrCreate()
-	//		methods to create CColRef and a LookupColRef() method to probe the hash
+	//		methods to create CColRef and a LookupColRef() method to probe the
 	//		table.
+	//
+	//		Column ids are small dense integers, so the table is an array of
+	//		fixed-size chunks allocated on demand; chunks never move once
+	//		allocated, which makes lookups a pair of array accesses. Ids
+	//		beyond the capacity of the table are kept in an overflow hash
+	//		table.
+	//		The table is not synchronized: columns must be created, looked up
+	//		and destroyed by a single thread, the one optimizing the query.
 	//		NB: The class also owns the memory pool in which CColRefs are
 	//		allocated.
 	//
@@ -56,7 +70,10 @@ namespace gpopt
 			// id counter
 			ULONG m_aul;
 
-			// hash table
+			// chunks of column references indexed by id
+			CColRef **m_rgrgpcr[GPOPT_COLFACTORY_CHUNKS];
+
+			// overflow hash table for ids beyond the capacity of the chunks
 			CSyncHashtable
 				<CColRef,
 				ULONG> m_sht;
@@ -64,6 +81,22 @@ namespace gpopt
 			// private copy ctor
 			CColumnFactory(const CColumnFactory &);
 
+			// does the given id fall into the id-indexed table
+			static
+			BOOL FDenseId
+				(
+				ULONG id
+				)
+			{
+				return id < GPOPT_COLFACTORY_CHUNK_SIZE * GPOPT_COLFACTORY_CHUNKS;
+			}
+
+			// add a newly created column reference to the lookup structures
+			void Insert(CColRef *colref);
+
+			// lookup an id beyond the capacity of the id-indexed table
+			CColRef *PcrLookupOverflow(ULONG id);
+
 			// implementation of factory methods
 			CColRef *PcrCreate(const IMDType *pmdtype, INT type_modifier, ULONG id, const CName &name);
 			CColRef *PcrCreate
@@ -133,8 +166,25 @@ namespace gpopt
 			CColRef *PcrCopy(const CColRef* colref);
 
 			// lookup by id
-			CColRef *LookupColRef(ULONG id);
-			
+			CColRef *LookupColRef
+				(
+				ULONG id
+				)
+			{
+				if (!FDenseId(id))
+				{
+					return PcrLookupOverflow(id);
+				}
+
+				CColRef **rgpcr = m_rgrgpcr[id / GPOPT_COLFACTORY_CHUNK_SIZE];
+				if (NULL == rgpcr)
+				{
+					return NULL;
+				}
+
+				return rgpcr[id % GPOPT_COLFACTORY_CHUNK_SIZE];
+			}
+
 			// destructor
 			void Destroy(CColRef *);
 
@@ -101,6 +101,14 @@ namespace gpopt
 			// stats of owner group expression
 			IStatistics *m_pstats;
 
+			// row estimate used for costing, scaled to a single host for
+			// partitioned plans; negative until cost inputs are derived
+			DOUBLE m_dRowsCosting;
+
+			// width of the required columns used for costing; negative until
+			// cost inputs are derived
+			DOUBLE m_dWidthCosting;
+
 			// derive stats of owner group expression
 			void DeriveStats();
 
@@ -204,6 +212,31 @@ namespace gpopt
 				return m_pdpplan;
 			}
 
+			// were rows and width used for costing derived?
+			BOOL FCostInputsDerived() const
+			{
+				return 0.0 <= m_dRowsCosting;
+			}
+
+			// row estimate used for costing
+			DOUBLE DRowsCosting() const
+			{
+				GPOS_ASSERT(FCostInputsDerived());
+
+				return m_dRowsCosting;
+			}
+
+			// row width used for costing
+			DOUBLE DWidthCosting() const
+			{
+				GPOS_ASSERT(FCostInputsDerived());
+
+				return m_dWidthCosting;
+			}
+
+			// derive stats, rows and width used for costing
+			void DeriveCostInputs(CMemoryPool *mp);
+
 			// set cost value
 			void SetCost
 				(
@@ -217,6 +250,9 @@ namespace gpopt
 			// derive properties of the plan carried by cost context
 			void DerivePlanProps(CMemoryPool *mp);
 
+			// copy cost and stats from a cost-equivalent context
+			void CopyCost(const CCostContext *pccEquivalent);
+
 			// set cost context state
 			void SetState
 				(
@@ -250,6 +286,16 @@ namespace gpopt
 			// compute cost
 			CCost CostCompute(CMemoryPool *mp, CCostArray *pdrgpcostChildren);
 
+			// check if two contexts of the same group expression carrying the same
+			// child plans have equal stats and cost
+			static
+			BOOL FEqualForCosting(const CCostContext *pccFst, const CCostContext *pccSnd);
+
+			// check if two contexts of the same group expression carrying the same
+			// child plans pass equal inputs to the cost model
+			static
+			BOOL FEqualCostInputs(const CCostContext *pccFst, const CCostContext *pccSnd);
+
 			// is current context better than the given equivalent context based on cost?
 			BOOL FBetterThan(const CCostContext *pcc) const;
 
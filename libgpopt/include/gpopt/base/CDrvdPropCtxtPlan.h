@@ -77,6 +77,10 @@ namespace gpopt
 			// operator and the given cost context
 			void SetExpectedPartitionSelectors(COperator *pop, CCostContext *pcc);
 
+			// check if partition selectors are expected for the given operator
+			static
+			BOOL FExpectsPartitionSelectors(COperator *pop, ULONG *pulScanId);
+
 			// print
 			virtual
 			IOstream &OsPrint(IOstream &os) const;
@@ -42,33 +42,93 @@ namespace gpopt
 	//		the physical implementation. This includes sort order, distribution,
 	//		rewindability, partition propagation spec and CTE map.
 	//
+	//		Properties can be derived on demand: while the container is attached
+	//		to the expression handle it was created for, each property is derived
+	//		by its accessor the first time it is requested.
+	//
 	//---------------------------------------------------------------------------
 	class CDrvdPropPlan : public CDrvdProp
 	{
 
+		public:
+
+			// individually derivable plan properties
+			enum EDrvdPropType
+			{
+				EdptPos = 0,
+				EdptPds,
+				EdptPrs,
+				EdptPpim,
+				EdptPpfm,
+				EdptPcm,
+
+				EdptSentinel
+			};
+
 		private:
 
 			// derived sort order
-			COrderSpec *m_pos;
+			mutable COrderSpec *m_pos;
 
 			// derived distribution
-			CDistributionSpec *m_pds;
+			mutable CDistributionSpec *m_pds;
 
 			// derived rewindability
-			CRewindabilitySpec *m_prs;
+			mutable CRewindabilitySpec *m_prs;
 
 			// derived partition index map
-			CPartIndexMap *m_ppim;
+			mutable CPartIndexMap *m_ppim;
 			
 			// derived filter expressions indexed by the part index id
-			CPartFilterMap *m_ppfm;
+			mutable CPartFilterMap *m_ppfm;
 
 			// derived cte map
-			CCTEMap *m_pcm;
+			mutable CCTEMap *m_pcm;
+
+			// bit mask of derived properties, one bit per EDrvdPropType; the
+			// properties above are filled in by const accessors on demand
+			mutable ULONG m_ulDerived;
+
+			// memory pool, handle and context used for on-demand derivation;
+			// set only while the container is attached to a handle
+			CMemoryPool *m_mp;
+
+			CExpressionHandle *m_pexprhdl;
+
+			CDrvdPropCtxt *m_pdpctxt;
 
 			 // copy CTE producer plan properties from given context to current object
 			void CopyCTEProducerPlanProps(CMemoryPool *mp, CDrvdPropCtxt *pdpctxt, COperator *pop);
 
+			// derive a single property using the attached handle
+			void DeriveProp(EDrvdPropType edpt) const;
+
+			// detach from handle and record the amount of derivation work done
+			void Detach();
+
+			// check if a property has been derived
+			BOOL FDerived
+				(
+				EDrvdPropType edpt
+				)
+				const
+			{
+				return 0 != (m_ulDerived & (1 << edpt));
+			}
+
+			// derive a property if it was not derived yet
+			void EnsureDerived
+				(
+				EDrvdPropType edpt
+				)
+				const
+			{
+				if (!FDerived(edpt))
+				{
+					DeriveProp(edpt);
+				}
+			}
+
 			// private copy ctor
 			CDrvdPropPlan(const CDrvdPropPlan &);
 
@@ -91,6 +151,33 @@ namespace gpopt
 			// derivation function
 			void Derive(CMemoryPool *mp, CExpressionHandle &exprhdl, CDrvdPropCtxt *pdpctxt);
 
+			// attach to the given handle and derive properties when requested;
+			// the handle must outlive any property request
+			void DeriveOnDemand(CMemoryPool *mp, CExpressionHandle &exprhdl, CDrvdPropCtxt *pdpctxt);
+
+			// derive all remaining properties and detach from handle
+			void CompleteDerivation();
+
+			// stop on-demand derivation, leaving properties that were never
+			// requested underived
+			void AbandonDerivation();
+
+			// check if on-demand derivation goes through the given handle
+			BOOL FAttached
+				(
+				const CExpressionHandle *pexprhdl
+				)
+				const
+			{
+				return pexprhdl == m_pexprhdl;
+			}
+
+			// check if all properties have been derived
+			BOOL FComplete() const
+			{
+				return (ULONG) ((1 << EdptSentinel) - 1) == m_ulDerived;
+			}
+
 			// short hand for conversion
 			static
 			CDrvdPropPlan *Pdpplan(CDrvdProp *pdp);
@@ -98,36 +185,42 @@ namespace gpopt
 			// sort order accessor
 			COrderSpec *Pos() const
 			{
+				EnsureDerived(EdptPos);
 				return m_pos;
 			}
 
 			// distribution accessor
 			CDistributionSpec *Pds() const
 			{
+				EnsureDerived(EdptPds);
 				return m_pds;
 			}
 
 			// rewindability accessor
 			CRewindabilitySpec *Prs() const
 			{
+				EnsureDerived(EdptPrs);
 				return m_prs;
 			}
 			
 			// partition index map
 			CPartIndexMap *Ppim() const
 			{
+				EnsureDerived(EdptPpim);
 				return m_ppim;
 			}
 
 			// partition filter map
 			CPartFilterMap *Ppfm() const
 			{
+				EnsureDerived(EdptPpfm);
 				return m_ppfm;
 			}
 
 			// cte map
 			CCTEMap *GetCostModel() const
 			{
+				EnsureDerived(EdptPcm);
 				return m_pcm;
 			}
 
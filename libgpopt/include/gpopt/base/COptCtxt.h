@@ -28,6 +28,7 @@ namespace gpopt
 	// forward declarations
 	class CColRefSet;
 	class COptimizerConfig;
+	class CExpressionInterner;
 	class ICostModel;
 	class IConstExprEvaluator;
 
@@ -50,6 +51,29 @@ namespace gpopt
 	class COptCtxt : public CTaskLocalStorageObject
 	{
 
+		public:
+
+			// counters of optimizer work, reported when optimization
+			// statistics are printed
+			enum EOptCounter
+			{
+				EocPlanPropsDerived,	// plan properties derived
+				EocPlanPropsSkipped,	// plan properties never requested from their container
+				EocPlanPropsReused,		// plan property containers reused instead of derived
+				EocCostComputationsSaved,	// cost contexts costed by reusing an equivalent context
+				EocStatsCacheHits,		// derived stats served from the stats cache
+				EocStatsCacheMisses,	// cacheable stats derivations not found in the stats cache
+				EocHandleArraysInline,	// expression handle child arrays held inline
+				EocHandleArraysAllocated,	// expression handle child arrays allocated for large arity
+				EocCostContextsPruned,	// optimization requests pruned by cost lower bounds
+				EocDuplicateBindingsBlocked,	// xform bindings skipped as they regenerate existing group expressions
+				EocCostInputsReused,	// child rows and widths taken from the child cost context
+				EocCostResultsReused,	// cost model calls saved by reusing a context with equal cost inputs
+				EocCostTablesCreated,	// cost context hash tables created for group expressions
+
+				EocSentinel
+			};
+
 		private:
 
 			// private copy ctor
@@ -79,6 +103,9 @@ namespace gpopt
 			// global CTE information
 			CCTEInfo *m_pcteinfo;
 
+			// interning table for scalar expressions
+			CExpressionInterner *m_pexprinterner;
+
 			// system columns required in query output
 			CColRefArray *m_pdrgpcrSystemCols;
 
@@ -102,6 +129,9 @@ namespace gpopt
 			// does the query have replicated tables
 			BOOL m_has_replicated_tables;
 
+			// optimizer work counters
+			ULONG_PTR m_rgulpCounters[EocSentinel];
+
 		public:
 
 			// ctor
@@ -227,12 +257,45 @@ namespace gpopt
 				return m_pcteinfo;
 			}
 
+			// scalar expression interning table
+			CExpressionInterner *Pinterner() const
+			{
+				return m_pexprinterner;
+			}
+
 			// return a new part index id
 			ULONG UlPartIndexNextVal()
 			{
 				return m_auPartId++;
 			}
 			
+			// add to an optimizer work counter
+			void IncrementCounter
+				(
+				EOptCounter eoc,
+				ULONG_PTR ulpDelta = 1
+				)
+			{
+				GPOS_ASSERT(EocSentinel > eoc);
+
+				m_rgulpCounters[eoc] += ulpDelta;
+			}
+
+			// value of an optimizer work counter
+			ULONG_PTR UlpCounter
+				(
+				EOptCounter eoc
+				)
+				const
+			{
+				GPOS_ASSERT(EocSentinel > eoc);
+
+				return m_rgulpCounters[eoc];
+			}
+
+			// print optimizer work counters
+			IOstream &OsPrintCounters(IOstream &os) const;
+
 			// required system columns
 			CColRefArray *PdrgpcrSystemCols() const
 			{
@@ -458,6 +458,11 @@ namespace gpopt
 			static
 			CExpressionArray *PdrgpexprDedup(CMemoryPool *mp, CExpressionArray *pdrgpexpr);
 
+			// return the shared instance of a scalar expression from the
+			// optimizer context's interning table, consuming the given expression
+			static
+			CExpression *PexprInternScalar(CExpression *pexpr);
+
 			// deep equality of expression trees
 			static
 			BOOL Equals(const CExpression *pexprLeft, const CExpression *pexprRight);
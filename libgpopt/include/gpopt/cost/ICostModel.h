@@ -366,6 +366,16 @@ namespace gpopt
 			virtual
 			CDouble DRowsPerHost(CDouble dRowsTotal) const = 0;
 
+			// return number of rows per host to cost a hash distribution whose
+			// most frequent value has the given frequency
+			virtual
+			CDouble DRowsMaxHost(CDouble dRowsTotal, CDouble dMaxValueFreq) const = 0;
+
+			// check if DRowsMaxHost depends on the most frequent value, so
+			// callers can skip computing its frequency otherwise
+			virtual
+			BOOL FCostsHashSkew() const = 0;
+
 			// return cost model parameters
 			virtual
 			ICostModelParams *GetCostModelParams() const = 0;
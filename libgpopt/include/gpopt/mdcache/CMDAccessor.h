@@ -22,11 +22,13 @@
 #include "gpopt/mdcache/CMDKey.h"
 #include "gpopt/engine/CStatisticsConfig.h"
 
+#include "naucrates/md/CMDIndexApplicabilityMap.h"
 #include "naucrates/md/IMDId.h"
 #include "naucrates/md/IMDProvider.h"
 #include "naucrates/md/IMDType.h"
 #include "naucrates/md/IMDFunction.h"
 #include "naucrates/md/CSystemId.h"
+#include "naucrates/statistics/CBucket.h"
 #include "naucrates/statistics/IStatistics.h"
 
 // fwd declarations
@@ -68,6 +70,14 @@ namespace gpopt
 
 	
 	typedef IMDId * MdidPtr;
+
+	// map of relation mdid to index applicability map
+	typedef CHashMap<IMDId, CMDIndexApplicabilityMap, IMDId::MDIdHash, IMDId::MDIdCompare,
+				CleanupRelease<IMDId>, CleanupRelease<CMDIndexApplicabilityMap> > MdidToIndexApplicabilityMap;
+
+	// map of column stats mdid to translated histogram buckets
+	typedef CHashMap<IMDId, CBucketArray, IMDId::MDIdHash, IMDId::MDIdCompare,
+				CleanupRelease<IMDId>, CleanupRelease<CBucketArray> > MdidToBucketArrayMap;
 	
 	//---------------------------------------------------------------------------
 	//	@class:
@@ -94,6 +104,14 @@ namespace gpopt
 			// ccache template for mdcache
 			typedef CCache<IMDCacheObject*, CMDKey*> MDCache;
 
+			// ccache template for histogram buckets translated from column
+			// stats, keyed by the column stats mdid
+			typedef CCache<CBucketArray*, CMDKey*> HistogramCache;
+
+			// ccache template for index applicability maps, keyed by the
+			// relation mdid
+			typedef CCache<CMDIndexApplicabilityMap*, CMDKey*> IndexApplicabilityMapCache;
+
 		private:
 		// element in the hashtable of cache accessors maintained by the MD accessor
 		struct SMDAccessorElem;
@@ -102,6 +120,12 @@ namespace gpopt
 
 		// cache accessor for objects in a MD cache
 		typedef CCacheAccessor<IMDCacheObject*, CMDKey*> CacheAccessorMD;
+
+		// cache accessor for translated histogram buckets
+		typedef CCacheAccessor<CBucketArray*, CMDKey*> CacheAccessorHistogram;
+
+		// cache accessor for index applicability maps
+		typedef CCacheAccessor<CMDIndexApplicabilityMap*, CMDKey*> CacheAccessorIndexApplicabilityMap;
 		
 		// hashtable for cache accessors indexed by the md id of the accessed object 
 		typedef CSyncHashtable<SMDAccessorElem, MdidPtr> MDHT;
@@ -227,12 +251,40 @@ namespace gpopt
 			// this time is currently dominated by serialization time
 			CDouble m_dFetchTime;
 
+			// index applicability maps used by this accessor, by relation mdid;
+			// holding them pins their index applicability map cache entries
+			MdidToIndexApplicabilityMap *m_phmmdidimap;
+
+			// translated histogram buckets used by this accessor, by column
+			// stats mdid; holding them pins their histogram cache entries
+			MdidToBucketArrayMap *m_phmmdidbuckets;
+
+			// number of column histograms translated from MD column stats objects
+			ULONG m_ulHistogramsTranslated;
+
+			// number of column histograms built from buckets translated earlier
+			ULONG m_ulHistogramsReused;
+
+			// number of bucket translations saved by reusing translated buckets
+			ULONG m_ulBucketsReused;
+
 			// private copy ctor
 			CMDAccessor(const CMDAccessor&);
 			
 			// interface to a MD cache object
 			const IMDCacheObject *GetImdObj(IMDId *mdid);
 
+			// parse the DXL of an object retrieved from an MD provider and add
+			// the object to the MD cache
+			IMDCacheObject *PimdobjParseAndCache(CacheAccessorMD *pmdcacc, IMDId *mdid, const CWStringBase *pstrDXL);
+
+			// store an object in the local hashtable
+			void StoreInLocalHashtable(IMDCacheObject *pmdobj);
+
+			// make the given objects available, retrieving the missing ones from
+			// their MD provider in a single call
+			void PrefetchMDObjs(IMdIdArray *mdids);
+
 			// return the type corresponding to the given type info and source system id
 			const IMDType *RetrieveType(CSystemId sysid, IMDType::ETypeInfo type_info);
 
@@ -273,6 +325,33 @@ namespace gpopt
 			// construct a stats histogram from an MD column stats object  
 			CHistogram *GetHistogram(CMemoryPool *mp, IMDId *mdid_type, const IMDColStats *pmdcolstats);
 
+			// return the histogram buckets of an MD column stats object, translating
+			// them or retrieving them from the histogram cache on first use
+			CBucketArray *PdrgpbucketTranslated(IMDId *mdid_type, const IMDColStats *pmdcolstats);
+
+			// retrieve the translated histogram buckets of an MD column stats
+			// object from the given histogram cache, adding them if missing
+			CBucketArray *PdrgpbucketCached
+				(
+				HistogramCache *pcache,
+				IMDId *mdid_type,
+				const IMDColStats *pmdcolstats
+				);
+
+			// retrieve the index applicability map of a relation from the given
+			// cache, adding it if missing
+			CMDIndexApplicabilityMap *PimapCached
+				(
+				IndexApplicabilityMapCache *pcache,
+				const IMDRelation *pmdrel
+				);
+
+			// build the index applicability map of a relation
+			CMDIndexApplicabilityMap *PimapBuild(CMemoryPool *mp, const IMDRelation *pmdrel);
+
+			// translate the DXL buckets of an MD column stats object
+			CBucketArray *PdrgpbucketTranslate(CMemoryPool *mp, IMDId *mdid_type, const IMDColStats *pmdcolstats);
+
 			// construct a typed bucket from a DXL bucket  
 			CBucket *Pbucket(CMemoryPool *mp, IMDId *mdid_type, const CDXLBucket *dxl_bucket);
 			
@@ -345,6 +424,9 @@ namespace gpopt
 			// interface to a check constraint from the MD cache
 			const IMDCheckConstraint *RetrieveCheckConstraints(IMDId *mdid);
 
+			// map of the partition ranges of a relation to its indexes
+			const CMDIndexApplicabilityMap *RetrieveIndexApplicabilityMap(const IMDRelation *pmdrel);
+
 			// retrieve a column stats object from the cache
 			const IMDColStats *Pmdcolstats(IMDId *mdid);
 
@@ -33,6 +33,12 @@ namespace gpopt
 	//		A wrapper for a generic cache to hide the details of metadata cache
 	//		creation and encapsulate a singleton cache object
 	//
+	//		Histogram buckets translated from cached column stats objects are
+	//		kept in a second cache, keyed by the column stats mdid, and index
+	//		applicability maps of relations in a third one, keyed by the
+	//		relation mdid; both are created, sized and reset together with the
+	//		metadata cache
+	//
 	//---------------------------------------------------------------------------
 	class CMDCache
 	{
@@ -42,6 +48,12 @@ namespace gpopt
 			// pointer to the underlying cache
 			static CMDAccessor::MDCache *m_pcache;
 
+			// pointer to the cache of translated histogram buckets
+			static CMDAccessor::HistogramCache *m_pcacheHistograms;
+
+			// pointer to the cache of index applicability maps
+			static CMDAccessor::IndexApplicabilityMapCache *m_pcacheIndexApplicabilityMaps;
+
 			// the maximum size of the cache
 			static ULLONG m_ullCacheQuota;
 
@@ -96,6 +108,20 @@ namespace gpopt
 				return m_pcache;
 			}
 
+			// accessor of the cache of translated histogram buckets
+			static
+			CMDAccessor::HistogramCache *PcacheHistograms()
+			{
+				return m_pcacheHistograms;
+			}
+
+			// accessor of the cache of index applicability maps
+			static
+			CMDAccessor::IndexApplicabilityMapCache *PcacheIndexApplicabilityMaps()
+			{
+				return m_pcacheIndexApplicabilityMaps;
+			}
+
 	}; // class CMDCache
 
 }  // namespace gpopt
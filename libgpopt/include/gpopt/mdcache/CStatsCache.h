@@ -0,0 +1,171 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (C) 2020 VMware, Inc. or its affiliates.
+//
+//	@filename:
+//		CStatsCache.h
+//
+//	@doc:
+//		Cross-query cache of derived statistics
+//---------------------------------------------------------------------------
+#ifndef GPOPT_CStatsCache_H
+#define GPOPT_CStatsCache_H
+
+#include "gpos/base.h"
+#include "gpos/memory/CCache.h"
+#include "gpos/memory/CCacheAccessor.h"
+#include "gpos/string/CWStringDynamic.h"
+
+#include "gpopt/mdcache/CStatsCacheEntry.h"
+#include "gpopt/mdcache/CStatsCacheKey.h"
+#include "naucrates/statistics/CStatsPred.h"
+
+namespace gpopt
+{
+	using namespace gpos;
+	using namespace gpnaucrates;
+
+	class CExpression;
+	class CExpressionHandle;
+	class CLogicalGet;
+
+	//---------------------------------------------------------------------------
+	//	@class:
+	//		CStatsCache
+	//
+	//	@doc:
+	//		A wrapper for a generic cache holding statistics derived by earlier
+	//		queries, encapsulating a singleton cache object in the manner of
+	//		CMDCache. The cache is opt-in: it is only consulted once the host
+	//		has initialized it next to the metadata cache, and can be bypassed
+	//		per query with EopttraceDisableStatsCache. Hosts shut it down from
+	//		the same place as the metadata cache.
+	//
+	//		Entries are keyed by the relation mdid, including its version, the
+	//		columns of the input statistics and the normalized filter; column
+	//		ids are replaced by their positions in the relation. Only filters
+	//		without outer references directly on top of a base table get are
+	//		cached. Entries own all their data, so the cache does not depend
+	//		on the lifetime of the metadata cache.
+	//
+	//---------------------------------------------------------------------------
+	class CStatsCache
+	{
+		public:
+
+			// type definition of the statistics cache
+			typedef CCache<CStatsCacheEntry*, CStatsCacheKey*> StatsCache;
+
+			// type definition of a statistics cache accessor
+			typedef CCacheAccessor<CStatsCacheEntry*, CStatsCacheKey*> CacheAccessorStats;
+
+		private:
+
+			// pointer to the underlying cache
+			static StatsCache *m_pcache;
+
+			// the maximum size of the cache
+			static ULLONG m_ullCacheQuota;
+
+			// private ctor
+			CStatsCache()
+			{};
+
+			// no copy ctor
+			CStatsCache(const CStatsCache&);
+
+			// private dtor
+			~CStatsCache()
+			{};
+
+			// base table get below the filter in the given handle, if any
+			static
+			CLogicalGet *PopGetChild(CExpressionHandle &exprhdl);
+
+			// append the bits of a double to the key
+			static
+			void AppendDouble(CWStringDynamic *pstr, CDouble d);
+
+			// append the position of a column to the key
+			static
+			BOOL FAppendPos(CWStringDynamic *pstr, const UlongToUlongMap *phmulpos, ULONG colid);
+
+			// append the normalized predicate to the key
+			static
+			BOOL FAppendPred
+				(
+				CMemoryPool *mp,
+				CWStringDynamic *pstr,
+				const UlongToUlongMap *phmulpos,
+				CStatsPred *pred_stats
+				);
+
+			// normalized description of a filter derivation, NULL if the
+			// derivation cannot be normalized
+			static
+			CWStringDynamic *PstrKey
+				(
+				CMemoryPool *mp,
+				CLogicalGet *popGet,
+				const UlongToUlongMap *phmulpos,
+				CStatistics *child_stats,
+				CStatsPred *pred_stats,
+				BOOL do_cap_NDVs
+				);
+
+		public:
+
+			// initialize underlying cache
+			static
+			void Init();
+
+			// has cache been initialized?
+			static
+			BOOL FInitialized()
+			{
+				return (NULL != m_pcache);
+			}
+
+			// destroy global instance
+			static
+			void Shutdown();
+
+			// set the maximum size of the cache
+			static
+			void SetCacheQuota(ULLONG ullCacheQuota);
+
+			// get the maximum size of the cache
+			static
+			ULLONG ULLGetCacheQuota();
+
+			// reset global instance
+			static
+			void Reset();
+
+			// global accessor
+			static
+			StatsCache *Pcache()
+			{
+				return m_pcache;
+			}
+
+			// derive filter statistics, using the cache where possible; see
+			// CFilterStatsProcessor::MakeStatsFilterForScalarExpr
+			static
+			IStatistics *PstatsDeriveFilter
+				(
+				CMemoryPool *mp,
+				CExpressionHandle &exprhdl,
+				IStatistics *child_stats,
+				CExpression *local_scalar_expr,
+				CExpression *outer_refs_scalar_expr,
+				IStatisticsArray *all_outer_stats
+				);
+
+	}; // class CStatsCache
+
+}  // namespace gpopt
+
+#endif // !GPOPT_CStatsCache_H
+
+// EOF
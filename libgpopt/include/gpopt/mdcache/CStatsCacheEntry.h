@@ -0,0 +1,135 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (C) 2020 VMware, Inc. or its affiliates.
+//
+//	@filename:
+//		CStatsCacheEntry.h
+//
+//	@doc:
+//		Derived statistics held in the statistics cache
+//---------------------------------------------------------------------------
+#ifndef GPOPT_CStatsCacheEntry_H
+#define GPOPT_CStatsCacheEntry_H
+
+#include "gpos/base.h"
+#include "gpos/common/CBitSet.h"
+#include "gpos/common/CRefCount.h"
+#include "gpos/common/CDouble.h"
+
+#include "gpopt/base/CColRef.h"
+#include "naucrates/md/CDXLStatsDerivedColumn.h"
+#include "naucrates/statistics/CHistogram.h"
+#include "naucrates/statistics/CStatistics.h"
+
+namespace gpopt
+{
+	using namespace gpos;
+	using namespace gpmd;
+	using namespace gpdxl;
+	using namespace gpnaucrates;
+
+	class CMDAccessor;
+
+	//---------------------------------------------------------------------------
+	//	@class:
+	//		CStatsCacheEntry
+	//
+	//	@doc:
+	//		Statistics object frozen for the statistics cache. Columns are
+	//		identified by their position in the output of the relation the
+	//		statistics were derived for, so that the entry can be thawed into
+	//		the column ids of any later query over the same relation.
+	//
+	//		Histogram boundaries are kept as DXL datums allocated in the memory
+	//		pool of the cache entry, together with their type ids, so that the
+	//		entry does not refer to objects of the metadata cache.
+	//
+	//---------------------------------------------------------------------------
+	class CStatsCacheEntry : public CRefCount
+	{
+		private:
+
+			// memory pool of the cache entry
+			CMemoryPool *m_mp;
+
+			// number of rows
+			CDouble m_rows;
+
+			// is the relation empty
+			BOOL m_is_empty;
+
+			// number of predicates applied
+			ULONG m_num_predicates;
+
+			// histograms, the column ids of which are column positions
+			CDXLStatsDerivedColumnArray *m_pdrgpdxlhist;
+
+			// positions of columns with a well-defined histogram
+			CBitSet *m_pbsWellDefined;
+
+			// positions of columns with missing column stats
+			CBitSet *m_pbsColStatsMissing;
+
+			// positions of columns with a width
+			ULongPtrArray *m_pdrgpulWidthPos;
+
+			// column widths
+			CDoubleArray *m_pdrgpdWidth;
+
+			// column positions of each upper bound of NDVs
+			ULongPtr2dArray *m_pdrgpdrgpulUpperBoundPos;
+
+			// upper bounds of NDVs
+			CDoubleArray *m_pdrgpdUpperBoundNDVs;
+
+			// private copy ctor
+			CStatsCacheEntry(const CStatsCacheEntry &);
+
+			// ctor
+			CStatsCacheEntry(CMemoryPool *mp, const CStatistics *stats);
+
+			// look up the position of a column, return false if it is unknown
+			static
+			BOOL FPosition(const UlongToUlongMap *phmulpos, ULONG colid, ULONG *pulPos);
+
+			// freeze a histogram into a DXL derived column
+			CDXLStatsDerivedColumn *PdxlhistFreeze
+				(
+				CMDAccessor *md_accessor,
+				const CHistogram *histogram,
+				ULONG ulPos
+				);
+
+		public:
+
+			// dtor
+			virtual
+			~CStatsCacheEntry();
+
+			// freeze the given statistics into the given entry memory pool;
+			// returns NULL if one of the columns is not found in the position map
+			static
+			CStatsCacheEntry *PentryFreeze
+				(
+				CMemoryPool *pmpEntry,
+				CMemoryPool *mp,
+				CMDAccessor *md_accessor,
+				const CStatistics *stats,
+				const UlongToUlongMap *phmulpos
+				);
+
+			// thaw the entry into statistics over the given output columns
+			IStatistics *PstatsThaw
+				(
+				CMemoryPool *mp,
+				CMDAccessor *md_accessor,
+				const CColRefArray *pdrgpcrOutput
+				)
+				const;
+
+	}; // class CStatsCacheEntry
+}
+
+#endif // !GPOPT_CStatsCacheEntry_H
+
+// EOF
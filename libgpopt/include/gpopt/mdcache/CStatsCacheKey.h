@@ -0,0 +1,80 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (C) 2020 VMware, Inc. or its affiliates.
+//
+//	@filename:
+//		CStatsCacheKey.h
+//
+//	@doc:
+//		Key for derived statistics in the statistics cache
+//---------------------------------------------------------------------------
+#ifndef GPOPT_CStatsCacheKey_H
+#define GPOPT_CStatsCacheKey_H
+
+#include "gpos/base.h"
+#include "gpos/string/CWStringDynamic.h"
+
+namespace gpopt
+{
+	using namespace gpos;
+
+	//---------------------------------------------------------------------------
+	//	@class:
+	//		CStatsCacheKey
+	//
+	//	@doc:
+	//		Key for derived statistics in the cache; the key is a normalized
+	//		description of the statistics derivation that does not depend on
+	//		the column ids of a particular query, see CStatsCache
+	//
+	//---------------------------------------------------------------------------
+	class CStatsCacheKey
+	{
+		private:
+
+			// normalized derivation description
+			CWStringDynamic *m_pstr;
+
+			// hash value of the description
+			ULONG m_ulHash;
+
+			// private copy ctor
+			CStatsCacheKey(const CStatsCacheKey &);
+
+		public:
+
+			// ctor; copies the given description
+			CStatsCacheKey(CMemoryPool *mp, const CWStringBase *pstr);
+
+			// dtor
+			~CStatsCacheKey();
+
+			// normalized derivation description
+			const CWStringDynamic *Pstr() const
+			{
+				return m_pstr;
+			}
+
+			// equality function
+			BOOL Equals(const CStatsCacheKey &key) const;
+
+			// hash function
+			ULONG HashValue() const
+			{
+				return m_ulHash;
+			}
+
+			// equality function for using keys in a cache
+			static
+			BOOL FEqualKey(CStatsCacheKey* const &pkeyLeft, CStatsCacheKey* const &pkeyRight);
+
+			// hash function for using keys in a cache
+			static
+			ULONG UlHashKey(CStatsCacheKey* const &pkey);
+
+	}; // class CStatsCacheKey
+}
+
+#endif // !GPOPT_CStatsCacheKey_H
+
+// EOF
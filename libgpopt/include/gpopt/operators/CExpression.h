@@ -56,6 +56,7 @@ namespace gpopt
 	class CExpression : public CRefCount
 	{
 		friend class CExpressionHandle;
+		friend class CExpressionInterner;
 
 		private:
 		
@@ -95,6 +96,12 @@ namespace gpopt
 			// id of origin group expression, used for debugging expressions extracted from memo
 			ULONG m_ulOriginGrpExprId;
 
+			// is this expression a shared instance owned by the scalar interner
+			BOOL m_fInterned;
+
+			// hash value cached at interning time
+			ULONG m_ulHash;
+
 			// get expression's derived property given its type
 			CDrvdProp *Pdp(const CDrvdProp::EPropType ept) const;
 
@@ -288,6 +295,13 @@ namespace gpopt
 			// compare entire expression rooted here
 			BOOL Matches(CExpression *pexpr) const;
 
+			// is this a shared instance owned by the scalar interner; two
+			// interned expressions are equal iff they are the same instance
+			BOOL FInterned() const
+			{
+				return m_fInterned;
+			}
+
 #ifdef GPOS_DEBUG
 			// match against given pattern
 			BOOL FMatchPattern(CExpression *pexpr) const;
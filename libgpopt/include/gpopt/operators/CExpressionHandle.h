@@ -25,6 +25,8 @@
 #include "gpopt/operators/CExpression.h"
 #include "gpopt/search/CGroupExpression.h"
 
+// number of children whose properties and stats a handle keeps inline
+#define GPOPT_EXPRHDL_INLINE_CHILDREN	(4)
 
 namespace gpopt
 {
@@ -49,13 +51,135 @@ namespace gpopt
 	//		stand-alone expressions/DAGs;
 	//		a handle is attached to either an expression or a group expression
 	//
+	//		Handles live on the stack and are created in hot loops; the stats
+	//		and required properties of up to GPOPT_EXPRHDL_INLINE_CHILDREN
+	//		children are kept inline, so that attaching a handle to operators
+	//		of common arity does not allocate
+	//
 	//---------------------------------------------------------------------------
 	class CExpressionHandle 
 	{
 		friend class CExpression;
 
 		private:
-					
+
+			//---------------------------------------------------------------------------
+			//	@class:
+			//		CChildArray
+			//
+			//	@doc:
+			//		Fixed-size array of ref-counted child objects, held inline up to
+			//		GPOPT_EXPRHDL_INLINE_CHILDREN entries and allocated otherwise;
+			//		entries are owned by the array
+			//
+			//---------------------------------------------------------------------------
+			template <class T>
+			class CChildArray
+			{
+				private:
+
+					// inline entries
+					T *m_rgInline[GPOPT_EXPRHDL_INLINE_CHILDREN];
+
+					// entries in use, either inline or allocated
+					T **m_rg;
+
+					// number of entries
+					ULONG m_size;
+
+					// private copy ctor
+					CChildArray(const CChildArray &);
+
+				public:
+
+					// ctor
+					CChildArray()
+						:
+						m_rg(NULL),
+						m_size(0)
+					{}
+
+					// dtor
+					~CChildArray()
+					{
+						Clear();
+					}
+
+					// initialize the given number of empty entries
+					void Init
+						(
+						CMemoryPool *mp,
+						ULONG size
+						)
+					{
+						GPOS_ASSERT(!FInitialized());
+
+						BOOL fInline = (GPOPT_EXPRHDL_INLINE_CHILDREN >= size);
+						m_rg = fInline ? m_rgInline : GPOS_NEW_ARRAY(mp, T*, size);
+						m_size = size;
+						for (ULONG ul = 0; ul < size; ul++)
+						{
+							m_rg[ul] = NULL;
+						}
+					}
+
+					// release entries and storage
+					void Clear()
+					{
+						for (ULONG ul = 0; ul < m_size; ul++)
+						{
+							CRefCount::SafeRelease(m_rg[ul]);
+						}
+
+						if (FInitialized() && !FInline())
+						{
+							GPOS_DELETE_ARRAY(m_rg);
+						}
+						m_rg = NULL;
+						m_size = 0;
+					}
+
+					// has array been initialized
+					BOOL FInitialized() const
+					{
+						return NULL != m_rg;
+					}
+
+					// are entries held inline
+					BOOL FInline() const
+					{
+						return m_rgInline == m_rg;
+					}
+
+					// number of entries
+					ULONG Size() const
+					{
+						return m_size;
+					}
+
+					// entry accessor
+					T *operator [] (ULONG ul) const
+					{
+						GPOS_ASSERT(ul < m_size);
+
+						return m_rg[ul];
+					}
+
+					// replace entry, taking over the reference to the new one
+					void Replace
+						(
+						ULONG ul,
+						T *pt
+						)
+					{
+						GPOS_ASSERT(ul < m_size);
+
+						CRefCount::SafeRelease(m_rg[ul]);
+						m_rg[ul] = pt;
+					}
+
+			}; // class CChildArray
+
 			// memory pool
 			CMemoryPool *m_mp;
 			
@@ -70,7 +194,6 @@ namespace gpopt
 
 			// derived plan properties of the gexpr attached by a CostContext under
 			// the default CDrvdPropCtxtPlan. See DerivePlanPropsForCostContext()
-			// NB: does NOT support on-demand property derivation
 			CDrvdProp *m_pdpplan;
 
 			// statistics of attached expr/gexpr;
@@ -81,11 +204,12 @@ namespace gpopt
 			// set during required property computation
 			CReqdProp *m_prp;
 
-			// array of children's derived stats
-			IStatisticsArray *m_pdrgpstat;
+			// children's derived stats; dummy stats of scalar children are
+			// created on first access
+			mutable CChildArray<IStatistics> m_rgpstat;
 
-			// array of children's required properties
-			CReqdPropArray *m_pdrgprp;
+			// children's required properties
+			CChildArray<CReqdProp> m_rgprp;
 
 			// private copy ctor
 			CExpressionHandle(const CExpressionHandle &);
@@ -136,8 +260,13 @@ namespace gpopt
 			void DeriveStats(CMemoryPool *pmpLocal, CMemoryPool *pmpGlobal, CReqdPropRelational *prprel, IStatisticsArray *stats_ctxt);
 
 			// derive the properties of the plan carried by attached cost context,
-			// using default CDrvdPropCtxtPlan
-			void DerivePlanPropsForCostContext();
+			// using default CDrvdPropCtxtPlan; if requested, each property is
+			// derived only when it is first accessed through this handle
+			void DerivePlanPropsForCostContext(BOOL fOnDemand = false);
+
+			// derive remaining plan properties of attached cost context and
+			// cache them for other cost contexts with the same child plans
+			void CompletePlanPropsForCostContext();
 
 			// initialize required properties container
 			void InitReqdProps(CReqdProp *prpInput);
@@ -0,0 +1,114 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (C) 2020 VMware, Inc. or its affiliates.
+//
+//	@filename:
+//		CExpressionInterner.h
+//
+//	@doc:
+//		Hash-consing table for scalar expression trees
+//---------------------------------------------------------------------------
+#ifndef GPOPT_CExpressionInterner_H
+#define GPOPT_CExpressionInterner_H
+
+#include "gpos/base.h"
+#include "gpos/common/CHashMap.h"
+
+#include "gpopt/operators/CExpression.h"
+
+namespace gpopt
+{
+	using namespace gpos;
+
+	//---------------------------------------------------------------------------
+	//	@class:
+	//		CExpressionInterner
+	//
+	//	@doc:
+	//		Interning table for scalar expressions. Scalar trees handed to the
+	//		interner that are equal according to CUtils::Equals are mapped to
+	//		one shared instance whose children are interned as well, so that the
+	//		hash value of an interned tree is computed once and equality checks
+	//		between interned trees reduce to pointer comparisons.
+	//
+	//		Interned expressions must not be modified. The table is owned by the
+	//		optimizer context and only accepts expressions allocated from the
+	//		optimizer context's memory pool, so that shared instances never
+	//		outlive their pool.
+	//
+	//---------------------------------------------------------------------------
+	class CExpressionInterner
+	{
+		private:
+
+			// shallow hash function, children are already interned
+			static
+			ULONG HashValue(const CExpression *pexpr);
+
+			// shallow equality, children are compared by pointer
+			static
+			BOOL Equals(const CExpression *pexprFst, const CExpression *pexprSnd);
+
+			// map of interned expressions, each key maps to itself
+			typedef CHashMap<CExpression, CExpression, HashValue, Equals,
+					CleanupRelease<CExpression>, CleanupNULL<CExpression> > ExprToExprMap;
+
+			// memory pool
+			CMemoryPool *m_mp;
+
+			// interned expressions
+			ExprToExprMap *m_phmexpr;
+
+			// number of interning requests for new trees
+			ULONG m_ulLookups;
+
+			// number of requests satisfied by an existing instance
+			ULONG m_ulHits;
+
+			// private copy ctor
+			CExpressionInterner(const CExpressionInterner &);
+
+			// check if the root of the given expression can be interned
+			BOOL FInternable(const CExpression *pexpr) const;
+
+		public:
+
+			// ctor
+			explicit
+			CExpressionInterner(CMemoryPool *mp);
+
+			// dtor
+			~CExpressionInterner();
+
+			// return the shared instance of the given expression; the given
+			// expression is consumed, the returned one carries a new reference;
+			// expressions that cannot be interned are returned unchanged
+			CExpression *PexprIntern(CExpression *pexpr);
+
+			// number of distinct interned expressions
+			ULONG Size() const
+			{
+				return m_phmexpr->Size();
+			}
+
+			// number of interning requests
+			ULONG UlLookups() const
+			{
+				return m_ulLookups;
+			}
+
+			// number of interning requests that reused an existing instance
+			ULONG UlHits() const
+			{
+				return m_ulHits;
+			}
+
+			// print interning statistics
+			IOstream &OsPrint(IOstream &os) const;
+
+	}; // class CExpressionInterner
+}
+
+#endif // !GPOPT_CExpressionInterner_H
+
+// EOF
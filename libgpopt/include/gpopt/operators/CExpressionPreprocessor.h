@@ -14,6 +14,8 @@
 #define GPOPT_CExpressionPreprocessor_H
 
 #include "gpos/base.h"
+#include "gpos/common/CHashSet.h"
+#include "gpos/common/CWallClock.h"
 #include "gpopt/base/CUtils.h"
 #include "gpopt/base/CColumnFactory.h"
 
@@ -47,6 +49,31 @@ namespace gpopt
 			typedef CHashMapIter<ULONG, CExpressionArray, gpos::HashValue<ULONG>, gpos::Equals<ULONG>,
 						CleanupDelete<ULONG>, CleanupRelease<CExpressionArray> > CTEPredsMapIter;
 
+			// set of expression nodes, compared by address
+			typedef CHashSet<CExpression, gpos::HashPtr<CExpression>, gpos::EqualPtr<CExpression>,
+						CleanupNULL<CExpression> > ExprPtrSet;
+
+			// add the nodes of the given expression tree to the given set
+			static
+			void CollectNodes(CExpression *pexpr, ExprPtrSet *phs);
+
+			// count the nodes of the given expression tree that are not in the
+			// given set, without descending into nodes that are
+			static
+			ULONG UlRewrittenNodes(CExpression *pexpr, ExprPtrSet *phs);
+
+			// print the time spent in a preprocessing step and the number of
+			// nodes it rewrote, and restart the given clock
+			static
+			void PrintStepStats
+				(
+				CMemoryPool *mp,
+				CWallClock *pclock,
+				const CHAR *szStep,
+				CExpression *pexprInput,
+				CExpression *pexprOutput
+				);
+
 			// generate a conjunction of equality predicates between the columns in the given set
 			static
 			CExpression *PexprConjEqualityPredicates(CMemoryPool *mp, CColRefSet *pcrs);
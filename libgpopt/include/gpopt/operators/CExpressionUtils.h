@@ -65,6 +65,12 @@ namespace gpopt
 			CExpression *PexprPushNotOneLevel(CMemoryPool *mp, CExpression *pexpr);
 
 		public:
+			// combine the operator of the given expression with the given
+			// processed children; returns the expression itself, instead of
+			// a copy, if none of its children were replaced
+			static
+			CExpression *PexprRebuild(CMemoryPool *mp, CExpression *pexpr, CExpressionArray *pdrgpexprChildren);
+
 			// remove duplicate AND/OR children
 			static
 			CExpression *PexprDedupChildren(CMemoryPool *mp, CExpression *pexpr);
@@ -99,6 +99,21 @@ namespace gpopt
 			virtual
 			CPropConstraint *DerivePropertyConstraint(CMemoryPool *mp, CExpressionHandle &exprhdl) const;
 
+			//-------------------------------------------------------------------------------------
+			// Required Relational Properties
+			//-------------------------------------------------------------------------------------
+
+			// compute required stat columns of the n-th child
+			virtual
+			CColRefSet *PcrsStat
+				(
+				CMemoryPool *mp,
+				CExpressionHandle &exprhdl,
+				CColRefSet *pcrsInput,
+				ULONG child_index
+				)
+				const;
+
 			//-------------------------------------------------------------------------------------
 			// Transformations
 			//-------------------------------------------------------------------------------------
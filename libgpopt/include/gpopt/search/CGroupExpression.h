@@ -17,6 +17,7 @@
 #include "gpos/common/CRefCount.h"
 
 #include "gpopt/base/CCostContext.h"
+#include "gpopt/base/CDrvdPropPlan.h"
 #include "gpopt/engine/CPartialPlan.h"
 #include "gpopt/operators/COperator.h"
 #include "gpopt/search/CBinding.h"
@@ -104,6 +105,22 @@ namespace gpopt
 			typedef CHashMap<CPartialPlan, CCost, CPartialPlan::HashValue, CPartialPlan::Equals,
 						CleanupRelease<CPartialPlan>, CleanupDelete<CCost> > PartialPlanToCostMap;
 
+			// hash function of an array of child cost contexts
+			static
+			ULONG HashCostContexts(const CCostContextArray *pdrgpcc);
+
+			// equality function of arrays of child cost contexts
+			static
+			BOOL EqualCostContexts(const CCostContextArray *pdrgpccFst, const CCostContextArray *pdrgpccSnd);
+
+			// map of child best cost contexts to the plan properties derived for them
+			typedef CHashMap<CCostContextArray, CDrvdPropPlan, HashCostContexts, EqualCostContexts,
+						CleanupRelease<CCostContextArray>, CleanupRelease<CDrvdPropPlan> > CostContextsToDrvdPropPlanMap;
+
+			// map of child best cost contexts to the contexts costed for them
+			typedef CHashMap<CCostContextArray, CCostContextArray, HashCostContexts, EqualCostContexts,
+						CleanupRelease<CCostContextArray>, CleanupRelease<CCostContextArray> > CostContextsToCostContextsMap;
+
 
 			// expression id
 			ULONG m_id;
@@ -140,14 +157,27 @@ namespace gpopt
 			// optimization level
 			EOptimizationLevel m_eol;
 
-			// map of partial plans to their cost lower bound
+			// map of partial plans to their cost lower bound; created when a
+			// lower bound is first computed
 			PartialPlanToCostMap *m_ppartialplancostmap;
 
+			// map of child best cost contexts to derived plan properties;
+			// created when plan properties are first cached
+			CostContextsToDrvdPropPlanMap *m_pdpplancostctxtmap;
+
+			// map of child best cost contexts to costed contexts carrying them;
+			// created when a context is first costed
+			CostContextsToCostContextsMap *m_pcostedctxtmap;
+
 			// circular dependency state
 			ECircularDependency m_ecirculardependency;
 
-			// hashtable of cost contexts
-			ShtCC m_sht;
+			// hashtable of cost contexts; created when the first context is
+			// inserted, as only physical group expressions get contexts
+			ShtCC *m_psht;
+
+			// create cost contexts hash table
+			void InitCostContexts();
 
 			// set group back pointer
 			void SetGroup(CGroup *pgroup);
@@ -190,6 +220,25 @@ namespace gpopt
 			// check validity of group expression
 			BOOL FValidContext(CMemoryPool *mp, COptimizationContext *poc, COptimizationContextArray *pdrgpocChild);
 			
+			// best cost contexts of the children of the given cost context, if
+			// plan properties derived for it can be shared with other contexts
+			CCostContextArray *PdrgpccChildBest(CCostContext *pcc) const;
+
+			// costed contexts with the same child plans as the given one
+			CCostContextArray *PdrgpccCostedLookup(CCostContext *pcc);
+
+			// lookup a costed context with the same child plans, stats and cost
+			// as the given one
+			CCostContext *PccLookupCostEquivalent(CCostContext *pcc);
+
+			// lookup a costed context with the same child plans and cost inputs
+			// as the given one, whose cost inputs are derived
+			CCostContext *PccLookupCostInputs(CCostContext *pcc);
+
+			// remember a costed context so that cost-equivalent contexts can
+			// reuse its cost
+			void InsertCostedContext(CCostContext *pcc);
+
 			// remove cost context in hash table
 			CCostContext *PccRemove(COptimizationContext *poc, ULONG ulOptReq);
 
@@ -216,7 +265,10 @@ namespace gpopt
 				m_fIntermediate(false),
 				m_estate(estUnexplored),
 				m_eol(EolLow),
-				m_ppartialplancostmap(NULL)
+				m_ppartialplancostmap(NULL),
+				m_pdpplancostctxtmap(NULL),
+				m_pcostedctxtmap(NULL),
+				m_psht(NULL)
 			{};
 
 						
@@ -343,10 +395,24 @@ namespace gpopt
 				return m_pgexprOrigin;
 			}
 
+			// was group expression created below the root of an xform result
+			BOOL FIntermediate() const
+			{
+				return m_fIntermediate;
+			}
+
 			// cost contexts hash table accessor
 			ShtCC &Sht()
 			{
-				return m_sht;
+				GPOS_ASSERT(NULL != m_psht);
+
+				return *m_psht;
+			}
+
+			// check if any cost context was inserted
+			BOOL FHasCostContexts() const
+			{
+				return NULL != m_psht;
 			}
 
 			// comparison operator for hashtables
@@ -436,6 +502,13 @@ namespace gpopt
 			// insert a cost context in hash table
 			CCostContext *PccInsert(CCostContext *pcc);
 
+			// lookup plan properties derived for a cost context with the same
+			// child plans as the given one
+			CDrvdPropPlan *PdpplanLookup(CCostContext *pcc);
+
+			// cache plan properties derived for the given cost context
+			void CachePdpplan(CCostContext *pcc, CDrvdPropPlan *pdpplan);
+
 			// derive statistics recursively on a given group expression
 			IStatistics *PstatsRecursiveDerive
 				(
@@ -125,6 +125,9 @@ namespace gpopt
 			// derive plan properties and stats of the child previous to the one being optimized
 			void DerivePrevChildProps(CSchedulerContext *psc);
 
+			// check if job can be early terminated once all children have been optimized
+			BOOL FPruneOptimizedChildren(CSchedulerContext *psc);
+
 			// compute required plan properties for current child
 			void ComputeCurrentChildRequirements(CSchedulerContext *psc);
 
@@ -0,0 +1,672 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (C) 2020 VMware, Inc. or its affiliates.
+//
+//	@filename:
+//		CStaticBinding.h
+//
+//	@doc:
+//		Compile-time xform patterns and the binding of memo expressions
+//		to them
+//---------------------------------------------------------------------------
+#ifndef GPOPT_CStaticBinding_H
+#define GPOPT_CStaticBinding_H
+
+#include "gpos/base.h"
+
+#include "gpopt/operators/CExpression.h"
+#include "gpopt/operators/CPatternLeaf.h"
+#include "gpopt/operators/CPatternMultiLeaf.h"
+#include "gpopt/operators/CPatternMultiTree.h"
+#include "gpopt/operators/CPatternTree.h"
+#include "gpopt/search/CGroup.h"
+#include "gpopt/search/CGroupExpression.h"
+
+namespace gpopt
+{
+	using namespace gpos;
+
+	//---------------------------------------------------------------------------
+	//	@class:
+	//		CStaticBinding
+	//
+	//	@doc:
+	//		Binding of memo expressions to patterns given as types.
+	//
+	//		A static pattern is a type built from CStaticPatternOp and the
+	//		pattern placeholders below. Matching and extraction are resolved
+	//		at compile time, so that operator checks, child pattern selection
+	//		and the recursion over child groups compile into direct calls
+	//		instead of walking a CExpression pattern tree through virtual
+	//		calls. The bindings produced, and their order, are the same as the
+	//		ones CBinding produces for the equivalent pattern tree.
+	//
+	//		A non-leaf pattern type T provides
+	//			FMatch(pgexpr): shallow match of operator and arity,
+	//			UlArity(): number of pattern children,
+	//			PexprExtractChild(mp, ulPos, arity, pgroup, pexprLast):
+	//				extraction from the group of the given child,
+	//		and is bound through the templates below.
+	//
+	//---------------------------------------------------------------------------
+	class CStaticBinding
+	{
+		private:
+
+			// private ctor
+			CStaticBinding();
+
+			// private copy ctor
+			CStaticBinding(const CStaticBinding &);
+
+			// initialize cursors of child expressions
+			template <class TPattern>
+			static
+			BOOL FInitChildCursors
+				(
+				CMemoryPool *mp,
+				CGroupExpression *pgexpr,
+				CExpressionArray *pdrgpexpr
+				)
+			{
+				const ULONG arity = pgexpr->Arity();
+
+				// grab first expression from each cursor
+				for (ULONG ul = 0; ul < arity; ul++)
+				{
+					CExpression *pexprNewChild =
+						TPattern::PexprExtractChild(mp, ul, arity, (*pgexpr)[ul], NULL /*pexprLastChild*/);
+
+					if (NULL == pexprNewChild)
+					{
+						// failure means we have no more expressions
+						return false;
+					}
+
+					pdrgpexpr->Append(pexprNewChild);
+				}
+
+				return true;
+			}
+
+			// advance cursors of child expressions and populate the given array
+			// with the next child expressions
+			template <class TPattern>
+			static
+			BOOL FAdvanceChildCursors
+				(
+				CMemoryPool *mp,
+				CGroupExpression *pgexpr,
+				CExpression *pexprLast,
+				CExpressionArray *pdrgpexpr
+				)
+			{
+				if (NULL == pexprLast)
+				{
+					// first call, initialize cursors
+					return FInitChildCursors<TPattern>(mp, pgexpr, pdrgpexpr);
+				}
+
+				const ULONG arity = pgexpr->Arity();
+
+				// could we advance a child's cursor?
+				BOOL fCursorAdvanced = false;
+
+				// number of exhausted cursors
+				ULONG ulExhaustedCursors = 0;
+
+				for (ULONG ul = 0; ul < arity; ul++)
+				{
+					CGroup *pgroup = (*pgexpr)[ul];
+					CExpression *pexprNewChild = NULL;
+
+					if (fCursorAdvanced)
+					{
+						// re-use last extracted child expression
+						(*pexprLast)[ul]->AddRef();
+						pexprNewChild = (*pexprLast)[ul];
+					}
+					else
+					{
+						CExpression *pexprLastChild = (*pexprLast)[ul];
+						GPOS_ASSERT(pgroup == pexprLastChild->Pgexpr()->Pgroup());
+
+						// advance current cursor
+						pexprNewChild = TPattern::PexprExtractChild(mp, ul, arity, pgroup, pexprLastChild);
+
+						if (NULL == pexprNewChild)
+						{
+							// cursor is exhausted, we need to reset it
+							pexprNewChild = TPattern::PexprExtractChild(mp, ul, arity, pgroup, NULL /*pexprLastChild*/);
+							ulExhaustedCursors++;
+						}
+						else
+						{
+							// advancing current cursor has succeeded
+							fCursorAdvanced = true;
+						}
+					}
+					GPOS_ASSERT(NULL != pexprNewChild);
+
+					pdrgpexpr->Append(pexprNewChild);
+				}
+
+				GPOS_ASSERT(ulExhaustedCursors <= arity);
+
+				return ulExhaustedCursors < arity;
+			}
+
+		public:
+
+			// move cursor within a group (initialize if NULL)
+			static
+			CGroupExpression *PgexprNext(CGroup *pgroup, CGroupExpression *pgexpr);
+
+			// assemble the binding of the given group expression
+			static
+			CExpression *PexprFinalize(CMemoryPool *mp, CGroupExpression *pgexpr, CExpressionArray *pdrgpexpr);
+
+			// binding of a leaf pattern to the given group expression
+			static
+			CExpression *PexprLeaf(CMemoryPool *mp, CGroupExpression *pgexpr);
+
+			// binding of a leaf pattern to a group
+			static
+			CExpression *PexprLeafGroup(CMemoryPool *mp, CGroup *pgroup, CExpression *pexprLast);
+
+			// extract a binding of a non-leaf pattern from a group expression
+			// that matches the pattern's root; keep root node fixed
+			template <class TPattern>
+			static
+			CExpression *PexprExtract
+				(
+				CMemoryPool *mp,
+				CGroupExpression *pgexpr,
+				CExpression *pexprLast
+				)
+			{
+				GPOS_CHECK_ABORT;
+				GPOS_ASSERT(TPattern::FMatch(pgexpr));
+
+				// the previously extracted pattern must have the same root
+				GPOS_ASSERT_IMP(NULL != pexprLast, pexprLast->Pgexpr() == pgexpr);
+
+				// scalar groups have a single group expression whose children
+				// need not be bound again, see CBinding::PexprExtract
+				if (NULL != pexprLast && pgexpr->Pgroup()->FScalar())
+				{
+					GPOS_ASSERT(1 == pgexpr->Pgroup()->UlGExprs());
+					GPOS_ASSERT(pexprLast->Pop()->Eopid() == pgexpr->Pop()->Eopid());
+					return NULL;
+				}
+
+				const ULONG arity = pgexpr->Arity();
+				if (0 == arity && NULL != pexprLast)
+				{
+					// no more bindings
+					return NULL;
+				}
+
+				// attempt binding to children
+				CExpressionArray *pdrgpexpr = GPOS_NEW(mp) CExpressionArray(mp);
+				if (arity < TPattern::UlArity() ||
+					(0 < arity && !FAdvanceChildCursors<TPattern>(mp, pgexpr, pexprLast, pdrgpexpr)))
+				{
+					pdrgpexpr->Release();
+					return NULL;
+				}
+
+				return PexprFinalize(mp, pgexpr, pdrgpexpr);
+			}
+
+			// extract a binding of a non-leaf pattern from a group; if no
+			// binding can be found below the current root, advance the root
+			// until the group is exhausted
+			template <class TPattern>
+			static
+			CExpression *PexprExtractGroup
+				(
+				CMemoryPool *mp,
+				CGroup *pgroup,
+				CExpression *pexprLast
+				)
+			{
+				GPOS_CHECK_STACK_SIZE;
+				GPOS_CHECK_ABORT;
+				GPOS_ASSERT(NULL != pgroup);
+
+				CGroupExpression *pgexpr = NULL;
+				if (NULL != pexprLast)
+				{
+					pgexpr = pexprLast->Pgexpr();
+				}
+				else
+				{
+					// init cursor
+					pgexpr = PgexprNext(pgroup, NULL);
+				}
+				GPOS_ASSERT(NULL != pgexpr);
+
+				// start position for next binding
+				CExpression *pexprStart = pexprLast;
+				do
+				{
+					if (TPattern::FMatch(pgexpr))
+					{
+						CExpression *pexprResult = PexprExtract<TPattern>(mp, pgexpr, pexprStart);
+						if (NULL != pexprResult)
+						{
+							return pexprResult;
+						}
+					}
+
+					// move cursor and reset start position
+					pgexpr = PgexprNext(pgroup, pgexpr);
+					pexprStart = NULL;
+
+					GPOS_CHECK_ABORT;
+				}
+				while (NULL != pgexpr);
+
+				// group exhausted
+				return NULL;
+			}
+
+	}; // class CStaticBinding
+
+	//---------------------------------------------------------------------------
+	//	@class:
+	//		CStaticPatternNone
+	//
+	//	@doc:
+	//		Placeholder for an absent child of a static pattern
+	//
+	//---------------------------------------------------------------------------
+	class CStaticPatternNone
+	{
+		public:
+
+			static
+			BOOL FNone()
+			{
+				return true;
+			}
+
+			static
+			BOOL FMulti()
+			{
+				return false;
+			}
+
+			static
+			CExpression *PexprPattern(CMemoryPool *)
+			{
+				GPOS_ASSERT(!"Absent pattern child");
+				return NULL;
+			}
+
+			static
+			CExpression *PexprExtractGroup(CMemoryPool *, CGroup *, CExpression *)
+			{
+				GPOS_ASSERT(!"Absent pattern child");
+				return NULL;
+			}
+
+	}; // class CStaticPatternNone
+
+	//---------------------------------------------------------------------------
+	//	@class:
+	//		CStaticPatternLeaf
+	//
+	//	@doc:
+	//		Static counterpart of CPatternLeaf: binds the first expression of
+	//		a group without its children
+	//
+	//---------------------------------------------------------------------------
+	class CStaticPatternLeaf
+	{
+		public:
+
+			static
+			BOOL FNone()
+			{
+				return false;
+			}
+
+			static
+			BOOL FMulti()
+			{
+				return false;
+			}
+
+			static
+			CExpression *PexprPattern(CMemoryPool *mp)
+			{
+				return GPOS_NEW(mp) CExpression(mp, GPOS_NEW(mp) CPatternLeaf(mp));
+			}
+
+			static
+			CExpression *PexprExtract(CMemoryPool *mp, CGroupExpression *pgexpr, CExpression *)
+			{
+				return CStaticBinding::PexprLeaf(mp, pgexpr);
+			}
+
+			static
+			CExpression *PexprExtractGroup(CMemoryPool *mp, CGroup *pgroup, CExpression *pexprLast)
+			{
+				return CStaticBinding::PexprLeafGroup(mp, pgroup, pexprLast);
+			}
+
+	}; // class CStaticPatternLeaf
+
+	//---------------------------------------------------------------------------
+	//	@class:
+	//		CStaticPatternMultiLeaf
+	//
+	//	@doc:
+	//		Static counterpart of CPatternMultiLeaf
+	//
+	//---------------------------------------------------------------------------
+	class CStaticPatternMultiLeaf : public CStaticPatternLeaf
+	{
+		public:
+
+			static
+			BOOL FMulti()
+			{
+				return true;
+			}
+
+			static
+			CExpression *PexprPattern(CMemoryPool *mp)
+			{
+				return GPOS_NEW(mp) CExpression(mp, GPOS_NEW(mp) CPatternMultiLeaf(mp));
+			}
+
+	}; // class CStaticPatternMultiLeaf
+
+	//---------------------------------------------------------------------------
+	//	@class:
+	//		CStaticPatternTree
+	//
+	//	@doc:
+	//		Static counterpart of CPatternTree: binds all expressions of the
+	//		subtree below a group
+	//
+	//---------------------------------------------------------------------------
+	class CStaticPatternTree
+	{
+		public:
+
+			static
+			BOOL FNone()
+			{
+				return false;
+			}
+
+			static
+			BOOL FMulti()
+			{
+				return false;
+			}
+
+			static
+			BOOL FMatch(CGroupExpression *)
+			{
+				// a pattern operator matches any group expression
+				return true;
+			}
+
+			static
+			ULONG UlArity()
+			{
+				return 0;
+			}
+
+			static
+			CExpression *PexprPattern(CMemoryPool *mp)
+			{
+				return GPOS_NEW(mp) CExpression(mp, GPOS_NEW(mp) CPatternTree(mp));
+			}
+
+			static
+			CExpression *PexprExtractChild(CMemoryPool *mp, ULONG, ULONG, CGroup *pgroup, CExpression *pexprLast)
+			{
+				// the tree pattern is re-used for all children
+				return CStaticBinding::PexprExtractGroup<CStaticPatternTree>(mp, pgroup, pexprLast);
+			}
+
+			static
+			CExpression *PexprExtract(CMemoryPool *mp, CGroupExpression *pgexpr, CExpression *pexprLast)
+			{
+				return CStaticBinding::PexprExtract<CStaticPatternTree>(mp, pgexpr, pexprLast);
+			}
+
+			static
+			CExpression *PexprExtractGroup(CMemoryPool *mp, CGroup *pgroup, CExpression *pexprLast)
+			{
+				return CStaticBinding::PexprExtractGroup<CStaticPatternTree>(mp, pgroup, pexprLast);
+			}
+
+	}; // class CStaticPatternTree
+
+	//---------------------------------------------------------------------------
+	//	@class:
+	//		CStaticPatternMultiTree
+	//
+	//	@doc:
+	//		Static counterpart of CPatternMultiTree; binds like a tree pattern
+	//
+	//---------------------------------------------------------------------------
+	class CStaticPatternMultiTree : public CStaticPatternTree
+	{
+		public:
+
+			static
+			BOOL FMulti()
+			{
+				return true;
+			}
+
+			static
+			CExpression *PexprPattern(CMemoryPool *mp)
+			{
+				return GPOS_NEW(mp) CExpression(mp, GPOS_NEW(mp) CPatternMultiTree(mp));
+			}
+
+	}; // class CStaticPatternMultiTree
+
+	//---------------------------------------------------------------------------
+	//	@class:
+	//		CStaticPatternOp
+	//
+	//	@doc:
+	//		Static pattern matching an operator with the given id and up to
+	//		four children patterns, e.g.
+	//
+	//		CStaticPatternOp
+	//			<
+	//			CLogicalInnerJoin, COperator::EopLogicalInnerJoin,
+	//			CStaticPatternLeaf, CStaticPatternLeaf, CStaticPatternTree
+	//			>
+	//
+	//		The operator class is only used to build the equivalent pattern
+	//		tree; matching only compares operator ids. As for pattern trees, a
+	//		multi-leaf or multi-tree first child matches all but the last
+	//		child of an operator with any number of children.
+	//
+	//---------------------------------------------------------------------------
+	template
+		<
+		class TOperator,
+		COperator::EOperatorId eopid,
+		class TChild0 = CStaticPatternNone,
+		class TChild1 = CStaticPatternNone,
+		class TChild2 = CStaticPatternNone,
+		class TChild3 = CStaticPatternNone
+		>
+	class CStaticPatternOp
+	{
+		private:
+
+			// extraction from the group of a child using the given child pattern
+			static
+			CExpression *PexprExtractChildAt
+				(
+				CMemoryPool *mp,
+				ULONG ulChild,
+				CGroup *pgroup,
+				CExpression *pexprLast
+				)
+			{
+				switch (ulChild)
+				{
+					case 0:
+						return TChild0::PexprExtractGroup(mp, pgroup, pexprLast);
+					case 1:
+						return TChild1::PexprExtractGroup(mp, pgroup, pexprLast);
+					case 2:
+						return TChild2::PexprExtractGroup(mp, pgroup, pexprLast);
+					default:
+						GPOS_ASSERT(3 == ulChild);
+						return TChild3::PexprExtractGroup(mp, pgroup, pexprLast);
+				}
+			}
+
+		public:
+
+			static
+			BOOL FNone()
+			{
+				return false;
+			}
+
+			static
+			BOOL FMulti()
+			{
+				return false;
+			}
+
+			// number of pattern children
+			static
+			ULONG UlArity()
+			{
+				return (TChild0::FNone() ? 0 : 1) + (TChild1::FNone() ? 0 : 1) +
+					(TChild2::FNone() ? 0 : 1) + (TChild3::FNone() ? 0 : 1);
+			}
+
+			// shallow match of operator id and arity
+			static
+			BOOL FMatch
+				(
+				CGroupExpression *pgexpr
+				)
+			{
+				const ULONG ulArityPattern = UlArity();
+				const ULONG arity = pgexpr->Arity();
+				BOOL fMultiNode = (1 == ulArityPattern || 2 == ulArityPattern) && TChild0::FMulti();
+
+				return eopid == pgexpr->Pop()->Eopid() &&
+					(ulArityPattern == arity || (fMultiNode && 1 < arity));
+			}
+
+			// equivalent pattern tree
+			static
+			CExpression *PexprPattern
+				(
+				CMemoryPool *mp
+				)
+			{
+				COperator *pop = GPOS_NEW(mp) TOperator(mp);
+				GPOS_ASSERT(eopid == pop->Eopid());
+
+				if (0 == UlArity())
+				{
+					return GPOS_NEW(mp) CExpression(mp, pop);
+				}
+
+				CExpressionArray *pdrgpexpr = GPOS_NEW(mp) CExpressionArray(mp);
+				pdrgpexpr->Append(TChild0::PexprPattern(mp));
+				if (!TChild1::FNone())
+				{
+					pdrgpexpr->Append(TChild1::PexprPattern(mp));
+				}
+				if (!TChild2::FNone())
+				{
+					pdrgpexpr->Append(TChild2::PexprPattern(mp));
+				}
+				if (!TChild3::FNone())
+				{
+					pdrgpexpr->Append(TChild3::PexprPattern(mp));
+				}
+
+				return GPOS_NEW(mp) CExpression(mp, pop, pdrgpexpr);
+			}
+
+			// extraction from the group of the child at the given position,
+			// selecting the child pattern as CBinding::PexprExpandPattern does
+			static
+			CExpression *PexprExtractChild
+				(
+				CMemoryPool *mp,
+				ULONG ulPos,
+				ULONG arity,
+				CGroup *pgroup,
+				CExpression *pexprLast
+				)
+			{
+				if (TChild0::FMulti())
+				{
+					GPOS_ASSERT(UlArity() <= 2);
+
+					if (ulPos == arity - 1)
+					{
+						// special-case last child
+						return PexprExtractChildAt(mp, UlArity() - 1, pgroup, pexprLast);
+					}
+
+					// otherwise re-use multi-leaf/tree child
+					return TChild0::PexprExtractGroup(mp, pgroup, pexprLast);
+				}
+				GPOS_ASSERT(UlArity() > ulPos);
+
+				return PexprExtractChildAt(mp, ulPos, pgroup, pexprLast);
+			}
+
+			// extract a binding from a group expression; keep root node fixed
+			static
+			CExpression *PexprExtract
+				(
+				CMemoryPool *mp,
+				CGroupExpression *pgexpr,
+				CExpression *pexprLast
+				)
+			{
+				if (!FMatch(pgexpr))
+				{
+					// shallow matching fails
+					return NULL;
+				}
+
+				return CStaticBinding::PexprExtract<CStaticPatternOp>(mp, pgexpr, pexprLast);
+			}
+
+			// extract a binding from a group
+			static
+			CExpression *PexprExtractGroup
+				(
+				CMemoryPool *mp,
+				CGroup *pgroup,
+				CExpression *pexprLast
+				)
+			{
+				return CStaticBinding::PexprExtractGroup<CStaticPatternOp>(mp, pgroup, pexprLast);
+			}
+
+	}; // class CStaticPatternOp
+
+}
+
+#endif // !GPOPT_CStaticBinding_H
+
+// EOF
@@ -289,6 +289,18 @@ namespace gpopt
 				return m_pexpr;
 			}
 
+			// extract the next binding of the pattern from the given group
+			// expression, keeping the root fixed; xforms with a static pattern
+			// bind without interpreting the pattern tree
+			virtual
+			CExpression *PexprExtractBinding
+				(
+				CMemoryPool *mp,
+				CGroupExpression *pgexpr,
+				CExpression *pexprLast
+				)
+				const;
+
 			// check compatibility with another xform
 			virtual
 			BOOL FCompatible
@@ -299,6 +311,19 @@ namespace gpopt
 				return true;
 			}
 
+			// check if applying the xform to the given binding regenerates a
+			// group expression already in the memo; decided from the origins
+			// of the bound group expressions
+			virtual
+			BOOL FDuplicateBinding
+				(
+				CExpression * // pexpr
+				)
+				const
+			{
+				return false;
+			}
+
 			// compute xform promise for a given expression handle
 			virtual
 			EXformPromise Exfp(CExpressionHandle &exprhdl) const = 0;
@@ -13,12 +13,23 @@
 #define GPOPT_CXformExpandNAryJoinDPv2_H
 
 #include "gpos/base.h"
+#include "gpopt/operators/CLogicalNAryJoin.h"
 #include "gpopt/xforms/CXformExploration.h"
+#include "gpopt/xforms/CXformStaticPattern.h"
 
 namespace gpopt
 {
 	using namespace gpos;
 
+	// pattern of CXformExpandNAryJoinDPv2
+	typedef CStaticPatternOp
+		<
+		CLogicalNAryJoin, COperator::EopLogicalNAryJoin,
+		CStaticPatternMultiLeaf, // join children
+		CStaticPatternTree // predicate
+		>
+		CPatternExpandNAryJoinDPv2;
+
 	//---------------------------------------------------------------------------
 	//	@class:
 	//		CXformExpandNAryJoinDPv2
@@ -28,7 +39,7 @@ namespace gpopt
 	//		programming
 	//
 	//---------------------------------------------------------------------------
-	class CXformExpandNAryJoinDPv2 : public CXformExploration
+	class CXformExpandNAryJoinDPv2 : public CXformStaticPattern<CXformExploration, CPatternExpandNAryJoinDPv2>
 	{
 
 		private:
@@ -12,12 +12,24 @@
 #define GPOPT_CXformInnerJoin2HashJoin_H
 
 #include "gpos/base.h"
+#include "gpopt/operators/CLogicalInnerJoin.h"
 #include "gpopt/xforms/CXformImplementation.h"
+#include "gpopt/xforms/CXformStaticPattern.h"
 
 namespace gpopt
 {
 	using namespace gpos;
 	
+	// pattern of CXformInnerJoin2HashJoin
+	typedef CStaticPatternOp
+		<
+		CLogicalInnerJoin, COperator::EopLogicalInnerJoin,
+		CStaticPatternLeaf, // left child
+		CStaticPatternLeaf, // right child
+		CStaticPatternTree // predicate
+		>
+		CPatternInnerJoin2HashJoin;
+
 	//---------------------------------------------------------------------------
 	//	@class:
 	//		CXformInnerJoin2HashJoin
@@ -26,7 +38,7 @@ namespace gpopt
 	//		Transform inner join to inner Hash Join
 	//
 	//---------------------------------------------------------------------------
-	class CXformInnerJoin2HashJoin : public CXformImplementation
+	class CXformInnerJoin2HashJoin : public CXformStaticPattern<CXformImplementation, CPatternInnerJoin2HashJoin>
 	{
 
 		private:
@@ -12,12 +12,24 @@
 #define GPOPT_CXformInnerJoin2NLJoin_H
 
 #include "gpos/base.h"
+#include "gpopt/operators/CLogicalInnerJoin.h"
 #include "gpopt/xforms/CXformImplementation.h"
+#include "gpopt/xforms/CXformStaticPattern.h"
 
 namespace gpopt
 {
 	using namespace gpos;
 	
+	// pattern of CXformInnerJoin2NLJoin
+	typedef CStaticPatternOp
+		<
+		CLogicalInnerJoin, COperator::EopLogicalInnerJoin,
+		CStaticPatternLeaf, // left child
+		CStaticPatternLeaf, // right child
+		CStaticPatternLeaf // predicate
+		>
+		CPatternInnerJoin2NLJoin;
+
 	//---------------------------------------------------------------------------
 	//	@class:
 	//		CXformInnerJoin2NLJoin
@@ -26,7 +38,7 @@ namespace gpopt
 	//		Transform inner join to inner NLJ
 	//
 	//---------------------------------------------------------------------------
-	class CXformInnerJoin2NLJoin : public CXformImplementation
+	class CXformInnerJoin2NLJoin : public CXformStaticPattern<CXformImplementation, CPatternInnerJoin2NLJoin>
 	{
 
 		private:
@@ -12,12 +12,30 @@
 #define GPOPT_CXformJoinAssociativity_H
 
 #include "gpos/base.h"
+#include "gpopt/operators/CLogicalInnerJoin.h"
 #include "gpopt/xforms/CXformExploration.h"
+#include "gpopt/xforms/CXformStaticPattern.h"
 
 namespace gpopt
 {
 	using namespace gpos;
 
+	// pattern of CXformJoinAssociativity
+	typedef CStaticPatternOp
+		<
+		CLogicalInnerJoin, COperator::EopLogicalInnerJoin,
+		CStaticPatternOp // left child is a join tree
+			<
+			CLogicalInnerJoin, COperator::EopLogicalInnerJoin,
+			CStaticPatternLeaf, // left child
+			CStaticPatternLeaf, // right child
+			CStaticPatternTree // predicate
+			>,
+		CStaticPatternLeaf, // right child is a pattern leaf
+		CStaticPatternTree // join predicate
+		>
+		CPatternJoinAssociativity;
+
 	//---------------------------------------------------------------------------
 	//	@class:
 	//		CXformJoinAssociativity
@@ -26,7 +44,7 @@ namespace gpopt
 	//		Associative transformation of left-deep join tree
 	//
 	//---------------------------------------------------------------------------
-	class CXformJoinAssociativity : public CXformExploration
+	class CXformJoinAssociativity : public CXformStaticPattern<CXformExploration, CPatternJoinAssociativity>
 	{
 
 		private:
@@ -72,6 +90,10 @@ namespace gpopt
 			virtual
 			EXformPromise Exfp (CExpressionHandle &exprhdl) const;
 
+			// check if the binding undoes an earlier associativity step
+			virtual
+			BOOL FDuplicateBinding(CExpression *pexpr) const;
+
 			// actual transform
 			void Transform
 					(
@@ -12,12 +12,24 @@
 #define GPOPT_CXformJoinCommutativity_H
 
 #include "gpos/base.h"
+#include "gpopt/operators/CLogicalInnerJoin.h"
 #include "gpopt/xforms/CXformExploration.h"
+#include "gpopt/xforms/CXformStaticPattern.h"
 
 namespace gpopt
 {
 	using namespace gpos;
 
+	// pattern of CXformJoinCommutativity
+	typedef CStaticPatternOp
+		<
+		CLogicalInnerJoin, COperator::EopLogicalInnerJoin,
+		CStaticPatternLeaf, // left child
+		CStaticPatternLeaf, // right child
+		CStaticPatternLeaf // predicate
+		>
+		CPatternJoinCommutativity;
+
 	//---------------------------------------------------------------------------
 	//	@class:
 	//		CXformJoinCommutativity
@@ -26,7 +38,7 @@ namespace gpopt
 	//		Commutative transformation of join
 	//
 	//---------------------------------------------------------------------------
-	class CXformJoinCommutativity : public CXformExploration
+	class CXformJoinCommutativity : public CXformStaticPattern<CXformExploration, CPatternJoinCommutativity>
 	{
 
 		private:
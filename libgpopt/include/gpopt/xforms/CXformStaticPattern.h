@@ -0,0 +1,81 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (C) 2020 VMware, Inc. or its affiliates.
+//
+//	@filename:
+//		CXformStaticPattern.h
+//
+//	@doc:
+//		Base for xforms declaring their pattern statically
+//---------------------------------------------------------------------------
+#ifndef GPOPT_CXformStaticPattern_H
+#define GPOPT_CXformStaticPattern_H
+
+#include "gpos/base.h"
+
+#include "gpopt/search/CStaticBinding.h"
+
+namespace gpopt
+{
+	using namespace gpos;
+
+	//---------------------------------------------------------------------------
+	//	@class:
+	//		CXformStaticPattern
+	//
+	//	@doc:
+	//		Xform whose pattern is the static pattern type TPattern, see
+	//		CStaticBinding; TXform is the xform base class, e.g.,
+	//		CXformExploration. The pattern tree is still built from the
+	//		static pattern for printing and pattern checks, but bindings
+	//		are extracted by the compiled matcher.
+	//
+	//		Xforms are migrated by deriving from this template instead of
+	//		their base class and dropping the pattern tree from their ctor.
+	//
+	//---------------------------------------------------------------------------
+	template <class TXform, class TPattern>
+	class CXformStaticPattern : public TXform
+	{
+		private:
+
+			// private copy ctor
+			CXformStaticPattern(const CXformStaticPattern &);
+
+		public:
+
+			// ctor
+			explicit
+			CXformStaticPattern
+				(
+				CMemoryPool *mp
+				)
+				:
+				TXform(TPattern::PexprPattern(mp))
+			{}
+
+			// dtor
+			virtual
+			~CXformStaticPattern()
+			{}
+
+			// extract the next binding of the static pattern
+			virtual
+			CExpression *PexprExtractBinding
+				(
+				CMemoryPool *mp,
+				CGroupExpression *pgexpr,
+				CExpression *pexprLast
+				)
+				const
+			{
+				return TPattern::PexprExtract(mp, pgexpr, pexprLast);
+			}
+
+	}; // class CXformStaticPattern
+
+}
+
+#endif // !GPOPT_CXformStaticPattern_H
+
+// EOF
@@ -55,7 +55,7 @@ CColRefSetIter::Pcr() const
 {
 	ULONG id = CBitSetIter::Bit();
 
-	// resolve id through column factory
+	// resolve id through the id-indexed table of the column factory
 	return m_pcf->LookupColRef(id);
 }
 
@@ -0,0 +1,294 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (C) 2020 VMware, Inc. or its affiliates.
+//
+//	@filename:
+//		CColRefUnionFind.cpp
+//
+//	@doc:
+//		Implementation of union-find structure for equivalence classes
+//---------------------------------------------------------------------------
+
+#include "gpos/base.h"
+
+#include "gpopt/base/CColRefUnionFind.h"
+#include "gpopt/base/CColRefSetIter.h"
+
+using namespace gpopt;
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CColRefUnionFind::CColRefUnionFind
+//
+//	@doc:
+//		Ctor
+//
+//---------------------------------------------------------------------------
+CColRefUnionFind::CColRefUnionFind
+	(
+	CMemoryPool *mp
+	)
+	:
+	m_mp(mp),
+	m_phmulnode(NULL),
+	m_ulSeq(0)
+{
+	m_phmulnode = GPOS_NEW(mp) UlongToNodeMap(mp);
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CColRefUnionFind::~CColRefUnionFind
+//
+//	@doc:
+//		Dtor
+//
+//---------------------------------------------------------------------------
+CColRefUnionFind::~CColRefUnionFind()
+{
+	m_phmulnode->Release();
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CColRefUnionFind::PnodeInsert
+//
+//	@doc:
+//		Entry of the given column, added as a singleton if not present
+//
+//---------------------------------------------------------------------------
+CColRefUnionFind::SNode *
+CColRefUnionFind::PnodeInsert
+	(
+	CColRef *colref
+	)
+{
+	ULONG id = colref->Id();
+	SNode *pnode = m_phmulnode->Find(&id);
+	if (NULL == pnode)
+	{
+		pnode = GPOS_NEW(m_mp) SNode(colref);
+#ifdef GPOS_DEBUG
+		BOOL fres =
+#endif // GPOS_DEBUG
+		m_phmulnode->Insert(GPOS_NEW(m_mp) ULONG(id), pnode);
+		GPOS_ASSERT(fres);
+	}
+
+	return pnode;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CColRefUnionFind::PnodeRoot
+//
+//	@doc:
+//		Root entry of the class of the given entry; halves the path to the
+//		root on the way up so that later lookups are shorter
+//
+//---------------------------------------------------------------------------
+CColRefUnionFind::SNode *
+CColRefUnionFind::PnodeRoot
+	(
+	SNode *pnode
+	)
+	const
+{
+	GPOS_ASSERT(NULL != pnode);
+
+	while (pnode->m_ulParent != pnode->m_colref->Id())
+	{
+		SNode *pnodeParent = m_phmulnode->Find(&pnode->m_ulParent);
+		GPOS_ASSERT(NULL != pnodeParent);
+
+		pnode->m_ulParent = pnodeParent->m_ulParent;
+		pnode = m_phmulnode->Find(&pnode->m_ulParent);
+		GPOS_ASSERT(NULL != pnode);
+	}
+
+	return pnode;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CColRefUnionFind::PnodeUnion
+//
+//	@doc:
+//		Merge the classes of the given roots, hanging the smaller class
+//		below the larger one; returns the new root
+//
+//---------------------------------------------------------------------------
+CColRefUnionFind::SNode *
+CColRefUnionFind::PnodeUnion
+	(
+	SNode *pnodeFst,
+	SNode *pnodeSnd
+	)
+{
+	if (pnodeFst == pnodeSnd)
+	{
+		return pnodeFst;
+	}
+
+	if (pnodeFst->m_ulSize < pnodeSnd->m_ulSize)
+	{
+		std::swap(pnodeFst, pnodeSnd);
+	}
+
+	pnodeSnd->m_ulParent = pnodeFst->m_colref->Id();
+	pnodeFst->m_ulSize += pnodeSnd->m_ulSize;
+	pnodeFst->m_ulSeq = std::max(pnodeFst->m_ulSeq, pnodeSnd->m_ulSeq);
+
+	return pnodeFst;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CColRefUnionFind::AddEquivClass
+//
+//	@doc:
+//		Add an equivalence class, merging it with the classes it overlaps;
+//		the merged class is ordered after all others
+//
+//---------------------------------------------------------------------------
+void
+CColRefUnionFind::AddEquivClass
+	(
+	const CColRefSet *pcrs
+	)
+{
+	GPOS_ASSERT(NULL != pcrs);
+
+	SNode *pnodeRoot = NULL;
+	CColRefSetIter crsi(*pcrs);
+	while (crsi.Advance())
+	{
+		SNode *pnode = PnodeRoot(PnodeInsert(crsi.Pcr()));
+		if (NULL == pnodeRoot)
+		{
+			pnodeRoot = pnode;
+		}
+		else
+		{
+			pnodeRoot = PnodeUnion(pnodeRoot, pnode);
+		}
+	}
+
+	if (NULL != pnodeRoot)
+	{
+		pnodeRoot->m_ulSeq = ++m_ulSeq;
+	}
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CColRefUnionFind::AddEquivClasses
+//
+//	@doc:
+//		Add an array of equivalence classes in order
+//
+//---------------------------------------------------------------------------
+void
+CColRefUnionFind::AddEquivClasses
+	(
+	const CColRefSetArray *pdrgpcrs
+	)
+{
+	GPOS_ASSERT(NULL != pdrgpcrs);
+
+	const ULONG length = pdrgpcrs->Size();
+	for (ULONG ul = 0; ul < length; ul++)
+	{
+		AddEquivClass((*pdrgpcrs)[ul]);
+	}
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CColRefUnionFind::FSameClass
+//
+//	@doc:
+//		Are all columns of the given non-empty set in the same class
+//
+//---------------------------------------------------------------------------
+BOOL
+CColRefUnionFind::FSameClass
+	(
+	const CColRefSet *pcrs
+	)
+	const
+{
+	GPOS_ASSERT(NULL != pcrs);
+
+	SNode *pnodeRoot = NULL;
+	CColRefSetIter crsi(*pcrs);
+	while (crsi.Advance())
+	{
+		ULONG id = crsi.Pcr()->Id();
+		SNode *pnode = m_phmulnode->Find(&id);
+		if (NULL == pnode)
+		{
+			return false;
+		}
+
+		pnode = PnodeRoot(pnode);
+		if (NULL != pnodeRoot && pnodeRoot != pnode)
+		{
+			return false;
+		}
+		pnodeRoot = pnode;
+	}
+
+	return NULL != pnodeRoot;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CColRefUnionFind::PdrgpcrsEquivClasses
+//
+//	@doc:
+//		Equivalence classes added so far, ordered by their last extension
+//
+//---------------------------------------------------------------------------
+CColRefSetArray *
+CColRefUnionFind::PdrgpcrsEquivClasses
+	(
+	CMemoryPool *mp
+	)
+	const
+{
+	// sequence numbers of live classes are distinct, so index classes by them
+	CColRefSet **rgpcrs = GPOS_NEW_ARRAY(mp, CColRefSet*, m_ulSeq + 1);
+	for (ULONG ul = 0; ul <= m_ulSeq; ul++)
+	{
+		rgpcrs[ul] = NULL;
+	}
+
+	UlongToNodeMapIter hmiter(m_phmulnode);
+	while (hmiter.Advance())
+	{
+		SNode *pnode = const_cast<SNode *>(hmiter.Value());
+		ULONG ulSeq = PnodeRoot(pnode)->m_ulSeq;
+		GPOS_ASSERT(ulSeq <= m_ulSeq);
+
+		if (NULL == rgpcrs[ulSeq])
+		{
+			rgpcrs[ulSeq] = GPOS_NEW(mp) CColRefSet(mp);
+		}
+		rgpcrs[ulSeq]->Include(pnode->m_colref);
+	}
+
+	CColRefSetArray *pdrgpcrs = GPOS_NEW(mp) CColRefSetArray(mp);
+	for (ULONG ul = 0; ul <= m_ulSeq; ul++)
+	{
+		if (NULL != rgpcrs[ul])
+		{
+			pdrgpcrs->Append(rgpcrs[ul]);
+		}
+	}
+	GPOS_DELETE_ARRAY(rgpcrs);
+
+	return pdrgpcrs;
+}
+
+// EOF
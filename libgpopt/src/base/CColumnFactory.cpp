@@ -43,8 +43,13 @@ CColumnFactory::CColumnFactory()
 {
 	CAutoMemoryPool amp;
 	m_mp = amp.Pmp();
-	
-	// initialize hash table
+
+	for (ULONG ul = 0; ul < GPOPT_COLFACTORY_CHUNKS; ul++)
+	{
+		m_rgrgpcr[ul] = NULL;
+	}
+
+	// initialize overflow hash table
 	m_sht.Init
 		(
 		m_mp,
@@ -73,6 +78,12 @@ CColumnFactory::~CColumnFactory()
 {
 	CRefCount::SafeRelease(m_phmcrcrs);
 
+	// dealloc id-indexed table
+	for (ULONG ul = 0; ul < GPOPT_COLFACTORY_CHUNKS; ul++)
+	{
+		GPOS_DELETE_ARRAY(m_rgrgpcr[ul]);
+	}
+
 	// dealloc hash table
 	m_sht.Cleanup();
 
@@ -151,7 +162,7 @@ CColumnFactory::PcrCreate
 //	@doc:
 //		Basic implementation of all factory methods;
 //		Name and id have already determined, we just create the ColRef and
-//		insert it into the hashtable
+//		insert it into the lookup table
 //
 //---------------------------------------------------------------------------
 CColRef *
@@ -172,7 +183,7 @@ CColumnFactory::PcrCreate
 	
 	// ensure uniqueness
 	GPOS_ASSERT(NULL == LookupColRef(id));
-	m_sht.Insert(colref);
+	Insert(colref);
 	colref->MarkAsUsed();
 	
 	return a_pcr.Reset();
@@ -186,7 +197,7 @@ CColumnFactory::PcrCreate
 //	@doc:
 //		Basic implementation of all factory methods;
 //		Name and id have already determined, we just create the ColRef and
-//		insert it into the hashtable
+//		insert it into the lookup table
 //
 //---------------------------------------------------------------------------
 CColRef *
@@ -208,7 +219,7 @@ CColumnFactory::PcrCreate
 
 	// ensure uniqueness
 	GPOS_ASSERT(NULL == LookupColRef(id));
-	m_sht.Insert(colref);
+	Insert(colref);
 	if (mark_as_used)
 	{
 		colref->MarkAsUsed();
@@ -225,7 +236,7 @@ CColumnFactory::PcrCreate
 //	@doc:
 //		Basic implementation of all factory methods;
 //		Name and id have already determined, we just create the ColRef and
-//		insert it into the hashtable
+//		insert it into the lookup table
 //
 //---------------------------------------------------------------------------
 CColRef *
@@ -251,7 +262,7 @@ CColumnFactory::PcrCreate
 
 	// ensure uniqueness
 	GPOS_ASSERT(NULL == LookupColRef(id));
-	m_sht.Insert(colref);
+	Insert(colref);
 	colref->MarkAsUsed();
 
 	return a_pcr.Reset();
@@ -318,18 +329,59 @@ CColumnFactory::PcrCopy
 
 //---------------------------------------------------------------------------
 //	@function:
-//		CColumnFactory::LookupColRef
+//		CColumnFactory::Insert
+//
+//	@doc:
+//		Add a newly created column reference to the id-indexed table,
+//		allocating its chunk if needed, or to the overflow hash table if
+//		its id is beyond the capacity of the table
+//
+//---------------------------------------------------------------------------
+void
+CColumnFactory::Insert
+	(
+	CColRef *colref
+	)
+{
+	ULONG id = colref->m_id;
+	if (!FDenseId(id))
+	{
+		m_sht.Insert(colref);
+		return;
+	}
+
+	const ULONG ulChunk = id / GPOPT_COLFACTORY_CHUNK_SIZE;
+	if (NULL == m_rgrgpcr[ulChunk])
+	{
+		CColRef **rgpcr = GPOS_NEW_ARRAY(m_mp, CColRef *, GPOPT_COLFACTORY_CHUNK_SIZE);
+		for (ULONG ul = 0; ul < GPOPT_COLFACTORY_CHUNK_SIZE; ul++)
+		{
+			rgpcr[ul] = NULL;
+		}
+
+		m_rgrgpcr[ulChunk] = rgpcr;
+	}
+
+	m_rgrgpcr[ulChunk][id % GPOPT_COLFACTORY_CHUNK_SIZE] = colref;
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CColumnFactory::PcrLookupOverflow
 //
 //	@doc:
-//		Lookup by id
+//		Lookup an id beyond the capacity of the id-indexed table
 //
 //---------------------------------------------------------------------------
 CColRef *
-CColumnFactory::LookupColRef
+CColumnFactory::PcrLookupOverflow
 	(
 	ULONG id
 	)
 {
+	GPOS_ASSERT(!FDenseId(id));
+
 	CSyncHashtableAccessByKey<CColRef, ULONG> shtacc(m_sht, id);
 	
 	CColRef *colref = shtacc.Find();
@@ -355,7 +407,15 @@ CColumnFactory::Destroy
 	GPOS_ASSERT(NULL != colref);
 
 	ULONG id = colref->m_id;
-	
+
+	if (FDenseId(id))
+	{
+		GPOS_ASSERT(colref == LookupColRef(id));
+
+		// unlink from id-indexed table
+		m_rgrgpcr[id / GPOPT_COLFACTORY_CHUNK_SIZE][id % GPOPT_COLFACTORY_CHUNK_SIZE] = NULL;
+	}
+	else
 	{
 		// scope for the hash table accessor
 		CSyncHashtableAccessByKey<CColRef, ULONG>
@@ -18,6 +18,7 @@
 #include "gpopt/base/CColConstraintsArrayMapper.h"
 #include "gpopt/base/CColConstraintsHashMapper.h"
 #include "gpopt/base/CColRefSetIter.h"
+#include "gpopt/base/CColRefUnionFind.h"
 #include "gpopt/base/CColRefTable.h"
 #include "gpopt/base/CConstraint.h"
 #include "gpopt/base/CConstraintInterval.h"
@@ -497,6 +498,14 @@ CConstraint::PcnstrFromScalarBoolOp
 	*ppdrgpcrs = GPOS_NEW(mp) CColRefSetArray(mp);
 	CConstraintArray *pdrgpcnstr = GPOS_NEW(mp) CConstraintArray(mp);
 
+	// the equivalence classes of the conjuncts of an AND are all merged, which
+	// is done once at the end instead of once per conjunct
+	CColRefUnionFind *pcruf = NULL;
+	if (CPredicateUtils::FAnd(pexpr))
+	{
+		pcruf = GPOS_NEW(mp) CColRefUnionFind(mp);
+	}
+
 	for (ULONG ul = 0; ul < arity; ul++)
 	{
 		CColRefSetArray *pdrgpcrsChild = NULL;
@@ -515,13 +524,27 @@ CConstraint::PcnstrFromScalarBoolOp
 		GPOS_ASSERT(NULL != pdrgpcrsChild);
 
 		pdrgpcnstr->Append(pcnstrChild);
-		CColRefSetArray *pdrgpcrsMerged = PdrgpcrsMergeFromBoolOp(mp, pexpr, *ppdrgpcrs, pdrgpcrsChild);
+		if (NULL != pcruf)
+		{
+			pcruf->AddEquivClasses(pdrgpcrsChild);
+		}
+		else
+		{
+			CColRefSetArray *pdrgpcrsMerged = PdrgpcrsMergeFromBoolOp(mp, pexpr, *ppdrgpcrs, pdrgpcrsChild);
 
-		(*ppdrgpcrs)->Release();
-		*ppdrgpcrs = pdrgpcrsMerged;
+			(*ppdrgpcrs)->Release();
+			*ppdrgpcrs = pdrgpcrsMerged;
+		}
 		pdrgpcrsChild->Release();
 	}
 
+	if (NULL != pcruf)
+	{
+		(*ppdrgpcrs)->Release();
+		*ppdrgpcrs = pcruf->PdrgpcrsEquivClasses(mp);
+		pcruf->Release();
+	}
+
 	const ULONG length = pdrgpcnstr->Size();
 	if (0 == length)
 	{
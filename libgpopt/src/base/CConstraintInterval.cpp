@@ -731,7 +731,9 @@ CConstraintInterval::PexprScalar
 {
 	if (NULL == m_pexprScalar)
 	{
-		m_pexprScalar = PexprConstructScalar(mp);
+		// equal intervals are derived repeatedly for the same column, share
+		// their scalar form so that predicate dedup compares pointers
+		m_pexprScalar = CUtils::PexprInternScalar(PexprConstructScalar(mp));
 	}
 
 	return m_pexprScalar;
@@ -62,6 +62,8 @@ CCostContext::CCostContext
 	m_ulOptReq(ulOptReq),
 	m_fPruned(false),
 	m_pstats(NULL),
+	m_dRowsCosting(-1.0),
+	m_dWidthCosting(-1.0),
 	m_poc(poc)
 {
 	GPOS_ASSERT(NULL != poc);
@@ -249,6 +251,94 @@ CCostContext::DerivePlanProps
 }
 
 
+//---------------------------------------------------------------------------
+//	@function:
+//		CCostContext::CopyCost
+//
+//	@doc:
+//		Copy cost and stats from a cost-equivalent context instead of
+//		computing them
+//
+//---------------------------------------------------------------------------
+void
+CCostContext::CopyCost
+	(
+	const CCostContext *pccEquivalent
+	)
+{
+	GPOS_ASSERT(NULL == m_pstats);
+	GPOS_ASSERT(estCosted == pccEquivalent->Est());
+	GPOS_ASSERT(!pccEquivalent->FPruned());
+	GPOS_ASSERT(FEqualForCosting(this, pccEquivalent));
+
+	pccEquivalent->Pstats()->AddRef();
+	m_pstats = pccEquivalent->Pstats();
+	m_dRowsCosting = pccEquivalent->m_dRowsCosting;
+	m_dWidthCosting = pccEquivalent->m_dWidthCosting;
+	SetCost(pccEquivalent->Cost());
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CCostContext::FEqualForCosting
+//
+//	@doc:
+//		Stats and cost of a context depend on its main optimization context
+//		only through the required columns, the stats requirements and the
+//		stats context; given the same group expression and the same child
+//		plans, contexts that agree on these have equal stats and cost
+//		regardless of their other required plan properties
+//
+//---------------------------------------------------------------------------
+BOOL
+CCostContext::FEqualForCosting
+	(
+	const CCostContext *pccFst,
+	const CCostContext *pccSnd
+	)
+{
+	GPOS_ASSERT(NULL != pccFst);
+	GPOS_ASSERT(NULL != pccSnd);
+
+	return
+		pccFst->Pgexpr() == pccSnd->Pgexpr() &&
+		COptimizationContext::FEqualForStats(pccFst->Poc(), pccSnd->Poc()) &&
+		pccFst->Poc()->Prpp()->PcrsRequired()->Equals(pccSnd->Poc()->Prpp()->PcrsRequired());
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CCostContext::FEqualCostInputs
+//
+//	@doc:
+//		Given the same group expression and the same child plans, the cost
+//		model reads the stats of the context and its rows and width; contexts
+//		sharing stats whose rows and width are equal have equal cost even if
+//		their required columns or stats requirements differ
+//
+//---------------------------------------------------------------------------
+BOOL
+CCostContext::FEqualCostInputs
+	(
+	const CCostContext *pccFst,
+	const CCostContext *pccSnd
+	)
+{
+	GPOS_ASSERT(NULL != pccFst);
+	GPOS_ASSERT(NULL != pccSnd);
+	GPOS_ASSERT(pccFst->FCostInputsDerived());
+	GPOS_ASSERT(pccSnd->FCostInputsDerived());
+
+	return
+		pccFst->Pgexpr() == pccSnd->Pgexpr() &&
+		pccFst->Pstats() == pccSnd->Pstats() &&
+		pccFst->DRowsCosting() == pccSnd->DRowsCosting() &&
+		pccFst->DWidthCosting() == pccSnd->DWidthCosting();
+}
+
+
 //---------------------------------------------------------------------------
 //	@function:
 //		CCostContext::operator ==
@@ -579,8 +669,8 @@ CCostContext::CostCompute
 	CCostArray *pdrgpcostChildren
 	)
 {
-	// derive context stats
-	DeriveStats();
+	// derive context stats, rows and width
+	DeriveCostInputs(mp);
 
 	ULONG arity = 0;
 	if (NULL != m_pdrgpoc)
@@ -591,22 +681,15 @@ CCostContext::CostCompute
 	m_pstats->AddRef();
 	ICostModel::SCostingInfo ci(mp, arity, GPOS_NEW(mp) ICostModel::CCostingStats(m_pstats));
 
-	ICostModel *pcm = COptCtxt::PoctxtFromTLS()->GetCostModel();
+	COptCtxt *poptctxt = COptCtxt::PoctxtFromTLS();
+	ICostModel *pcm = poptctxt->GetCostModel();
 
 	CExpressionHandle exprhdl(mp);
 	exprhdl.Attach(this);
 
 	// extract local costing info
-	DOUBLE rows = m_pstats->Rows().Get();
-	if (CDistributionSpec::EdptPartitioned == Pdpplan()->Pds()->Edpt())
-	{
-		// scale statistics row estimate by number of segments
-		rows = DRowsPerHost().Get();
-	}
-	ci.SetRows(rows);
-
-	DOUBLE width = m_pstats->Width(mp, m_poc->Prpp()->PcrsRequired()).Get();
-	ci.SetWidth(width);
+	ci.SetRows(m_dRowsCosting);
+	ci.SetWidth(m_dWidthCosting);
 
 	DOUBLE num_rebinds = m_pstats->NumRebinds().Get();
 	ci.SetRebinds(num_rebinds);
@@ -624,15 +707,28 @@ CCostContext::CostCompute
 		child_stats->AddRef();
 		ci.SetChildStats(ul, GPOS_NEW(mp) ICostModel::CCostingStats(child_stats));
 
-		DOUBLE dRowsChild = child_stats->Rows().Get();
-		if (CDistributionSpec::EdptPartitioned == pccChild->Pdpplan()->Pds()->Edpt())
+		DOUBLE dRowsChild = 0.0;
+		DOUBLE dWidthChild = 0.0;
+		if (!GPOS_FTRACE(EopttraceDisableCostReuse) &&
+			pccChild->FCostInputsDerived() && pocChild == pccChild->Poc())
+		{
+			// the child context costed its plan under the same requirements,
+			// so its rows and width are the ones we would compute here
+			dRowsChild = pccChild->DRowsCosting();
+			dWidthChild = pccChild->DWidthCosting();
+			poptctxt->IncrementCounter(COptCtxt::EocCostInputsReused);
+		}
+		else
 		{
-			// scale statistics row estimate by number of segments
-			dRowsChild = pccChild->DRowsPerHost().Get();
+			dRowsChild = child_stats->Rows().Get();
+			if (CDistributionSpec::EdptPartitioned == pccChild->Pdpplan()->Pds()->Edpt())
+			{
+				// scale statistics row estimate by number of segments
+				dRowsChild = pccChild->DRowsPerHost().Get();
+			}
+			dWidthChild = child_stats->Width(mp, pocChild->Prpp()->PcrsRequired()).Get();
 		}
 		ci.SetChildRows(ul, dRowsChild);
-
-		DOUBLE dWidthChild = child_stats->Width(mp, pocChild->Prpp()->PcrsRequired()).Get();
 		ci.SetChildWidth(ul, dWidthChild);
 
 		DOUBLE dRebindsChild = child_stats->NumRebinds().Get();
@@ -647,12 +743,49 @@ CCostContext::CostCompute
 	return pcm->Cost(exprhdl, &ci);
 }
 
+//---------------------------------------------------------------------------
+//	@function:
+//		CCostContext::DeriveCostInputs
+//
+//	@doc:
+//		Derive stats of the context and the rows and width passed to the
+//		cost model; parents read rows and width of their child plans from
+//		here instead of recomputing them for every context costed on top
+//
+//---------------------------------------------------------------------------
+void
+CCostContext::DeriveCostInputs
+	(
+	CMemoryPool *mp
+	)
+{
+	if (FCostInputsDerived())
+	{
+		return;
+	}
+
+	DeriveStats();
+	GPOS_ASSERT(NULL != m_pstats);
+
+	DOUBLE rows = m_pstats->Rows().Get();
+	if (CDistributionSpec::EdptPartitioned == Pdpplan()->Pds()->Edpt())
+	{
+		// scale statistics row estimate by number of segments
+		rows = DRowsPerHost().Get();
+	}
+
+	m_dWidthCosting = m_pstats->Width(mp, m_poc->Prpp()->PcrsRequired()).Get();
+	m_dRowsCosting = rows;
+}
+
+
 //---------------------------------------------------------------------------
 //	@function:
 //		CCostContext::DRowsPerHost
 //
 //	@doc:
-//		Return the number of rows per host
+//		Return the number of rows per host; for hash distributions, this
+//		accounts for skew on the distribution columns
 //
 //---------------------------------------------------------------------------
 CDouble
@@ -660,7 +793,8 @@ CCostContext::DRowsPerHost() const
 {
 	DOUBLE rows = Pstats()->Rows().Get();
 	COptCtxt *poptctxt = COptCtxt::PoctxtFromTLS();
-	const ULONG ulHosts = poptctxt->GetCostModel()->UlHosts();
+	ICostModel *pcm = poptctxt->GetCostModel();
+	const ULONG ulHosts = pcm->UlHosts();
 
 	CDistributionSpec *pds =  Pdpplan()->Pds();
 	if (CDistributionSpec::EdtHashed == pds->Edt())
@@ -686,16 +820,30 @@ CCostContext::DRowsPerHost() const
 
 		CStatisticsConfig *stats_config = poptctxt->GetOptimizerConfig()->GetStatsConf();
 		CDouble dNDVs = CStatisticsUtils::Groups(m_mp, Pstats(), stats_config, pdrgpul, NULL /*keys*/);
+
+		// all rows of the most frequent value of the distribution columns
+		// are sent to a single host, which may then hold many more rows than
+		// the average host; finding that value walks the histograms, so only
+		// do it if the cost model uses it
+		CDouble dMaxValueFreq(0.0);
+		if (pcm->FCostsHashSkew())
+		{
+			dMaxValueFreq = CStatisticsUtils::MaxValueFreq(Pstats(), pdrgpul);
+		}
 		pdrgpul->Release();
 
+		CDouble dRowsPerHost = pcm->DRowsMaxHost(CDouble(rows), dMaxValueFreq);
+
 		if (dNDVs < ulHosts)
 		{
 			// estimated number of distinct values of distribution columns is smaller than number of hosts.
 			// We assume data is distributed across a subset of hosts in this case. This results in a larger
 			// number of rows per host compared to the uniform case, allowing us to capture data skew in
 			// cost computation
-			return CDouble(rows / dNDVs.Get());
+			dRowsPerHost = std::max(dRowsPerHost.Get(), rows / dNDVs.Get());
 		}
+
+		return dRowsPerHost;
 	}
 
 	return CDouble(rows / ulHosts);
@@ -212,34 +212,61 @@ CDrvdPropCtxtPlan::CopyCTEProducerProps
 
 //---------------------------------------------------------------------------
 //	@function:
-//		CDrvdPropCtxtPlan::SetExpectedPartitionSelectors
+//		CDrvdPropCtxtPlan::FExpectsPartitionSelectors
 //
 //	@doc:
-//		Set the number of expected partition selectors based on the given
-//		operator and the given cost context
+//		Check if partition selectors are expected for the given operator,
+//		and return the scan id they are expected for
 //
 //---------------------------------------------------------------------------
-void
-CDrvdPropCtxtPlan::SetExpectedPartitionSelectors
+BOOL
+CDrvdPropCtxtPlan::FExpectsPartitionSelectors
 	(
 	COperator *pop,
-	CCostContext *pcc
+	ULONG *pulScanId
 	)
 {
-	ULONG scan_id = 0;
+	GPOS_ASSERT(NULL != pulScanId);
+
 	if (CUtils::FPhysicalScan(pop) && CPhysicalScan::PopConvert(pop)->FDynamicScan())
 	{
-		scan_id = CPhysicalDynamicScan::PopConvert(pop)->ScanId();
+		*pulScanId = CPhysicalDynamicScan::PopConvert(pop)->ScanId();
 	}
 	else if (COperator::EopPhysicalSerialUnionAll == pop->Eopid() && CPhysicalUnionAll::PopConvert(pop)->IsPartialIndex())
 	{
-		scan_id = CPhysicalUnionAll::PopConvert(pop)->UlScanIdPartialIndex();
+		*pulScanId = CPhysicalUnionAll::PopConvert(pop)->UlScanIdPartialIndex();
 	}
 	else if (COperator::EopPhysicalPartitionSelector == pop->Eopid())
 	{
-		scan_id = CPhysicalPartitionSelector::PopConvert(pop)->ScanId();
+		*pulScanId = CPhysicalPartitionSelector::PopConvert(pop)->ScanId();
 	}
 	else
+	{
+		return false;
+	}
+
+	return true;
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDrvdPropCtxtPlan::SetExpectedPartitionSelectors
+//
+//	@doc:
+//		Set the number of expected partition selectors based on the given
+//		operator and the given cost context
+//
+//---------------------------------------------------------------------------
+void
+CDrvdPropCtxtPlan::SetExpectedPartitionSelectors
+	(
+	COperator *pop,
+	CCostContext *pcc
+	)
+{
+	ULONG scan_id = 0;
+	if (!FExpectsPartitionSelectors(pop, &scan_id))
 	{
 		return;
 	}
@@ -14,6 +14,7 @@
 #include "gpopt/operators/CScalar.h"
 #include "gpopt/base/CPartIndexMap.h"
 #include "gpopt/base/CCTEMap.h"
+#include "gpopt/base/COptCtxt.h"
 #include "gpopt/base/CDrvdPropPlan.h"
 #include "gpopt/base/CDrvdPropCtxtPlan.h"
 #include "gpopt/base/CReqdPropPlan.h"
@@ -39,7 +40,11 @@ CDrvdPropPlan::CDrvdPropPlan
 	m_prs(NULL),
 	m_ppim(NULL),
 	m_ppfm(NULL),
-	m_pcm(NULL)
+	m_pcm(NULL),
+	m_ulDerived(0),
+	m_mp(NULL),
+	m_pexprhdl(NULL),
+	m_pdpctxt(NULL)
 {}
 
 
@@ -53,6 +58,7 @@ CDrvdPropPlan::CDrvdPropPlan
 //---------------------------------------------------------------------------
 CDrvdPropPlan::~CDrvdPropPlan()
 {
+	CRefCount::SafeRelease(m_pdpctxt);
 	CRefCount::SafeRelease(m_pos);
 	CRefCount::SafeRelease(m_pds);
 	CRefCount::SafeRelease(m_prs);
@@ -99,25 +105,177 @@ CDrvdPropPlan::Derive
 	CDrvdPropCtxt *pdpctxt
 	)
 {
+	DeriveOnDemand(mp, exprhdl, pdpctxt);
+	CompleteDerivation();
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDrvdPropPlan::DeriveOnDemand
+//
+//	@doc:
+//		Attach to the given handle; properties are derived by their
+//		accessors when first requested. Properties of CTE consumers are
+//		copied from the producer and are not derived on demand
+//
+//---------------------------------------------------------------------------
+void
+CDrvdPropPlan::DeriveOnDemand
+	(
+	CMemoryPool *mp,
+	CExpressionHandle &exprhdl,
+	CDrvdPropCtxt *pdpctxt
+	)
+{
+	GPOS_ASSERT(0 == m_ulDerived);
+	GPOS_ASSERT(NULL == m_pexprhdl);
+
+	m_mp = mp;
+	m_pexprhdl = &exprhdl;
+	m_pdpctxt = pdpctxt;
+	if (NULL != m_pdpctxt)
+	{
+		m_pdpctxt->AddRef();
+	}
+
 	CPhysical *popPhysical = CPhysical::PopConvert(exprhdl.Pop());
 	if (NULL != pdpctxt && COperator::EopPhysicalCTEConsumer == popPhysical->Eopid())
 	{
 		CopyCTEProducerPlanProps(mp, pdpctxt, popPhysical);
+		m_ulDerived = (1 << EdptPos) | (1 << EdptPds) | (1 << EdptPrs) | (1 << EdptPpim) | (1 << EdptPpfm);
 	}
-	else
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDrvdPropPlan::DeriveProp
+//
+//	@doc:
+//		Derive a single property by calling the corresponding derivation
+//		function on the operator
+//
+//---------------------------------------------------------------------------
+void
+CDrvdPropPlan::DeriveProp
+	(
+	EDrvdPropType edpt
+	)
+	const
+{
+	GPOS_ASSERT(NULL != m_pexprhdl && "Plan properties are not attached to a handle");
+	GPOS_ASSERT(!FDerived(edpt));
+
+	CPhysical *popPhysical = CPhysical::PopConvert(m_pexprhdl->Pop());
+	switch (edpt)
 	{
-		// call property derivation functions on the operator
-		m_pos = popPhysical->PosDerive(mp, exprhdl);
-		m_pds = popPhysical->PdsDerive(mp, exprhdl);
-		m_prs = popPhysical->PrsDerive(mp, exprhdl);
-		m_ppim = popPhysical->PpimDerive(mp, exprhdl, pdpctxt);
-		m_ppfm = popPhysical->PpfmDerive(mp, exprhdl);
-
-		GPOS_ASSERT(NULL != m_ppim);
-		GPOS_ASSERT(CDistributionSpec::EdtAny != m_pds->Edt() && "CDistributionAny is a require-only, cannot be derived");
+		case EdptPos:
+			m_pos = popPhysical->PosDerive(m_mp, *m_pexprhdl);
+			break;
+
+		case EdptPds:
+			m_pds = popPhysical->PdsDerive(m_mp, *m_pexprhdl);
+			GPOS_ASSERT(CDistributionSpec::EdtAny != m_pds->Edt() && "CDistributionAny is a require-only, cannot be derived");
+			break;
+
+		case EdptPrs:
+			m_prs = popPhysical->PrsDerive(m_mp, *m_pexprhdl);
+			break;
+
+		case EdptPpim:
+			m_ppim = popPhysical->PpimDerive(m_mp, *m_pexprhdl, m_pdpctxt);
+			GPOS_ASSERT(NULL != m_ppim);
+			break;
+
+		case EdptPpfm:
+			m_ppfm = popPhysical->PpfmDerive(m_mp, *m_pexprhdl);
+			break;
+
+		case EdptPcm:
+			m_pcm = popPhysical->PcmDerive(m_mp, *m_pexprhdl);
+			break;
+
+		default:
+			GPOS_ASSERT(!"Invalid plan property");
+	}
+
+	m_ulDerived |= (1 << edpt);
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDrvdPropPlan::CompleteDerivation
+//
+//	@doc:
+//		Derive all remaining properties and detach from handle
+//
+//---------------------------------------------------------------------------
+void
+CDrvdPropPlan::CompleteDerivation()
+{
+	for (ULONG ul = 0; ul < EdptSentinel; ul++)
+	{
+		EnsureDerived((EDrvdPropType) ul);
+	}
+
+	Detach();
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDrvdPropPlan::AbandonDerivation
+//
+//	@doc:
+//		Stop on-demand derivation; the container may only be abandoned by
+//		its last owner since the remaining properties cannot be derived
+//		afterwards
+//
+//---------------------------------------------------------------------------
+void
+CDrvdPropPlan::AbandonDerivation()
+{
+	GPOS_ASSERT(NULL != m_pexprhdl);
+	GPOS_ASSERT(1 == RefCount() || FComplete());
+
+	Detach();
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDrvdPropPlan::Detach
+//
+//	@doc:
+//		Detach from handle and record how many properties were derived and
+//		how many were never requested
+//
+//---------------------------------------------------------------------------
+void
+CDrvdPropPlan::Detach()
+{
+	COptCtxt *poctxt = COptCtxt::PoctxtFromTLS();
+	if (NULL != poctxt)
+	{
+		ULONG ulDerived = 0;
+		for (ULONG ul = 0; ul < EdptSentinel; ul++)
+		{
+			if (FDerived((EDrvdPropType) ul))
+			{
+				ulDerived++;
+			}
+		}
+
+		poctxt->IncrementCounter(COptCtxt::EocPlanPropsDerived, ulDerived);
+		poctxt->IncrementCounter(COptCtxt::EocPlanPropsSkipped, EdptSentinel - ulDerived);
 	}
 
-	m_pcm = popPhysical->PcmDerive(mp, exprhdl);
+	CRefCount::SafeRelease(m_pdpctxt);
+	m_pdpctxt = NULL;
+	m_pexprhdl = NULL;
+	m_mp = NULL;
 }
 
 
@@ -188,11 +346,11 @@ CDrvdPropPlan::FSatisfies
 	GPOS_ASSERT(NULL != prpp->Pcter());
 
 	return
-		m_pos->FSatisfies(prpp->Peo()->PosRequired()) &&
-		m_pds->FSatisfies(prpp->Ped()->PdsRequired()) &&
-		m_prs->FSatisfies(prpp->Per()->PrsRequired()) && 
-		m_ppim->FSatisfies(prpp->Pepp()->PppsRequired()) &&
-		m_pcm->FSatisfies(prpp->Pcter());
+		Pos()->FSatisfies(prpp->Peo()->PosRequired()) &&
+		Pds()->FSatisfies(prpp->Ped()->PdsRequired()) &&
+		Prs()->FSatisfies(prpp->Per()->PrsRequired()) && 
+		Ppim()->FSatisfies(prpp->Pepp()->PppsRequired()) &&
+		GetCostModel()->FSatisfies(prpp->Pcter());
 }
 
 
@@ -207,10 +365,10 @@ CDrvdPropPlan::FSatisfies
 ULONG
 CDrvdPropPlan::HashValue() const
 {
-	ULONG ulHash = gpos::CombineHashes(m_pos->HashValue(), m_pds->HashValue());
-	ulHash = gpos::CombineHashes(ulHash, m_prs->HashValue());
-	ulHash = gpos::CombineHashes(ulHash, m_ppim->HashValue());
-	ulHash = gpos::CombineHashes(ulHash, m_pcm->HashValue());
+	ULONG ulHash = gpos::CombineHashes(Pos()->HashValue(), Pds()->HashValue());
+	ulHash = gpos::CombineHashes(ulHash, Prs()->HashValue());
+	ulHash = gpos::CombineHashes(ulHash, Ppim()->HashValue());
+	ulHash = gpos::CombineHashes(ulHash, GetCostModel()->HashValue());
 
 	return ulHash;
 }
@@ -230,11 +388,11 @@ CDrvdPropPlan::Equals
 	)
 	const
 {
-	return m_pos->Matches(pdpplan->Pos()) &&
-			m_pds->Equals(pdpplan->Pds()) &&
-			m_prs->Matches(pdpplan->Prs()) &&
-			m_ppim->Equals(pdpplan->Ppim()) &&
-			m_pcm->Equals(pdpplan->GetCostModel());
+	return Pos()->Matches(pdpplan->Pos()) &&
+			Pds()->Equals(pdpplan->Pds()) &&
+			Prs()->Matches(pdpplan->Prs()) &&
+			Ppim()->Equals(pdpplan->Ppim()) &&
+			GetCostModel()->Equals(pdpplan->GetCostModel());
 }
 
 //---------------------------------------------------------------------------
@@ -253,13 +411,13 @@ CDrvdPropPlan::OsPrint
 	const
 {
 		os	<< "Drvd Plan Props ("
-			<< "ORD: " << (*m_pos)
-			<< ", DIST: " << (*m_pds)
-			<< ", REWIND: " << (*m_prs) << ")"
-			<< ", Part-Index Map: [" << *m_ppim << "]";
+			<< "ORD: " << (*Pos())
+			<< ", DIST: " << (*Pds())
+			<< ", REWIND: " << (*Prs()) << ")"
+			<< ", Part-Index Map: [" << *Ppim() << "]";
 			os << ", Part Filter Map: ";
-			m_ppfm->OsPrint(os);
-			os << ", CTE Map: [" << *m_pcm << "]";
+			Ppfm()->OsPrint(os);
+			os << ", CTE Map: [" << *GetCostModel() << "]";
 
 		return os;
 }
@@ -18,6 +18,7 @@
 #include "gpopt/base/COptCtxt.h"
 #include "gpopt/cost/ICostModel.h"
 #include "gpopt/eval/IConstExprEvaluator.h"
+#include "gpopt/operators/CExpressionInterner.h"
 #include "gpopt/optimizer/COptimizerConfig.h"
 
 using namespace gpopt;
@@ -25,6 +26,25 @@ using namespace gpopt;
 // value of the first value part id
 ULONG COptCtxt::m_ulFirstValidPartId = 1;
 
+// string encoding of optimizer work counters
+const CHAR rgszCounters[][40] =
+	{
+	"Plan Properties Derived",
+	"Plan Properties Skipped",
+	"Plan Property Containers Reused",
+	"Cost Computations Saved",
+	"Stats Cache Hits",
+	"Stats Cache Misses",
+	"Handle Child Arrays Inline",
+	"Handle Child Arrays Allocated",
+	"Cost Contexts Pruned",
+	"Duplicate Bindings Blocked",
+	"Cost Inputs Reused",
+	"Cost Results Reused",
+	"Cost Context Tables Created"
+	};
+GPOS_CPL_ASSERT(COptCtxt::EocSentinel == GPOS_ARRAY_SIZE(rgszCounters));
+
 //---------------------------------------------------------------------------
 //	@function:
 //		COptCtxt::COptCtxt
@@ -50,6 +70,7 @@ COptCtxt::COptCtxt
 	m_pcomp(GPOS_NEW(m_mp) CDefaultComparator(pceeval)),
 	m_auPartId(m_ulFirstValidPartId),
 	m_pcteinfo(NULL),
+	m_pexprinterner(NULL),
 	m_pdrgpcrSystemCols(NULL),
 	m_optimizer_config(optimizer_config),
 	m_fDMLQuery(false),
@@ -66,7 +87,13 @@ COptCtxt::COptCtxt
 	GPOS_ASSERT(NULL != optimizer_config->GetCostModel());
 	
 	m_pcteinfo = GPOS_NEW(m_mp) CCTEInfo(m_mp);
+	m_pexprinterner = GPOS_NEW(m_mp) CExpressionInterner(m_mp);
 	m_cost_model = optimizer_config->GetCostModel();
+
+	for (ULONG ul = 0; ul < EocSentinel; ul++)
+	{
+		m_rgulpCounters[ul] = 0;
+	}
 }
 
 
@@ -81,6 +108,7 @@ COptCtxt::COptCtxt
 //---------------------------------------------------------------------------
 COptCtxt::~COptCtxt()
 {
+	GPOS_DELETE(m_pexprinterner);
 	GPOS_DELETE(m_pcf);
 	GPOS_DELETE(m_pcomp);
 	m_pceeval->Release();
@@ -130,6 +158,43 @@ COptCtxt::PoctxtCreate
 }
 
 
+//---------------------------------------------------------------------------
+//	@function:
+//		COptCtxt::OsPrintCounters
+//
+//	@doc:
+//		Print optimizer work counters
+//
+//---------------------------------------------------------------------------
+IOstream &
+COptCtxt::OsPrintCounters
+	(
+	IOstream &os
+	)
+	const
+{
+	for (ULONG ul = 0; ul < EocSentinel; ul++)
+	{
+		os << "[OPT]: " << rgszCounters[ul] << ": " << m_rgulpCounters[ul] << std::endl;
+	}
+
+	ULONG_PTR ulpLookups = m_rgulpCounters[EocStatsCacheHits] + m_rgulpCounters[EocStatsCacheMisses];
+	if (0 < ulpLookups)
+	{
+		os << "[OPT]: Stats Cache Hit Ratio: "
+		   << CDouble(m_rgulpCounters[EocStatsCacheHits]) / CDouble(ulpLookups)
+		   << std::endl;
+	}
+
+	// every handle child array used to be allocated
+	os << "[OPT]: Handle Child Arrays Allocated Without Inline Storage: "
+	   << m_rgulpCounters[EocHandleArraysInline] + m_rgulpCounters[EocHandleArraysAllocated]
+	   << std::endl;
+
+	return os;
+}
+
+
 //---------------------------------------------------------------------------
 //	@function:
 //		COptCtxt::FAllEnforcersEnabled
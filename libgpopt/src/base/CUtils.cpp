@@ -17,6 +17,7 @@
 #include "gpos/task/CWorker.h"
 
 #include "gpopt/base/CColRefSetIter.h"
+#include "gpopt/base/CColRefUnionFind.h"
 #include "gpopt/base/CColRefTable.h"
 #include "gpopt/base/CConstraintInterval.h"
 #include "gpopt/base/CKeyCollection.h"
@@ -26,6 +27,7 @@
 #include "gpopt/base/CDistributionSpecRandom.h"
 #include "gpopt/operators/CPhysicalMotionRandom.h"
 #include "gpopt/operators/ops.h"
+#include "gpopt/operators/CExpressionInterner.h"
 #include "gpopt/operators/CLogicalCTEProducer.h"
 #include "gpopt/operators/CLogicalCTEConsumer.h"
 #include "gpopt/translate/CTranslatorExprToDXLUtils.h"
@@ -1457,6 +1459,25 @@ CUtils::PdrgpexprDedup
 	return pdrgpexprDedup;
 }
 
+// return the shared instance of a scalar expression from the optimizer
+// context's interning table
+CExpression *
+CUtils::PexprInternScalar
+	(
+	CExpression *pexpr
+	)
+{
+	GPOS_ASSERT(NULL != pexpr);
+
+	COptCtxt *poctxt = COptCtxt::PoctxtFromTLS();
+	if (NULL == poctxt || GPOS_FTRACE(EopttraceDisableScalarInterning))
+	{
+		return pexpr;
+	}
+
+	return poctxt->Pinterner()->PexprIntern(pexpr);
+}
+
 // deep equality of expression arrays
 BOOL
 CUtils::Equals
@@ -1514,6 +1535,12 @@ CUtils::Equals
 		return true;
 	}
 
+	// distinct interned instances are never equal
+	if (pexprLeft->FInterned() && pexprRight->FInterned())
+	{
+		return false;
+	}
+
 	// compare number of children and root operators
 	if (pexprLeft->Arity() != pexprRight->Arity() ||
 		!pexprLeft->Pop()->Matches(pexprRight->Pop())	)
@@ -2637,7 +2664,10 @@ CUtils::PdrgpcrsAddEquivClass
 	return pdrgpcrsNew;
 }
 
-// merge 2 arrays of equivalence classes
+// merge 2 arrays of equivalence classes; the result is the same as adding the
+// classes of the second array one by one using PdrgpcrsAddEquivClass, but is
+// computed by a union-find pass over the columns instead of a scan of the
+// merged classes per added class
 CColRefSetArray *
 CUtils::PdrgpcrsMergeEquivClasses
 	(
@@ -2646,20 +2676,19 @@ CUtils::PdrgpcrsMergeEquivClasses
 	CColRefSetArray *pdrgpcrsSnd
 	)
 {
-	pdrgpcrsFst->AddRef();
-	CColRefSetArray *pdrgpcrsMerged = pdrgpcrsFst;
-
-	const ULONG length = pdrgpcrsSnd->Size();
-	for (ULONG ul = 0; ul < length; ul++)
+	if (0 == pdrgpcrsSnd->Size())
 	{
-		CColRefSet *pcrs = (*pdrgpcrsSnd)[ul];
-		pcrs->AddRef();
-
-		CColRefSetArray *pdrgpcrs = PdrgpcrsAddEquivClass(mp, pcrs, pdrgpcrsMerged);
-		pdrgpcrsMerged->Release();
-		pdrgpcrsMerged = pdrgpcrs;
+		pdrgpcrsFst->AddRef();
+		return pdrgpcrsFst;
 	}
 
+	CColRefUnionFind *pcruf = GPOS_NEW(mp) CColRefUnionFind(mp);
+	pcruf->AddEquivClasses(pdrgpcrsFst);
+	pcruf->AddEquivClasses(pdrgpcrsSnd);
+
+	CColRefSetArray *pdrgpcrsMerged = pcruf->PdrgpcrsEquivClasses(mp);
+	pcruf->Release();
+
 	return pdrgpcrsMerged;
 }
 
@@ -2756,29 +2785,19 @@ CUtils::PdrgpcrsCopyChildEquivClasses
 	CExpressionHandle &exprhdl
 	)
 {
-	CColRefSetArray *pdrgpcrs = GPOS_NEW(mp) CColRefSetArray(mp);
+	CColRefUnionFind *pcruf = GPOS_NEW(mp) CColRefUnionFind(mp);
 	const ULONG arity = exprhdl.Arity();
 	for (ULONG ul = 0; ul < arity; ul++)
 	{
 		if (!exprhdl.FScalarChild(ul))
 		{
-			CColRefSetArray *pdrgpcrsChild = exprhdl.DerivePropertyConstraint(ul)->PdrgpcrsEquivClasses();
-
-			CColRefSetArray *pdrgpcrsChildCopy = GPOS_NEW(mp) CColRefSetArray(mp);
-			const ULONG size = pdrgpcrsChild->Size();
-			for (ULONG ulInner = 0; ulInner < size; ulInner++)
-			{
-				CColRefSet *pcrs = GPOS_NEW(mp) CColRefSet(mp, *(*pdrgpcrsChild)[ulInner]);
-				pdrgpcrsChildCopy->Append(pcrs);
-			}
-
-			CColRefSetArray *pdrgpcrsMerged = PdrgpcrsMergeEquivClasses(mp, pdrgpcrs, pdrgpcrsChildCopy);
-			pdrgpcrsChildCopy->Release();
-			pdrgpcrs->Release();
-			pdrgpcrs = pdrgpcrsMerged;
+			pcruf->AddEquivClasses(exprhdl.DerivePropertyConstraint(ul)->PdrgpcrsEquivClasses());
 		}
 	}
 
+	CColRefSetArray *pdrgpcrs = pcruf->PdrgpcrsEquivClasses(mp);
+	pcruf->Release();
+
 	return pdrgpcrs;
 }
 
@@ -620,15 +620,25 @@ CEngine::FSafeToPruneWithDPEStats
 		return true;
 	}
 
-	// first child has been optimized
+	// some children have been optimized
 	CExpressionHandle exprhdl(m_mp);
 	exprhdl.Attach(pgexpr);
-	ULONG ulNextChild = exprhdl.UlNextOptimizedChildIndex(child_index);
-	CDrvdPropRelational *pdprelChild = CDrvdPropRelational::GetRelationalProperties((*pgexpr)[ulNextChild]->Pdp());
-	if (0 < pdprelChild->GetPartitionInfo()->UlConsumers())
+	for (ULONG ulNextChild = exprhdl.UlNextOptimizedChildIndex(child_index);
+		 gpos::ulong_max != ulNextChild;
+		 ulNextChild = exprhdl.UlNextOptimizedChildIndex(ulNextChild))
 	{
-		// we cannot bound cost here because of possible DPE that can happen for the unoptimized child
-		return false;
+		CGroup *pgroupChild = (*pgexpr)[ulNextChild];
+		if (pgroupChild->FScalar())
+		{
+			continue;
+		}
+
+		CDrvdPropRelational *pdprelChild = CDrvdPropRelational::GetRelationalProperties(pgroupChild->Pdp());
+		if (0 < pdprelChild->GetPartitionInfo()->UlConsumers())
+		{
+			// we cannot bound cost here because of possible DPE that can happen for an unoptimized child
+			return false;
+		}
 	}
 
 	return true;
@@ -682,6 +692,7 @@ CEngine::FSafeToPrune
 		if (costLowerBound > pocGroup->PccBest()->Cost())
 		{
 			// group expression cannot deliver a better plan for given properties and can be safely pruned
+			COptCtxt::PoctxtFromTLS()->IncrementCounter(COptCtxt::EocCostContextsPruned);
 			return true;
 		}
 	}
@@ -1393,6 +1404,12 @@ CEngine::RecursiveOptimize()
 		atSearch.Os() << "[OPT]: Search terminated at stage " << m_ulCurrSearchStage << "/" << m_search_stage_array->Size();
 	}
 
+	if (GPOS_FTRACE(EopttracePrintOptimizationStatistics))
+	{
+		CAutoTrace at(m_mp);
+		(void) COptCtxt::PoctxtFromTLS()->OsPrintCounters(at.Os());
+	}
+
 	if (optimizer_config->GetEnumeratorCfg()->FSample())
 	{
 		SamplePlans();
@@ -1625,6 +1642,13 @@ CEngine::OsPrintMemoryConsumption
 		<< ", MD Cache: [" << (DOUBLE) (pcache->TotalAllocatedSize()) / GPOPT_MEM_UNIT << "] " << GPOPT_MEM_UNIT_NAME
 		<< ", Total: [" << (DOUBLE) (CMemoryPoolManager::GetMemoryPoolMgr()->TotalAllocatedSize()) / GPOPT_MEM_UNIT << "] " << GPOPT_MEM_UNIT_NAME;
 
+	const ULONG ulGrpExprs = m_pmemo->UlGrpExprs();
+	if (0 < ulGrpExprs)
+	{
+		// engine memory is dominated by the memo on large queries
+		os << ", Engine per group expression: [" << (DOUBLE) m_mp->TotalAllocatedSize() / ulGrpExprs << "] bytes";
+	}
+
 	return os;
 }
 
@@ -1750,8 +1774,13 @@ CEngine::Optimize()
 
 	if (GPOS_FTRACE(EopttracePrintOptimizationStatistics))
 	{
-		CAutoTrace atSearch(m_mp);
-		atSearch.Os() << "[OPT]: Search terminated at stage " << m_ulCurrSearchStage << "/" << m_search_stage_array->Size();
+		{
+			CAutoTrace atSearch(m_mp);
+			atSearch.Os() << "[OPT]: Search terminated at stage " << m_ulCurrSearchStage << "/" << m_search_stage_array->Size();
+		}
+
+		CAutoTrace at(m_mp);
+		(void) COptCtxt::PoctxtFromTLS()->OsPrintCounters(at.Os());
 	}
 
 
@@ -2100,7 +2129,8 @@ CEngine::FCheckEnfdProps
 		return false;
 	}
 
-	// load a handle with derived plan properties
+	// load a handle with plan properties derived on demand, properties
+	// that are not needed to reject the group expression are not derived
 	poc->AddRef();
 	pgexpr->AddRef();
 	pdrgpoc->AddRef();
@@ -2108,7 +2138,7 @@ CEngine::FCheckEnfdProps
 	pcc->SetChildContexts(pdrgpoc);
 	CExpressionHandle exprhdl(mp);
 	exprhdl.Attach(pcc);
-	exprhdl.DerivePlanPropsForCostContext();
+	exprhdl.DerivePlanPropsForCostContext(true /*fOnDemand*/);
 
 
 	CPhysical *popPhysical = CPhysical::PopConvert(exprhdl.Pop());
@@ -2191,9 +2221,16 @@ CEngine::FCheckEnfdProps
 	}
 	pdrgpexprEnforcers->Release();
 	pexpr->Release();
+
+	BOOL fOptimize = FOptimize(epetOrder, epetDistribution, epetRewindability, epetPartitionPropagation);
+	if (fOptimize)
+	{
+		// group expression will be costed under the same child plans
+		exprhdl.CompletePlanPropsForCostContext();
+	}
 	pcc->Release();
 	
-	return FOptimize(epetOrder, epetDistribution, epetRewindability, epetPartitionPropagation);
+	return fOptimize;
 }
 
 //---------------------------------------------------------------------------
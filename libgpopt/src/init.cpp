@@ -15,6 +15,7 @@
 
 #include "gpopt/init.h"
 #include "gpopt/mdcache/CMDCache.h"
+#include "gpopt/mdcache/CStatsCache.h"
 #include "gpopt/exception.h"
 #include "gpopt/xforms/CXformFactory.h"
 #include "gpos/_api.h"
@@ -68,6 +69,7 @@ void gpopt_terminate()
 {
 #ifdef GPOS_DEBUG
 	CMDCache::Shutdown();
+	CStatsCache::Shutdown();
 
 	CMemoryPoolManager::GetMemoryPoolMgr()->Destroy(mp);
 
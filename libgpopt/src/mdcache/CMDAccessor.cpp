@@ -22,6 +22,7 @@
 #include "gpopt/exception.h"
 #include "gpopt/mdcache/CMDAccessor.h"
 #include "gpopt/mdcache/CMDAccessorUtils.h"
+#include "gpopt/mdcache/CMDCache.h"
 
 
 #include "naucrates/exception.h"
@@ -273,7 +274,10 @@ CMDAccessor::CMDAccessor
 	m_mp(mp),
 	m_pcache(pcache),
 	m_dLookupTime(0.0),
-	m_dFetchTime(0.0)
+	m_dFetchTime(0.0),
+	m_ulHistogramsTranslated(0),
+	m_ulHistogramsReused(0),
+	m_ulBucketsReused(0)
 {
 	GPOS_ASSERT(NULL != m_mp);
 	GPOS_ASSERT(NULL != m_pcache);
@@ -302,7 +306,10 @@ CMDAccessor::CMDAccessor
 	m_mp(mp),
 	m_pcache(pcache),
 	m_dLookupTime(0.0),
-	m_dFetchTime(0.0)
+	m_dFetchTime(0.0),
+	m_ulHistogramsTranslated(0),
+	m_ulHistogramsReused(0),
+	m_ulBucketsReused(0)
 {
 	GPOS_ASSERT(NULL != m_mp);
 	GPOS_ASSERT(NULL != m_pcache);
@@ -334,7 +341,10 @@ CMDAccessor::CMDAccessor
 	m_mp(mp),
 	m_pcache(pcache),
 	m_dLookupTime(0.0),
-	m_dFetchTime(0.0)
+	m_dFetchTime(0.0),
+	m_ulHistogramsTranslated(0),
+	m_ulHistogramsReused(0),
+	m_ulBucketsReused(0)
 {
 	GPOS_ASSERT(NULL != m_mp);
 	GPOS_ASSERT(NULL != m_pcache);
@@ -424,6 +434,9 @@ CMDAccessor::InitHashtables
 		SMDProviderElem::HashValue,
 		SMDProviderElem::Equals
 		);
+
+	m_phmmdidimap = GPOS_NEW(mp) MdidToIndexApplicabilityMap(mp);
+	m_phmmdidbuckets = GPOS_NEW(mp) MdidToBucketArrayMap(mp);
 }
 
 //---------------------------------------------------------------------------
@@ -436,6 +449,11 @@ CMDAccessor::InitHashtables
 //---------------------------------------------------------------------------
 CMDAccessor::~CMDAccessor()
 {
+	// unpin histogram and index applicability map cache entries; keys are
+	// ids of pinned MD objects
+	m_phmmdidbuckets->Release();
+	m_phmmdidimap->Release();
+
 	// release cache accessors and MD providers in hashtables
 	m_shtCacheAccessors.DestroyEntries(DestroyAccessorElement);
 	m_shtProviders.DestroyEntries(DestroyProviderElement);
@@ -447,6 +465,9 @@ CMDAccessor::~CMDAccessor()
 		CAutoTrace at(m_mp);
 		at.Os() << "[OPT]: Total metadata fetch time: " << m_dFetchTime << "ms" << std::endl;
 		at.Os() << "[OPT]: Total metadata lookup time (including fetch time): " << m_dLookupTime << "ms" << std::endl;
+		at.Os() << "[OPT]: Column histograms translated: " << m_ulHistogramsTranslated
+				<< ", reused: " << m_ulHistogramsReused
+				<< " (" << m_ulBucketsReused << " bucket translations saved)" << std::endl;
 	}
 }
 
@@ -540,6 +561,198 @@ CMDAccessor::Pmdp
 
 
 
+//---------------------------------------------------------------------------
+//	@function:
+//		CMDAccessor::PimdobjParseAndCache
+//
+//	@doc:
+//		Parse the DXL of an object retrieved from an MD provider and add the
+//		object to the MD cache using the given cache accessor
+//
+//---------------------------------------------------------------------------
+IMDCacheObject *
+CMDAccessor::PimdobjParseAndCache
+	(
+	CacheAccessorMD *pmdcacc,
+	IMDId *mdid,
+	const CWStringBase *pstrDXL
+	)
+{
+	GPOS_ASSERT(NULL != pmdcacc);
+	GPOS_ASSERT(NULL != pstrDXL);
+
+	CMemoryPool *mp = m_mp;
+	
+	if (IMDId::EmdidGPDBCtas != mdid->MdidType())
+	{
+		// create the accessor memory pool
+		mp = pmdcacc->Pmp();
+	}
+
+	IMDCacheObject *pmdobjNew = gpdxl::CDXLUtils::ParseDXLToIMDIdCacheObj(mp, pstrDXL, NULL /* XSD path */);
+	GPOS_ASSERT(NULL != pmdobjNew);
+
+	// For CTAS mdid, we avoid adding the corresponding object to the MD cache
+	// since those objects have a fixed id, and if caching is enabled and those
+	// objects are cached, then a subsequent CTAS query will attempt to use
+	// the cached object, which has a different schema, resulting in a crash.
+	// so for such objects, we bypass the MD cache, getting them from the
+	// MD provider, directly to the local hash table
+
+	if (IMDId::EmdidGPDBCtas != mdid->MdidType())
+	{
+		// add to MD cache
+		CAutoP<CMDKey> a_pmdkeyCache;
+		// ref count of the new object is set to one and optimizer becomes its owner
+		a_pmdkeyCache = GPOS_NEW(mp) CMDKey(pmdobjNew->MDId());
+
+		// object gets pinned independent of whether insertion succeeded or
+		// failed because object was already in cache
+
+#ifdef GPOS_DEBUG
+		IMDCacheObject *pmdobjInserted =
+#endif
+		pmdcacc->Insert(a_pmdkeyCache.Value(), pmdobjNew);
+
+		GPOS_ASSERT(NULL != pmdobjInserted);
+
+		// safely inserted
+		(void) a_pmdkeyCache.Reset();
+	}
+
+	return pmdobjNew;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CMDAccessor::StoreInLocalHashtable
+//
+//	@doc:
+//		Store an object retrieved from the MD cache or an MD provider in the
+//		local hashtable, which takes over the caller's reference
+//
+//---------------------------------------------------------------------------
+void
+CMDAccessor::StoreInLocalHashtable
+	(
+	IMDCacheObject *pmdobj
+	)
+{
+	GPOS_ASSERT(NULL != pmdobj);
+	IMDId *pmdidNew = pmdobj->MDId();
+	pmdidNew->AddRef();
+
+	CAutoP<SMDAccessorElem> a_pmdaccelem;
+	a_pmdaccelem = GPOS_NEW(m_mp) SMDAccessorElem(pmdobj, pmdidNew);
+
+	MDHTAccessor mdhtacc(m_shtCacheAccessors, pmdidNew);
+
+	if (NULL == mdhtacc.Find())
+	{
+		// object has not been inserted in the meantime
+		mdhtacc.Insert(a_pmdaccelem.Value());
+
+		// add deletion lock for mdid
+		pmdidNew->AddDeletionLock();
+		a_pmdaccelem.Reset();
+	}
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CMDAccessor::PrefetchMDObjs
+//
+//	@doc:
+//		Make the given objects available in the local hashtable. Objects that
+//		are neither known to the accessor nor held in the MD cache are
+//		retrieved from their MD provider in a single call. All objects must
+//		come from the same source system
+//
+//---------------------------------------------------------------------------
+void
+CMDAccessor::PrefetchMDObjs
+	(
+	IMdIdArray *mdids
+	)
+{
+	GPOS_ASSERT(NULL != mdids);
+
+	const ULONG size = mdids->Size();
+	if (0 == size)
+	{
+		return;
+	}
+
+	BOOL fPrintOptStats = GPOS_FTRACE(EopttracePrintOptimizationStatistics);
+	IMDProvider *pmdp = Pmdp((*mdids)[0]->Sysid());
+	IMdIdArray *pdrgpmdidMissing = GPOS_NEW(m_mp) IMdIdArray(m_mp);
+	for (ULONG ul = 0; ul < size; ul++)
+	{
+		IMDId *mdid = (*mdids)[ul];
+		GPOS_ASSERT(pmdp == Pmdp(mdid->Sysid()));
+
+		{
+			// scope for ht accessor
+			MDHTAccessor mdhtacc(m_shtCacheAccessors, mdid);
+			if (NULL != mdhtacc.Find())
+			{
+				continue;
+			}
+		}
+
+		IMDCacheObject *pmdobj = pmdp->GetMDObj(m_mp, this, mdid);
+		if (NULL != pmdobj)
+		{
+			StoreInLocalHashtable(pmdobj);
+			continue;
+		}
+
+		CMDKey mdkey(mdid);
+		CacheAccessorMD mdcacc(m_pcache);
+		mdcacc.Lookup(&mdkey);
+		pmdobj = mdcacc.Val();
+		if (NULL != pmdobj)
+		{
+			StoreInLocalHashtable(pmdobj);
+			continue;
+		}
+
+		mdid->AddRef();
+		pdrgpmdidMissing->Append(mdid);
+	}
+
+	const ULONG ulMissing = pdrgpmdidMissing->Size();
+	if (0 < ulMissing)
+	{
+		CTimerUser timerFetch;
+		if (fPrintOptStats)
+		{
+			timerFetch.Restart();
+		}
+
+		CAutoRef<StringPtrArray> a_pdrgpstr;
+		a_pdrgpstr = pmdp->GetMDObjDXLStrArray(m_mp, this, pdrgpmdidMissing);
+		GPOS_ASSERT(ulMissing == a_pdrgpstr->Size());
+
+		for (ULONG ul = 0; ul < ulMissing; ul++)
+		{
+			IMDId *mdid = (*pdrgpmdidMissing)[ul];
+			CacheAccessorMD mdcacc(m_pcache);
+			IMDCacheObject *pmdobj = PimdobjParseAndCache(&mdcacc, mdid, (*a_pdrgpstr.Value())[ul]);
+			StoreInLocalHashtable(pmdobj);
+		}
+
+		if (fPrintOptStats)
+		{
+			// add fetch time in msec
+			CDouble dFetch(timerFetch.ElapsedUS() / CDouble(GPOS_USEC_IN_MSEC));
+			m_dFetchTime = CDouble(m_dFetchTime.Get() + dFetch.Get());
+		}
+	}
+
+	pdrgpmdidMissing->Release();
+}
+
 //---------------------------------------------------------------------------
 //	@function:
 //		CMDAccessor::GetImdObj
@@ -586,9 +799,33 @@ CMDAccessor::GetImdObj
 		CMDKey mdkey(mdid);
 				
 		CAutoP<CacheAccessorMD> a_pmdcacc;
-		a_pmdcacc = GPOS_NEW(m_mp) CacheAccessorMD(m_pcache);
-		a_pmdcacc->Lookup(&mdkey);
-		IMDCacheObject *pmdobjNew = a_pmdcacc->Val();
+		IMDCacheObject *pmdobjNew = NULL;
+
+		// providers that keep parsed objects hand them over directly; such
+		// objects are owned by the provider and bypass the MD cache, which
+		// outlives the provider
+		CTimerUser timerHandoff;
+		if (fPrintOptStats)
+		{
+			timerHandoff.Restart();
+		}
+		pmdobjNew = pmdp->GetMDObj(m_mp, this, mdid);
+		if (NULL != pmdobjNew)
+		{
+			if (fPrintOptStats)
+			{
+				// add fetch time in msec
+				CDouble dFetch(timerHandoff.ElapsedUS() / CDouble(GPOS_USEC_IN_MSEC));
+				m_dFetchTime = CDouble(m_dFetchTime.Get() + dFetch.Get());
+			}
+		}
+		else
+		{
+			a_pmdcacc = GPOS_NEW(m_mp) CacheAccessorMD(m_pcache);
+			a_pmdcacc->Lookup(&mdkey);
+			pmdobjNew = a_pmdcacc->Val();
+		}
+
 		if (NULL == pmdobjNew)
 		{
 			// object not found in MD cache: retrieve it from MD provider
@@ -601,16 +838,7 @@ CMDAccessor::GetImdObj
 			a_pstr = pmdp->GetMDObjDXLStr(m_mp, this, mdid);
 			
 			GPOS_ASSERT(NULL != a_pstr.Value());
-			CMemoryPool *mp = m_mp;
-			
-			if (IMDId::EmdidGPDBCtas != mdid->MdidType())
-			{
-				// create the accessor memory pool
-				mp = a_pmdcacc->Pmp();
-			}
-
-			pmdobjNew = gpdxl::CDXLUtils::ParseDXLToIMDIdCacheObj(mp, a_pstr.Value(), NULL /* XSD path */);
-			GPOS_ASSERT(NULL != pmdobjNew);
+			pmdobjNew = PimdobjParseAndCache(a_pmdcacc.Value(), mdid, a_pstr.Value());
 
 			if (fPrintOptStats)
 			{
@@ -618,57 +846,9 @@ CMDAccessor::GetImdObj
 				CDouble dFetch(timerFetch.ElapsedUS() / CDouble(GPOS_USEC_IN_MSEC));
 				m_dFetchTime = CDouble(m_dFetchTime.Get() + dFetch.Get());
 			}
-
-			// For CTAS mdid, we avoid adding the corresponding object to the MD cache
-			// since those objects have a fixed id, and if caching is enabled and those
-			// objects are cached, then a subsequent CTAS query will attempt to use
-			// the cached object, which has a different schema, resulting in a crash.
-			// so for such objects, we bypass the MD cache, getting them from the
-			// MD provider, directly to the local hash table
-
-			if (IMDId::EmdidGPDBCtas != mdid->MdidType())
-			{
-				// add to MD cache
-				CAutoP<CMDKey> a_pmdkeyCache;
-				// ref count of the new object is set to one and optimizer becomes its owner
-				a_pmdkeyCache = GPOS_NEW(mp) CMDKey(pmdobjNew->MDId());
-
-				// object gets pinned independent of whether insertion succeeded or
-				// failed because object was already in cache
-
-#ifdef GPOS_DEBUG
-				IMDCacheObject *pmdobjInserted =
-#endif
-				a_pmdcacc->Insert(a_pmdkeyCache.Value(), pmdobjNew);
-
-				GPOS_ASSERT(NULL != pmdobjInserted);
-
-				// safely inserted
-				(void) a_pmdkeyCache.Reset();
-			}
 		}
 
-		{
-			// store in local hashtable
-			GPOS_ASSERT(NULL != pmdobjNew);
-			IMDId *pmdidNew = pmdobjNew->MDId();
-			pmdidNew->AddRef();
-
-			CAutoP<SMDAccessorElem> a_pmdaccelem;
-			a_pmdaccelem = GPOS_NEW(m_mp) SMDAccessorElem(pmdobjNew, pmdidNew);
-
-			MDHTAccessor mdhtacc(m_shtCacheAccessors, pmdidNew);
-
-			if (NULL == mdhtacc.Find())
-			{
-				// object has not been inserted in the meantime
-				mdhtacc.Insert(a_pmdaccelem.Value());
-
-				// add deletion lock for mdid
-				pmdidNew->AddDeletionLock();
-				a_pmdaccelem.Reset();
-			}
-		}
+		StoreInLocalHashtable(pmdobjNew);
 	}
 	
 	// requested object must be in local hashtable already: retrieve it
@@ -971,6 +1151,131 @@ CMDAccessor::RetrieveCheckConstraints
 	return dynamic_cast<const IMDCheckConstraint*>(pmdobj);
 }
 
+//---------------------------------------------------------------------------
+//	@function:
+//		CMDAccessor::RetrieveIndexApplicabilityMap
+//
+//	@doc:
+//		Return the map of the partition ranges of the given relation to its
+//		indexes. The map only depends on the metadata of the relation and of
+//		its indexes, so it is built once per relation version and kept in
+//		the index applicability map cache of the metadata cache, where it is
+//		shared by all alternatives and queries looking at the relation.
+//		The accessor holds the maps it used until it is destroyed, which
+//		keeps their cache entries from being evicted during the query
+//
+//---------------------------------------------------------------------------
+const CMDIndexApplicabilityMap *
+CMDAccessor::RetrieveIndexApplicabilityMap
+	(
+	const IMDRelation *pmdrel
+	)
+{
+	GPOS_ASSERT(NULL != pmdrel);
+
+	IMDId *rel_mdid = pmdrel->MDId();
+	CMDIndexApplicabilityMap *md_index_map = m_phmmdidimap->Find(rel_mdid);
+	if (NULL != md_index_map)
+	{
+		return md_index_map;
+	}
+
+	// objects of CTAS relations bypass the MD cache, see PimdobjParseAndCache
+	IndexApplicabilityMapCache *pcache = CMDCache::PcacheIndexApplicabilityMaps();
+	if (NULL == pcache || IMDId::EmdidGPDBCtas == rel_mdid->MdidType())
+	{
+		md_index_map = PimapBuild(m_mp, pmdrel);
+	}
+	else
+	{
+		md_index_map = PimapCached(pcache, pmdrel);
+	}
+
+	rel_mdid->AddRef();
+#ifdef GPOS_DEBUG
+	BOOL fInserted =
+#endif // GPOS_DEBUG
+	m_phmmdidimap->Insert(rel_mdid, md_index_map);
+	GPOS_ASSERT(fInserted);
+
+	return md_index_map;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CMDAccessor::PimapCached
+//
+//	@doc:
+//		Retrieve the index applicability map of the given relation from the
+//		given cache, building it into a new cache entry if it is missing;
+//		the returned reference pins the cache entry
+//
+//---------------------------------------------------------------------------
+CMDIndexApplicabilityMap *
+CMDAccessor::PimapCached
+	(
+	IndexApplicabilityMapCache *pcache,
+	const IMDRelation *pmdrel
+	)
+{
+	CMDKey mdkey(pmdrel->MDId());
+
+	CacheAccessorIndexApplicabilityMap imapcacc(pcache);
+	imapcacc.Lookup(&mdkey);
+	CMDIndexApplicabilityMap *md_index_map = imapcacc.Val();
+	if (NULL != md_index_map)
+	{
+		md_index_map->AddRef();
+		return md_index_map;
+	}
+
+	// the entry is fully built before insertion, when the cache accounts
+	// for the size of its memory pool; its key does not reference the
+	// memory of the relation object, which may be evicted first
+	CMemoryPool *mp = imapcacc.Pmp();
+	CMDIndexApplicabilityMap *md_index_map_new = PimapBuild(mp, pmdrel);
+	CMDIdGPDB *pmdidKey = GPOS_NEW(mp) CMDIdGPDB(*CMDIdGPDB::CastMdid(pmdrel->MDId()));
+
+	// the reference of the new map goes to the caller; if an equal entry
+	// was inserted in the meantime, the new map is discarded together with
+	// the accessor's memory pool
+	md_index_map = imapcacc.Insert(GPOS_NEW(mp) CMDKey(pmdidKey), md_index_map_new);
+	if (md_index_map != md_index_map_new)
+	{
+		md_index_map->AddRef();
+	}
+
+	return md_index_map;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CMDAccessor::PimapBuild
+//
+//	@doc:
+//		Build the index applicability map of the given relation in the
+//		given memory pool
+//
+//---------------------------------------------------------------------------
+CMDIndexApplicabilityMap *
+CMDAccessor::PimapBuild
+	(
+	CMemoryPool *mp,
+	const IMDRelation *pmdrel
+	)
+{
+	CMDIndexApplicabilityMap *md_index_map = GPOS_NEW(mp) CMDIndexApplicabilityMap(mp);
+	const ULONG ulIndexes = pmdrel->IndexCount();
+	for (ULONG ul = 0; ul < ulIndexes; ul++)
+	{
+		IMDId *pmdidIndex = pmdrel->IndexMDidAt(ul);
+		const IMDIndex *pmdindex = RetrieveIndex(pmdidIndex);
+		md_index_map->AddIndex(pmdrel->IsPartialIndex(pmdidIndex), pmdindex->MDPartConstraint());
+	}
+
+	return md_index_map;
+}
+
 //---------------------------------------------------------------------------
 //	@function:
 //		CMDAccessor::Pmdcolstats
@@ -1198,6 +1503,20 @@ CMDAccessor::Pstats
 	BOOL fEmptyTable = pmdRelStats->IsEmpty();
 	const IMDRelation *pmdrel = RetrieveRel(rel_mdid);
 
+	// retrieve the column stats objects of all requested columns at once
+	IMdIdArray *pdrgpmdidColStats = GPOS_NEW(mp) IMdIdArray(mp, pcrsHist->Size());
+	CColRefSetIter crsiColStats(*pcrsHist);
+	while (crsiColStats.Advance())
+	{
+		CColRefTable *pcrtable = CColRefTable::PcrConvert(crsiColStats.Pcr());
+		ULONG ulPos = pmdrel->GetPosFromAttno(pcrtable->AttrNum());
+
+		rel_mdid->AddRef();
+		pdrgpmdidColStats->Append(GPOS_NEW(mp) CMDIdColStats(CMDIdGPDB::CastMdid(rel_mdid), ulPos));
+	}
+	PrefetchMDObjs(pdrgpmdidColStats);
+	pdrgpmdidColStats->Release();
+
 	UlongToHistogramMap *col_histogram_mapping = GPOS_NEW(mp) UlongToHistogramMap(mp);
 	UlongToDoubleMap *colid_width_mapping = GPOS_NEW(mp) UlongToDoubleMap(mp);
 
@@ -1280,22 +1599,19 @@ CMDAccessor::GetHistogram
 	GPOS_ASSERT(NULL != pmdcolstats);
 
 	BOOL is_col_stats_missing = pmdcolstats->IsColStatsMissing();
-	const ULONG num_of_buckets = pmdcolstats->Buckets();
 	BOOL fBoolType = CMDAccessorUtils::FBoolType(this, mdid_type);
 	if (is_col_stats_missing && fBoolType)
 	{
-		GPOS_ASSERT(0 == num_of_buckets);
+		GPOS_ASSERT(0 == pmdcolstats->Buckets());
 
 		return CHistogram::MakeDefaultBoolHistogram(mp);
 	}
 
-	CBucketArray *buckets = GPOS_NEW(mp) CBucketArray(mp);
-	for (ULONG ul = 0; ul < num_of_buckets; ul++)
-	{
-		const CDXLBucket *dxl_bucket = pmdcolstats->GetDXLBucketAt(ul);
-		CBucket *bucket = Pbucket(mp, mdid_type, dxl_bucket);
-		buckets->Append(bucket);
-	}
+	// buckets are shared with other histograms built from the same column
+	// stats; histograms copy them before modifying any bucket
+	CBucketArray *buckets = PdrgpbucketTranslated(mdid_type, pmdcolstats);
+	GPOS_ASSERT(pmdcolstats->Buckets() == buckets->Size());
+	buckets->AddRef();
 
 	CDouble null_freq = pmdcolstats->GetNullFreq();
 	CDouble distinct_remaining = pmdcolstats->GetDistinctRemain();
@@ -1316,6 +1632,147 @@ CMDAccessor::GetHistogram
 	return histogram;
 }
 
+//---------------------------------------------------------------------------
+//	@function:
+//		CMDAccessor::PdrgpbucketTranslated
+//
+//	@doc:
+//		Return the histogram buckets of the given MD column stats object.
+//		Buckets are translated once per column stats object and kept in the
+//		histogram cache of the metadata cache, so that they are shared by
+//		all histograms built from the object, within and across queries.
+//		The accessor holds the buckets it used until it is destroyed, which
+//		keeps their cache entries from being evicted during the query
+//
+//---------------------------------------------------------------------------
+CBucketArray *
+CMDAccessor::PdrgpbucketTranslated
+	(
+	IMDId *mdid_type,
+	const IMDColStats *pmdcolstats
+	)
+{
+	IMDId *mdid_col_stats = pmdcolstats->MDId();
+
+	CBucketArray *buckets = m_phmmdidbuckets->Find(mdid_col_stats);
+	if (NULL != buckets)
+	{
+		m_ulHistogramsReused++;
+		m_ulBucketsReused += buckets->Size();
+
+		return buckets;
+	}
+
+	// objects of CTAS relations bypass the MD cache, see PimdobjParseAndCache
+	HistogramCache *pcache = CMDCache::PcacheHistograms();
+	IMDId *rel_mdid = CMDIdColStats::CastMdid(mdid_col_stats)->GetRelMdId();
+	if (NULL == pcache || IMDId::EmdidGPDBCtas == rel_mdid->MdidType())
+	{
+		buckets = PdrgpbucketTranslate(m_mp, mdid_type, pmdcolstats);
+		m_ulHistogramsTranslated++;
+	}
+	else
+	{
+		buckets = PdrgpbucketCached(pcache, mdid_type, pmdcolstats);
+	}
+
+	mdid_col_stats->AddRef();
+#ifdef GPOS_DEBUG
+	BOOL fInserted =
+#endif // GPOS_DEBUG
+	m_phmmdidbuckets->Insert(mdid_col_stats, buckets);
+	GPOS_ASSERT(fInserted);
+
+	return buckets;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CMDAccessor::PdrgpbucketCached
+//
+//	@doc:
+//		Retrieve the translated histogram buckets of the given MD column
+//		stats object from the histogram cache, translating them into a new
+//		cache entry if they are missing; the returned reference pins the
+//		cache entry
+//
+//---------------------------------------------------------------------------
+CBucketArray *
+CMDAccessor::PdrgpbucketCached
+	(
+	HistogramCache *pcache,
+	IMDId *mdid_type,
+	const IMDColStats *pmdcolstats
+	)
+{
+	CMDIdColStats *mdid_col_stats = CMDIdColStats::CastMdid(pmdcolstats->MDId());
+	CMDKey mdkey(mdid_col_stats);
+
+	CacheAccessorHistogram histcacc(pcache);
+	histcacc.Lookup(&mdkey);
+	CBucketArray *buckets = histcacc.Val();
+	if (NULL != buckets)
+	{
+		m_ulHistogramsReused++;
+		m_ulBucketsReused += buckets->Size();
+
+		buckets->AddRef();
+		return buckets;
+	}
+
+	// the entry is fully built before insertion, when the cache accounts
+	// for the size of its memory pool; its key does not reference the
+	// memory of the column stats object, which may be evicted first
+	CMemoryPool *mp = histcacc.Pmp();
+	CBucketArray *pdrgpbucketNew = PdrgpbucketTranslate(mp, mdid_type, pmdcolstats);
+	CMDIdColStats *pmdidKey = GPOS_NEW(mp) CMDIdColStats
+									(
+									GPOS_NEW(mp) CMDIdGPDB(*CMDIdGPDB::CastMdid(mdid_col_stats->GetRelMdId())),
+									mdid_col_stats->Position()
+									);
+	m_ulHistogramsTranslated++;
+
+	// the reference of the new buckets goes to the caller; if an equal
+	// entry was inserted in the meantime, the new buckets are discarded
+	// together with the accessor's memory pool
+	buckets = histcacc.Insert(GPOS_NEW(mp) CMDKey(pmdidKey), pdrgpbucketNew);
+	if (buckets != pdrgpbucketNew)
+	{
+		buckets->AddRef();
+	}
+
+	return buckets;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CMDAccessor::PdrgpbucketTranslate
+//
+//	@doc:
+//		Translate the DXL buckets of the given MD column stats object into
+//		histogram buckets allocated in the given memory pool
+//
+//---------------------------------------------------------------------------
+CBucketArray *
+CMDAccessor::PdrgpbucketTranslate
+	(
+	CMemoryPool *mp,
+	IMDId *mdid_type,
+	const IMDColStats *pmdcolstats
+	)
+{
+	const ULONG num_of_buckets = pmdcolstats->Buckets();
+	CBucketArray *buckets = GPOS_NEW(mp) CBucketArray(mp, num_of_buckets);
+	for (ULONG ul = 0; ul < num_of_buckets; ul++)
+	{
+		const CDXLBucket *dxl_bucket = pmdcolstats->GetDXLBucketAt(ul);
+		CBucket *bucket = Pbucket(mp, mdid_type, dxl_bucket);
+		buckets->Append(bucket);
+	}
+
+	return buckets;
+}
+
 //---------------------------------------------------------------------------
 //	@function:
 //		CMDAccessor::Pbucket
@@ -21,6 +21,12 @@ using namespace gpopt;
 // global instance of metadata cache
 CMDAccessor::MDCache *CMDCache::m_pcache = NULL;
 
+// global instance of the cache of translated histogram buckets
+CMDAccessor::HistogramCache *CMDCache::m_pcacheHistograms = NULL;
+
+// global instance of the cache of index applicability maps
+CMDAccessor::IndexApplicabilityMapCache *CMDCache::m_pcacheIndexApplicabilityMaps = NULL;
+
 // maximum size of the cache
 ULLONG CMDCache::m_ullCacheQuota = UNLIMITED_CACHE_QUOTA;
 
@@ -44,6 +50,22 @@ CMDCache::Init()
 					CMDKey::UlHashMDKey,
 					CMDKey::FEqualMDKey
 					);
+
+	m_pcacheHistograms = CCacheFactory::CreateCache<CBucketArray*, CMDKey*>
+					(
+					true /*fUnique*/,
+					m_ullCacheQuota,
+					CMDKey::UlHashMDKey,
+					CMDKey::FEqualMDKey
+					);
+
+	m_pcacheIndexApplicabilityMaps = CCacheFactory::CreateCache<CMDIndexApplicabilityMap*, CMDKey*>
+					(
+					true /*fUnique*/,
+					m_ullCacheQuota,
+					CMDKey::UlHashMDKey,
+					CMDKey::FEqualMDKey
+					);
 }
 
 
@@ -58,6 +80,12 @@ CMDCache::Init()
 void
 CMDCache::Shutdown()
 {
+	GPOS_DELETE(m_pcacheIndexApplicabilityMaps);
+	m_pcacheIndexApplicabilityMaps = NULL;
+
+	GPOS_DELETE(m_pcacheHistograms);
+	m_pcacheHistograms = NULL;
+
 	GPOS_DELETE(m_pcache);
 	m_pcache = NULL;
 }
@@ -77,6 +105,8 @@ CMDCache::SetCacheQuota(ULLONG ullCacheQuota)
 	GPOS_ASSERT(NULL != m_pcache && "Metadata cache was not created");
 	m_ullCacheQuota = ullCacheQuota;
 	m_pcache->SetCacheQuota(ullCacheQuota);
+	m_pcacheHistograms->SetCacheQuota(ullCacheQuota);
+	m_pcacheIndexApplicabilityMaps->SetCacheQuota(ullCacheQuota);
 }
 
 //---------------------------------------------------------------------------
@@ -109,7 +139,9 @@ CMDCache::ULLGetCacheEvictionCounter()
 	// make sure that we already initialized our underlying CCache
 	GPOS_ASSERT(NULL != m_pcache);
 
-	return m_pcache->GetEvictionCounter();
+	return m_pcache->GetEvictionCounter() +
+			m_pcacheHistograms->GetEvictionCounter() +
+			m_pcacheIndexApplicabilityMaps->GetEvictionCounter();
 }
 
 //---------------------------------------------------------------------------
@@ -0,0 +1,527 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (C) 2020 VMware, Inc. or its affiliates.
+//
+//	@filename:
+//		CStatsCache.cpp
+//
+//	@doc:
+//		 Function implementation of CStatsCache
+//---------------------------------------------------------------------------
+
+#include "gpos/common/CBitSetIter.h"
+#include "gpos/io/COstreamString.h"
+#include "gpos/memory/CCacheFactory.h"
+#include "gpos/task/CAutoTraceFlag.h"
+
+#include "gpopt/base/COptCtxt.h"
+#include "gpopt/engine/CStatisticsConfig.h"
+#include "gpopt/mdcache/CStatsCache.h"
+#include "gpopt/metadata/CTableDescriptor.h"
+#include "gpopt/operators/CExpression.h"
+#include "gpopt/operators/CExpressionHandle.h"
+#include "gpopt/operators/CLogicalGet.h"
+#include "gpopt/search/CGroupProxy.h"
+
+#include "naucrates/dxl/xml/CXMLSerializer.h"
+#include "naucrates/dxl/xml/dxltokens.h"
+#include "naucrates/statistics/CFilterStatsProcessor.h"
+#include "naucrates/statistics/CStatsPredConj.h"
+#include "naucrates/statistics/CStatsPredDisj.h"
+#include "naucrates/statistics/CStatsPredLike.h"
+#include "naucrates/statistics/CStatsPredPoint.h"
+#include "naucrates/statistics/CStatsPredUnsupported.h"
+#include "naucrates/statistics/CStatsPredUtils.h"
+#include "naucrates/traceflags/traceflags.h"
+
+using namespace gpos;
+using namespace gpdxl;
+using namespace gpopt;
+
+
+// global instance of statistics cache
+CStatsCache::StatsCache *CStatsCache::m_pcache = NULL;
+
+// maximum size of the cache
+ULLONG CStatsCache::m_ullCacheQuota = UNLIMITED_CACHE_QUOTA;
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CStatsCache::Init
+//
+//	@doc:
+//		Initializes global instance
+//
+//---------------------------------------------------------------------------
+void
+CStatsCache::Init()
+{
+	GPOS_ASSERT(NULL == m_pcache && "Statistics cache was already created");
+
+	m_pcache = CCacheFactory::CreateCache<CStatsCacheEntry*, CStatsCacheKey*>
+					(
+					true /*fUnique*/,
+					m_ullCacheQuota,
+					CStatsCacheKey::UlHashKey,
+					CStatsCacheKey::FEqualKey
+					);
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CStatsCache::Shutdown
+//
+//	@doc:
+//		Cleans up the underlying cache
+//
+//---------------------------------------------------------------------------
+void
+CStatsCache::Shutdown()
+{
+	GPOS_DELETE(m_pcache);
+	m_pcache = NULL;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CStatsCache::SetCacheQuota
+//
+//	@doc:
+//		Set the maximum size of the cache
+//
+//---------------------------------------------------------------------------
+void
+CStatsCache::SetCacheQuota(ULLONG ullCacheQuota)
+{
+	GPOS_ASSERT(NULL != m_pcache && "Statistics cache was not created");
+	m_ullCacheQuota = ullCacheQuota;
+	m_pcache->SetCacheQuota(ullCacheQuota);
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CStatsCache::ULLGetCacheQuota
+//
+//	@doc:
+//		Get the maximum size of the cache
+//
+//---------------------------------------------------------------------------
+ULLONG
+CStatsCache::ULLGetCacheQuota()
+{
+	GPOS_ASSERT_IMP(NULL != m_pcache, m_pcache->GetCacheQuota() == m_ullCacheQuota);
+	return m_ullCacheQuota;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CStatsCache::Reset
+//
+//	@doc:
+//		Reset statistics cache
+//
+//---------------------------------------------------------------------------
+void
+CStatsCache::Reset()
+{
+	CAutoTraceFlag atf1(EtraceSimulateOOM, false);
+	CAutoTraceFlag atf2(EtraceSimulateAbort, false);
+	CAutoTraceFlag atf3(EtraceSimulateIOError, false);
+	CAutoTraceFlag atf4(EtraceSimulateNetError, false);
+
+	Shutdown();
+	Init();
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CStatsCache::PopGetChild
+//
+//	@doc:
+//		Return the base table get below the filter in the given handle, or
+//		NULL if the child is not a get
+//
+//---------------------------------------------------------------------------
+CLogicalGet *
+CStatsCache::PopGetChild
+	(
+	CExpressionHandle &exprhdl
+	)
+{
+	COperator *pop = NULL;
+	if (NULL != exprhdl.Pexpr())
+	{
+		pop = (*exprhdl.Pexpr())[0]->Pop();
+	}
+	else if (NULL != exprhdl.Pgexpr())
+	{
+		CGroupProxy gp((*exprhdl.Pgexpr())[0]);
+		pop = gp.PgexprFirst()->Pop();
+	}
+
+	if (NULL == pop || COperator::EopLogicalGet != pop->Eopid())
+	{
+		return NULL;
+	}
+
+	return CLogicalGet::PopConvert(pop);
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CStatsCache::AppendDouble
+//
+//	@doc:
+//		Append the bits of a double to the key, so that equal keys denote
+//		identical values
+//
+//---------------------------------------------------------------------------
+void
+CStatsCache::AppendDouble
+	(
+	CWStringDynamic *pstr,
+	CDouble d
+	)
+{
+	DOUBLE dValue = d.Get();
+	ULLONG ullBits = 0;
+	(void) clib::Memcpy(&ullBits, &dValue, sizeof(ullBits));
+
+	pstr->AppendFormat(GPOS_WSZ_LIT("%llx;"), ullBits);
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CStatsCache::FAppendPos
+//
+//	@doc:
+//		Append the position of a column to the key, return false if the
+//		column does not belong to the relation
+//
+//---------------------------------------------------------------------------
+BOOL
+CStatsCache::FAppendPos
+	(
+	CWStringDynamic *pstr,
+	const UlongToUlongMap *phmulpos,
+	ULONG colid
+	)
+{
+	const ULONG *pulPos = phmulpos->Find(&colid);
+	if (NULL == pulPos)
+	{
+		return false;
+	}
+
+	pstr->AppendFormat(GPOS_WSZ_LIT("%d;"), *pulPos);
+	return true;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CStatsCache::FAppendPred
+//
+//	@doc:
+//		Append the normalized predicate to the key: column ids are replaced
+//		by positions, constants are serialized as DXL datums and scale
+//		factors by their bits. Return false if the predicate cannot be
+//		normalized
+//
+//---------------------------------------------------------------------------
+BOOL
+CStatsCache::FAppendPred
+	(
+	CMemoryPool *mp,
+	CWStringDynamic *pstr,
+	const UlongToUlongMap *phmulpos,
+	CStatsPred *pred_stats
+	)
+{
+	switch (pred_stats->GetPredStatsType())
+	{
+		case CStatsPred::EsptPoint:
+		{
+			CStatsPredPoint *pred_stats_point = CStatsPredPoint::ConvertPredStats(pred_stats);
+			pstr->AppendFormat(GPOS_WSZ_LIT("P%d("), pred_stats_point->GetCmpType());
+			if (!FAppendPos(pstr, phmulpos, pred_stats_point->GetColId()))
+			{
+				return false;
+			}
+
+			CMDAccessor *md_accessor = COptCtxt::PoctxtFromTLS()->Pmda();
+			CDXLDatum *dxl_datum = pred_stats_point->GetPredPoint()->GetDatumVal(mp, md_accessor);
+			{
+				COstreamString oss(pstr);
+				CXMLSerializer xml_serializer(mp, oss, false /*indentation*/);
+				dxl_datum->Serialize(&xml_serializer, CDXLTokens::GetDXLTokenStr(EdxltokenDatum));
+			}
+			dxl_datum->Release();
+			break;
+		}
+
+		case CStatsPred::EsptConj:
+		case CStatsPred::EsptDisj:
+		{
+			CStatsPredPtrArry *pdrgpstatspred = NULL;
+			if (CStatsPred::EsptConj == pred_stats->GetPredStatsType())
+			{
+				pstr->AppendWideCharArray(GPOS_WSZ_LIT("C("));
+				pdrgpstatspred = CStatsPredConj::ConvertPredStats(pred_stats)->GetConjPredStatsArray();
+			}
+			else
+			{
+				// IN lists are estimated differently from other disjunctions
+				CStatsPredDisj *pred_stats_disj = CStatsPredDisj::ConvertPredStats(pred_stats);
+				pstr->AppendWideCharArray(pred_stats_disj->IsArrayCmp() ? GPOS_WSZ_LIT("A(") : GPOS_WSZ_LIT("D("));
+				pdrgpstatspred = pred_stats_disj->GetDisjPredStatsArray();
+			}
+
+			const ULONG ulPreds = pdrgpstatspred->Size();
+			for (ULONG ul = 0; ul < ulPreds; ul++)
+			{
+				if (!FAppendPred(mp, pstr, phmulpos, (*pdrgpstatspred)[ul]))
+				{
+					return false;
+				}
+			}
+			break;
+		}
+
+		case CStatsPred::EsptLike:
+		{
+			CStatsPredLike *pred_stats_like = CStatsPredLike::ConvertPredStats(pred_stats);
+			pstr->AppendWideCharArray(GPOS_WSZ_LIT("L("));
+			if (!FAppendPos(pstr, phmulpos, pred_stats_like->GetColId()))
+			{
+				return false;
+			}
+			AppendDouble(pstr, pred_stats_like->DefaultScaleFactor());
+			break;
+		}
+
+		case CStatsPred::EsptUnsupported:
+		{
+			CStatsPredUnsupported *pred_stats_unsupported = CStatsPredUnsupported::ConvertPredStats(pred_stats);
+			pstr->AppendFormat(GPOS_WSZ_LIT("U%d("), pred_stats_unsupported->GetStatsCmpType());
+			if (gpos::ulong_max == pred_stats_unsupported->GetColId())
+			{
+				pstr->AppendWideCharArray(GPOS_WSZ_LIT("*;"));
+			}
+			else if (!FAppendPos(pstr, phmulpos, pred_stats_unsupported->GetColId()))
+			{
+				return false;
+			}
+			AppendDouble(pstr, pred_stats_unsupported->ScaleFactor());
+			break;
+		}
+
+		default:
+			return false;
+	}
+
+	pstr->AppendWideCharArray(GPOS_WSZ_LIT(")"));
+	return true;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CStatsCache::PstrKey
+//
+//	@doc:
+//		Normalized description of a filter derivation over a base table: the
+//		relation mdid and version, the statistics configuration, the
+//		positions of the columns in the input statistics, and the filter.
+//		Returns NULL if the derivation cannot be normalized
+//
+//---------------------------------------------------------------------------
+CWStringDynamic *
+CStatsCache::PstrKey
+	(
+	CMemoryPool *mp,
+	CLogicalGet *popGet,
+	const UlongToUlongMap *phmulpos,
+	CStatistics *child_stats,
+	CStatsPred *pred_stats,
+	BOOL do_cap_NDVs
+	)
+{
+	CWStringDynamic *pstr = GPOS_NEW(mp) CWStringDynamic(mp);
+	pstr->AppendFormat
+			(
+			GPOS_WSZ_LIT("rel:%ls;cap:%d;damp:"),
+			popGet->Ptabdesc()->MDId()->GetBuffer(),
+			do_cap_NDVs
+			);
+
+	CStatisticsConfig *stats_config = child_stats->GetStatsConfig();
+	AppendDouble(pstr, stats_config->DDampingFactorFilter());
+	AppendDouble(pstr, stats_config->DDampingFactorJoin());
+	AppendDouble(pstr, stats_config->DDampingFactorGroupBy());
+
+	// positions of the columns with histograms and widths, in ascending order
+	CBitSet *pbsHist = GPOS_NEW(mp) CBitSet(mp);
+	CBitSet *pbsWidth = GPOS_NEW(mp) CBitSet(mp);
+	BOOL fMapped = true;
+
+	ULongPtrArray *colids = child_stats->GetColIdsWithStats(mp);
+	const ULONG ulHistograms = colids->Size();
+	for (ULONG ul = 0; fMapped && ul < ulHistograms; ul++)
+	{
+		const ULONG *pulPos = phmulpos->Find((*colids)[ul]);
+		fMapped = (NULL != pulPos);
+		if (fMapped)
+		{
+			(void) pbsHist->ExchangeSet(*pulPos);
+		}
+	}
+	colids->Release();
+
+	UlongToDoubleMap *phmuldWidth = child_stats->CopyWidths(mp);
+	UlongToDoubleMapIter hmuldi(phmuldWidth);
+	while (fMapped && hmuldi.Advance())
+	{
+		const ULONG *pulPos = phmulpos->Find(hmuldi.Key());
+		fMapped = (NULL != pulPos);
+		if (fMapped)
+		{
+			(void) pbsWidth->ExchangeSet(*pulPos);
+		}
+	}
+	phmuldWidth->Release();
+
+	pstr->AppendWideCharArray(GPOS_WSZ_LIT("hist:"));
+	CBitSetIter bsiHist(*pbsHist);
+	while (bsiHist.Advance())
+	{
+		pstr->AppendFormat(GPOS_WSZ_LIT("%d,"), bsiHist.Bit());
+	}
+
+	pstr->AppendWideCharArray(GPOS_WSZ_LIT(";width:"));
+	CBitSetIter bsiWidth(*pbsWidth);
+	while (bsiWidth.Advance())
+	{
+		pstr->AppendFormat(GPOS_WSZ_LIT("%d,"), bsiWidth.Bit());
+	}
+	pbsHist->Release();
+	pbsWidth->Release();
+
+	pstr->AppendWideCharArray(GPOS_WSZ_LIT(";pred:"));
+	if (!fMapped || !FAppendPred(mp, pstr, phmulpos, pred_stats))
+	{
+		GPOS_DELETE(pstr);
+		return NULL;
+	}
+
+	return pstr;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CStatsCache::PstatsDeriveFilter
+//
+//	@doc:
+//		Derive filter statistics as CFilterStatsProcessor does. Filters
+//		without outer references on top of a base table get are looked up
+//		in the cache first, and the derived statistics are added to the
+//		cache on a miss
+//
+//---------------------------------------------------------------------------
+IStatistics *
+CStatsCache::PstatsDeriveFilter
+	(
+	CMemoryPool *mp,
+	CExpressionHandle &exprhdl,
+	IStatistics *child_stats,
+	CExpression *local_scalar_expr,
+	CExpression *outer_refs_scalar_expr,
+	IStatisticsArray *all_outer_stats
+	)
+{
+	CLogicalGet *popGet = NULL;
+	if (FInitialized() && !GPOS_FTRACE(EopttraceDisableStatsCache) && !exprhdl.HasOuterRefs())
+	{
+		popGet = PopGetChild(exprhdl);
+	}
+
+	if (NULL == popGet)
+	{
+		return CFilterStatsProcessor::MakeStatsFilterForScalarExpr
+				(
+				mp,
+				exprhdl,
+				child_stats,
+				local_scalar_expr,
+				outer_refs_scalar_expr,
+				all_outer_stats
+				);
+	}
+
+	COptCtxt *poctxt = COptCtxt::PoctxtFromTLS();
+	CMDAccessor *md_accessor = poctxt->Pmda();
+	CStatistics *input_stats = dynamic_cast<CStatistics *>(child_stats);
+	const CColRefArray *pdrgpcrOutput = popGet->PdrgpcrOutput();
+
+	// map the columns of the get to their positions
+	UlongToUlongMap *phmulpos = GPOS_NEW(mp) UlongToUlongMap(mp);
+	const ULONG ulCols = pdrgpcrOutput->Size();
+	for (ULONG ul = 0; ul < ulCols; ul++)
+	{
+		(void) phmulpos->Insert(GPOS_NEW(mp) ULONG((*pdrgpcrOutput)[ul]->Id()), GPOS_NEW(mp) ULONG(ul));
+	}
+
+	// filters are capped immediately on top of tables,
+	// see CFilterStatsProcessor::MakeStatsFilterForScalarExpr
+	BOOL do_cap_NDVs = (1 == exprhdl.DeriveJoinDepth());
+	CStatsPred *pred_stats = CStatsPredUtils::ExtractPredStats(mp, local_scalar_expr, exprhdl.DeriveOuterReferences());
+	CWStringDynamic *pstrKey = PstrKey(mp, popGet, phmulpos, input_stats, pred_stats, do_cap_NDVs);
+
+	IStatistics *stats = NULL;
+	if (NULL == pstrKey)
+	{
+		stats = CFilterStatsProcessor::MakeStatsFilter(mp, input_stats, pred_stats, do_cap_NDVs);
+	}
+	else
+	{
+		CStatsCacheKey key(mp, pstrKey);
+		CacheAccessorStats cacc(m_pcache);
+		cacc.Lookup(&key);
+
+		CStatsCacheEntry *pentry = cacc.Val();
+		if (NULL != pentry)
+		{
+			stats = pentry->PstatsThaw(mp, md_accessor, pdrgpcrOutput);
+			pentry->Release();
+			poctxt->IncrementCounter(COptCtxt::EocStatsCacheHits);
+		}
+		else
+		{
+			stats = CFilterStatsProcessor::MakeStatsFilter(mp, input_stats, pred_stats, do_cap_NDVs);
+			poctxt->IncrementCounter(COptCtxt::EocStatsCacheMisses);
+
+			CMemoryPool *pmpEntry = cacc.Pmp();
+			CStatsCacheEntry *pentryNew = CStatsCacheEntry::PentryFreeze
+											(
+											pmpEntry,
+											mp,
+											md_accessor,
+											dynamic_cast<CStatistics *>(stats),
+											phmulpos
+											);
+			if (NULL != pentryNew)
+			{
+				// the key was not found above, hence the insertion succeeds
+				CStatsCacheKey *pkeyNew = GPOS_NEW(pmpEntry) CStatsCacheKey(pmpEntry, pstrKey);
+				(void) cacc.Insert(pkeyNew, pentryNew);
+			}
+		}
+
+		GPOS_DELETE(pstrKey);
+	}
+
+	pred_stats->Release();
+	phmulpos->Release();
+
+	return stats;
+}
+
+// EOF
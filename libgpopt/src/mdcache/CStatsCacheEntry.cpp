@@ -0,0 +1,340 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (C) 2020 VMware, Inc. or its affiliates.
+//
+//	@filename:
+//		CStatsCacheEntry.cpp
+//
+//	@doc:
+//		Implementation of derived statistics held in the statistics cache
+//---------------------------------------------------------------------------
+
+#include "gpopt/base/CColRefSet.h"
+#include "gpopt/base/CColRefSetIter.h"
+#include "gpopt/mdcache/CMDAccessor.h"
+#include "gpopt/mdcache/CStatsCacheEntry.h"
+
+#include "naucrates/dxl/CDXLUtils.h"
+#include "naucrates/md/CDXLBucket.h"
+#include "naucrates/statistics/CUpperBoundNDVs.h"
+
+using namespace gpos;
+using namespace gpopt;
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CStatsCacheEntry::CStatsCacheEntry
+//
+//	@doc:
+//		Ctor; columns are added by the caller
+//
+//---------------------------------------------------------------------------
+CStatsCacheEntry::CStatsCacheEntry
+	(
+	CMemoryPool *mp,
+	const CStatistics *stats
+	)
+	:
+	m_mp(mp),
+	m_rows(stats->Rows()),
+	m_is_empty(stats->IsEmpty()),
+	m_num_predicates(stats->GetNumberOfPredicates()),
+	m_pdrgpdxlhist(NULL),
+	m_pbsWellDefined(NULL),
+	m_pbsColStatsMissing(NULL),
+	m_pdrgpulWidthPos(NULL),
+	m_pdrgpdWidth(NULL),
+	m_pdrgpdrgpulUpperBoundPos(NULL),
+	m_pdrgpdUpperBoundNDVs(NULL)
+{
+	m_pdrgpdxlhist = GPOS_NEW(mp) CDXLStatsDerivedColumnArray(mp);
+	m_pbsWellDefined = GPOS_NEW(mp) CBitSet(mp);
+	m_pbsColStatsMissing = GPOS_NEW(mp) CBitSet(mp);
+	m_pdrgpulWidthPos = GPOS_NEW(mp) ULongPtrArray(mp);
+	m_pdrgpdWidth = GPOS_NEW(mp) CDoubleArray(mp);
+	m_pdrgpdrgpulUpperBoundPos = GPOS_NEW(mp) ULongPtr2dArray(mp);
+	m_pdrgpdUpperBoundNDVs = GPOS_NEW(mp) CDoubleArray(mp);
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CStatsCacheEntry::~CStatsCacheEntry
+//
+//	@doc:
+//		Dtor
+//
+//---------------------------------------------------------------------------
+CStatsCacheEntry::~CStatsCacheEntry()
+{
+	m_pdrgpdxlhist->Release();
+	m_pbsWellDefined->Release();
+	m_pbsColStatsMissing->Release();
+	m_pdrgpulWidthPos->Release();
+	m_pdrgpdWidth->Release();
+	m_pdrgpdrgpulUpperBoundPos->Release();
+	m_pdrgpdUpperBoundNDVs->Release();
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CStatsCacheEntry::FPosition
+//
+//	@doc:
+//		Look up the position of a column, return false if it is unknown
+//
+//---------------------------------------------------------------------------
+BOOL
+CStatsCacheEntry::FPosition
+	(
+	const UlongToUlongMap *phmulpos,
+	ULONG colid,
+	ULONG *pulPos
+	)
+{
+	const ULONG *pulPosFound = phmulpos->Find(&colid);
+	if (NULL == pulPosFound)
+	{
+		return false;
+	}
+
+	*pulPos = *pulPosFound;
+	return true;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CStatsCacheEntry::PdxlhistFreeze
+//
+//	@doc:
+//		Freeze a histogram into a DXL derived column in the entry memory
+//		pool; the type ids of the boundaries are copied into the pool as
+//		well, since the ones handed out by the accessor belong to cached
+//		metadata objects that may be evicted before the entry
+//
+//---------------------------------------------------------------------------
+CDXLStatsDerivedColumn *
+CStatsCacheEntry::PdxlhistFreeze
+	(
+	CMDAccessor *md_accessor,
+	const CHistogram *histogram,
+	ULONG ulPos
+	)
+{
+	CDXLBucketArray *pdrgpdxlbucket = GPOS_NEW(m_mp) CDXLBucketArray(m_mp);
+
+	const CBucketArray *buckets = histogram->ParseDXLToBucketsArray();
+	const ULONG ulBuckets = buckets->Size();
+	for (ULONG ul = 0; ul < ulBuckets; ul++)
+	{
+		CBucket *bucket = (*buckets)[ul];
+
+		CDXLDatum *dxl_datum_lower = bucket->GetLowerBound()->GetDatumVal(m_mp, md_accessor);
+		CDXLDatum *dxl_datum_upper = bucket->GetUpperBound()->GetDatumVal(m_mp, md_accessor);
+		dxl_datum_lower->DetachMDIdType();
+		dxl_datum_upper->DetachMDIdType();
+
+		pdrgpdxlbucket->Append
+						(
+						GPOS_NEW(m_mp) CDXLBucket
+							(
+							dxl_datum_lower,
+							dxl_datum_upper,
+							bucket->IsLowerClosed(),
+							bucket->IsUpperClosed(),
+							bucket->GetFrequency(),
+							bucket->GetNumDistinct()
+							)
+						);
+	}
+
+	return GPOS_NEW(m_mp) CDXLStatsDerivedColumn
+							(
+							ulPos,
+							CStatistics::DefaultColumnWidth,
+							histogram->GetNullFreq(),
+							histogram->GetDistinctRemain(),
+							histogram->GetFreqRemain(),
+							pdrgpdxlbucket
+							);
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CStatsCacheEntry::PentryFreeze
+//
+//	@doc:
+//		Freeze the given statistics into the entry memory pool, mapping
+//		column ids to positions with the given map; temporary objects are
+//		allocated in the given query memory pool. Returns NULL if one of
+//		the columns is not found in the map
+//
+//---------------------------------------------------------------------------
+CStatsCacheEntry *
+CStatsCacheEntry::PentryFreeze
+	(
+	CMemoryPool *pmpEntry,
+	CMemoryPool *mp,
+	CMDAccessor *md_accessor,
+	const CStatistics *stats,
+	const UlongToUlongMap *phmulpos
+	)
+{
+	GPOS_ASSERT(NULL != stats);
+	GPOS_ASSERT(NULL != phmulpos);
+
+	CStatsCacheEntry *pentry = GPOS_NEW(pmpEntry) CStatsCacheEntry(pmpEntry, stats);
+	BOOL fMapped = true;
+
+	// histograms
+	ULongPtrArray *colids = stats->GetColIdsWithStats(mp);
+	const ULONG ulHistograms = colids->Size();
+	for (ULONG ul = 0; fMapped && ul < ulHistograms; ul++)
+	{
+		ULONG colid = *(*colids)[ul];
+		ULONG ulPos = 0;
+		fMapped = FPosition(phmulpos, colid, &ulPos);
+		if (fMapped)
+		{
+			const CHistogram *histogram = stats->GetHistogram(colid);
+			pentry->m_pdrgpdxlhist->Append(pentry->PdxlhistFreeze(md_accessor, histogram, ulPos));
+			if (histogram->IsWellDefined())
+			{
+				(void) pentry->m_pbsWellDefined->ExchangeSet(ulPos);
+			}
+			if (histogram->IsColStatsMissing())
+			{
+				(void) pentry->m_pbsColStatsMissing->ExchangeSet(ulPos);
+			}
+		}
+	}
+	colids->Release();
+
+	// widths
+	UlongToDoubleMap *phmuldWidth = stats->CopyWidths(mp);
+	UlongToDoubleMapIter hmuldi(phmuldWidth);
+	while (fMapped && hmuldi.Advance())
+	{
+		ULONG ulPos = 0;
+		fMapped = FPosition(phmulpos, *(hmuldi.Key()), &ulPos);
+		if (fMapped)
+		{
+			pentry->m_pdrgpulWidthPos->Append(GPOS_NEW(pmpEntry) ULONG(ulPos));
+			pentry->m_pdrgpdWidth->Append(GPOS_NEW(pmpEntry) CDouble(*(hmuldi.Value())));
+		}
+	}
+	phmuldWidth->Release();
+
+	// upper bounds of NDVs
+	CUpperBoundNDVPtrArray *pdrgpubndvs = stats->GetUpperBoundNDVs();
+	const ULONG ulUpperBounds = pdrgpubndvs->Size();
+	for (ULONG ul = 0; fMapped && ul < ulUpperBounds; ul++)
+	{
+		const CUpperBoundNDVs *pubndvs = (*pdrgpubndvs)[ul];
+		ULongPtrArray *pdrgpulPos = GPOS_NEW(pmpEntry) ULongPtrArray(pmpEntry);
+
+		CColRefSetIter crsi(*pubndvs->GetColRefSet());
+		while (fMapped && crsi.Advance())
+		{
+			ULONG ulPos = 0;
+			fMapped = FPosition(phmulpos, crsi.Pcr()->Id(), &ulPos);
+			if (fMapped)
+			{
+				pdrgpulPos->Append(GPOS_NEW(pmpEntry) ULONG(ulPos));
+			}
+		}
+
+		pentry->m_pdrgpdrgpulUpperBoundPos->Append(pdrgpulPos);
+		pentry->m_pdrgpdUpperBoundNDVs->Append(GPOS_NEW(pmpEntry) CDouble(pubndvs->UpperBoundNDVs()));
+	}
+
+	if (!fMapped)
+	{
+		pentry->Release();
+		return NULL;
+	}
+
+	return pentry;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CStatsCacheEntry::PstatsThaw
+//
+//	@doc:
+//		Thaw the entry into statistics over the given output columns of a
+//		relation; the histogram boundaries are translated with the types
+//		known to the given accessor
+//
+//---------------------------------------------------------------------------
+IStatistics *
+CStatsCacheEntry::PstatsThaw
+	(
+	CMemoryPool *mp,
+	CMDAccessor *md_accessor,
+	const CColRefArray *pdrgpcrOutput
+	)
+	const
+{
+	GPOS_ASSERT(NULL != pdrgpcrOutput);
+
+	UlongToHistogramMap *col_histogram_mapping = GPOS_NEW(mp) UlongToHistogramMap(mp);
+	const ULONG ulHistograms = m_pdrgpdxlhist->Size();
+	for (ULONG ul = 0; ul < ulHistograms; ul++)
+	{
+		CDXLStatsDerivedColumn *pdxlhist = (*m_pdrgpdxlhist)[ul];
+		const ULONG ulPos = pdxlhist->GetColId();
+		GPOS_ASSERT(ulPos < pdrgpcrOutput->Size());
+
+		CBucketArray *buckets = CDXLUtils::ParseDXLToBucketsArray(mp, md_accessor, pdxlhist);
+		CHistogram *histogram = GPOS_NEW(mp) CHistogram
+										(
+										mp,
+										buckets,
+										m_pbsWellDefined->Get(ulPos),
+										pdxlhist->GetNullFreq(),
+										pdxlhist->GetDistinctRemain(),
+										pdxlhist->GetFreqRemain(),
+										m_pbsColStatsMissing->Get(ulPos)
+										);
+		col_histogram_mapping->Insert(GPOS_NEW(mp) ULONG((*pdrgpcrOutput)[ulPos]->Id()), histogram);
+	}
+
+	UlongToDoubleMap *colid_width_mapping = GPOS_NEW(mp) UlongToDoubleMap(mp);
+	const ULONG ulWidths = m_pdrgpulWidthPos->Size();
+	for (ULONG ul = 0; ul < ulWidths; ul++)
+	{
+		const ULONG ulPos = *(*m_pdrgpulWidthPos)[ul];
+		GPOS_ASSERT(ulPos < pdrgpcrOutput->Size());
+
+		colid_width_mapping->Insert(GPOS_NEW(mp) ULONG((*pdrgpcrOutput)[ulPos]->Id()), GPOS_NEW(mp) CDouble(*(*m_pdrgpdWidth)[ul]));
+	}
+
+	CStatistics *stats = GPOS_NEW(mp) CStatistics
+									(
+									mp,
+									col_histogram_mapping,
+									colid_width_mapping,
+									m_rows,
+									m_is_empty,
+									m_num_predicates
+									);
+
+	const ULONG ulUpperBounds = m_pdrgpdrgpulUpperBoundPos->Size();
+	for (ULONG ul = 0; ul < ulUpperBounds; ul++)
+	{
+		const ULongPtrArray *pdrgpulPos = (*m_pdrgpdrgpulUpperBoundPos)[ul];
+		CColRefSet *pcrs = GPOS_NEW(mp) CColRefSet(mp);
+
+		const ULONG ulCols = pdrgpulPos->Size();
+		for (ULONG ulCol = 0; ulCol < ulCols; ulCol++)
+		{
+			pcrs->Include((*pdrgpcrOutput)[*(*pdrgpulPos)[ulCol]]);
+		}
+
+		stats->AddCardUpperBound(GPOS_NEW(mp) CUpperBoundNDVs(pcrs, *(*m_pdrgpdUpperBoundNDVs)[ul]));
+	}
+
+	return stats;
+}
+
+// EOF
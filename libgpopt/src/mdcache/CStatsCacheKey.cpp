@@ -0,0 +1,120 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (C) 2020 VMware, Inc. or its affiliates.
+//
+//	@filename:
+//		CStatsCacheKey.cpp
+//
+//	@doc:
+//		Implementation of a key for derived statistics in the cache
+//---------------------------------------------------------------------------
+
+#include "gpopt/mdcache/CStatsCacheKey.h"
+
+using namespace gpos;
+using namespace gpopt;
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CStatsCacheKey::CStatsCacheKey
+//
+//	@doc:
+//		Ctor
+//
+//---------------------------------------------------------------------------
+CStatsCacheKey::CStatsCacheKey
+	(
+	CMemoryPool *mp,
+	const CWStringBase *pstr
+	)
+	:
+	m_pstr(NULL),
+	m_ulHash(0)
+{
+	GPOS_ASSERT(NULL != pstr);
+
+	m_pstr = GPOS_NEW(mp) CWStringDynamic(mp, pstr->GetBuffer());
+	m_ulHash = gpos::HashByteArray
+					(
+					(const BYTE *) m_pstr->GetBuffer(),
+					m_pstr->Length() * GPOS_SIZEOF(WCHAR)
+					);
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CStatsCacheKey::~CStatsCacheKey
+//
+//	@doc:
+//		Dtor
+//
+//---------------------------------------------------------------------------
+CStatsCacheKey::~CStatsCacheKey()
+{
+	GPOS_DELETE(m_pstr);
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CStatsCacheKey::Equals
+//
+//	@doc:
+//		Equality function
+//
+//---------------------------------------------------------------------------
+BOOL
+CStatsCacheKey::Equals
+	(
+	const CStatsCacheKey &key
+	)
+	const
+{
+	return m_ulHash == key.m_ulHash && m_pstr->Equals(key.m_pstr);
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CStatsCacheKey::FEqualKey
+//
+//	@doc:
+//		Equality function for using keys in a cache
+//
+//---------------------------------------------------------------------------
+BOOL
+CStatsCacheKey::FEqualKey
+	(
+	CStatsCacheKey* const &pkeyLeft,
+	CStatsCacheKey* const &pkeyRight
+	)
+{
+	if (NULL == pkeyLeft && NULL == pkeyRight)
+	{
+		return true;
+	}
+
+	if (NULL == pkeyLeft || NULL == pkeyRight)
+	{
+		return false;
+	}
+
+	return pkeyLeft->Equals(*pkeyRight);
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CStatsCacheKey::UlHashKey
+//
+//	@doc:
+//		Hash function for using keys in a cache
+//
+//---------------------------------------------------------------------------
+ULONG
+CStatsCacheKey::UlHashKey
+	(
+	CStatsCacheKey* const &pkey
+	)
+{
+	return pkey->HashValue();
+}
+
+// EOF
@@ -69,7 +69,9 @@ CExpression::CExpression
 	m_pgexpr(pgexpr),
 	m_cost(GPOPT_INVALID_COST),
 	m_ulOriginGrpId(gpos::ulong_max),
-	m_ulOriginGrpExprId(gpos::ulong_max)
+	m_ulOriginGrpExprId(gpos::ulong_max),
+	m_fInterned(false),
+	m_ulHash(0)
 {
 	GPOS_ASSERT(NULL != mp);
 	GPOS_ASSERT(NULL != pop);
@@ -110,7 +112,9 @@ CExpression::CExpression
 	m_pgexpr(NULL),
 	m_cost(GPOPT_INVALID_COST),
 	m_ulOriginGrpId(gpos::ulong_max),
-	m_ulOriginGrpExprId(gpos::ulong_max)
+	m_ulOriginGrpExprId(gpos::ulong_max),
+	m_fInterned(false),
+	m_ulHash(0)
 {
 	GPOS_ASSERT(NULL != mp);
 	GPOS_ASSERT(NULL != pop);
@@ -152,7 +156,9 @@ CExpression::CExpression
 	m_pgexpr(NULL),
 	m_cost(GPOPT_INVALID_COST),
 	m_ulOriginGrpId(gpos::ulong_max),
-	m_ulOriginGrpExprId(gpos::ulong_max)
+	m_ulOriginGrpExprId(gpos::ulong_max),
+	m_fInterned(false),
+	m_ulHash(0)
 {
 	GPOS_ASSERT(NULL != mp);
 	GPOS_ASSERT(NULL != pop);
@@ -198,7 +204,9 @@ CExpression::CExpression
 	m_pgexpr(NULL),
 	m_cost(GPOPT_INVALID_COST),
 	m_ulOriginGrpId(gpos::ulong_max),
-	m_ulOriginGrpExprId(gpos::ulong_max)
+	m_ulOriginGrpExprId(gpos::ulong_max),
+	m_fInterned(false),
+	m_ulHash(0)
 {
 	GPOS_ASSERT(NULL != mp);
 	GPOS_ASSERT(NULL != pop);
@@ -244,7 +252,9 @@ CExpression::CExpression
 	m_pgexpr(NULL),
 	m_cost(GPOPT_INVALID_COST),
 	m_ulOriginGrpId(gpos::ulong_max),
-	m_ulOriginGrpExprId(gpos::ulong_max)
+	m_ulOriginGrpExprId(gpos::ulong_max),
+	m_fInterned(false),
+	m_ulHash(0)
 {
 	GPOS_ASSERT(NULL != mp);
 	GPOS_ASSERT(NULL != pop);
@@ -285,7 +295,9 @@ CExpression::CExpression
 	m_pgexpr(pgexpr),
 	m_cost(cost),
 	m_ulOriginGrpId(gpos::ulong_max),
-	m_ulOriginGrpExprId(gpos::ulong_max)
+	m_ulOriginGrpExprId(gpos::ulong_max),
+	m_fInterned(false),
+	m_ulHash(0)
 {
 	GPOS_ASSERT(NULL != mp);
 	GPOS_ASSERT(NULL != pop);
@@ -1319,6 +1331,12 @@ CExpression::HashValue
 {
 	GPOS_CHECK_STACK_SIZE;
 
+	// interned trees are immutable, their hash value is computed once
+	if (pexpr->m_fInterned)
+	{
+		return pexpr->m_ulHash;
+	}
+
 	ULONG ulHash = pexpr->Pop()->HashValue();
 
 	const ULONG arity = pexpr->Arity();
@@ -84,9 +84,7 @@ CExpressionFactorizer::PexprProcessDisjDescendents
 		pdrgpexprChildren->Append(pexprChild);
 	}
 
-	COperator *pop = pexpr->Pop();
-	pop->AddRef();
-	return GPOS_NEW(mp) CExpression(mp, pop, pdrgpexprChildren);
+	return CExpressionUtils::PexprRebuild(mp, pexpr, pdrgpexprChildren);
 }
 
 //---------------------------------------------------------------------------
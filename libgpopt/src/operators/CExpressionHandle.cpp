@@ -42,6 +42,29 @@ using namespace gpnaucrates;
 using namespace gpopt;
 
 
+//---------------------------------------------------------------------------
+//	@function:
+//		CountChildArray
+//
+//	@doc:
+//		Count a child array initialized by a handle, distinguishing arrays
+//		held inline from those that had to be allocated
+//
+//---------------------------------------------------------------------------
+static void
+CountChildArray
+	(
+	BOOL fInline
+	)
+{
+	COptCtxt *poctxt = COptCtxt::PoctxtFromTLS();
+	if (NULL != poctxt)
+	{
+		poctxt->IncrementCounter(fInline ? COptCtxt::EocHandleArraysInline : COptCtxt::EocHandleArraysAllocated);
+	}
+}
+
+
 //---------------------------------------------------------------------------
 //	@function:
 //		CExpressionHandle::CExpressionHandle
@@ -61,9 +84,7 @@ CExpressionHandle::CExpressionHandle
 	m_pcc(NULL),
 	m_pdpplan(NULL),
 	m_pstats(NULL),
-	m_prp(NULL),
-	m_pdrgpstat(NULL),
-	m_pdrgprp(NULL)
+	m_prp(NULL)
 {
 	GPOS_ASSERT(NULL != mp);
 }
@@ -86,9 +107,16 @@ CExpressionHandle::~CExpressionHandle()
 	CRefCount::SafeRelease(m_pgexpr);
 	CRefCount::SafeRelease(m_pstats);
 	CRefCount::SafeRelease(m_prp);
-	CRefCount::SafeRelease(m_pdpplan);
-	CRefCount::SafeRelease(m_pdrgpstat);
-	CRefCount::SafeRelease(m_pdrgprp);
+	if (NULL != m_pdpplan)
+	{
+		// plan properties derived on demand cannot outlive the handle
+		CDrvdPropPlan *pdpplan = CDrvdPropPlan::Pdpplan(m_pdpplan);
+		if (pdpplan->FAttached(this))
+		{
+			pdpplan->AbandonDerivation();
+		}
+		m_pdpplan->Release();
+	}
 }
 
 
@@ -186,9 +214,9 @@ CExpressionHandle::CopyStats()
 	m_pstats = stats;
 
 	// attach child stats
-	GPOS_ASSERT(NULL == m_pdrgpstat);
-	m_pdrgpstat = GPOS_NEW(m_mp) IStatisticsArray(m_mp);
 	const ULONG arity = Arity();
+	m_rgpstat.Init(m_mp, arity);
+	CountChildArray(m_rgpstat.FInline());
 	for (ULONG ul = 0; ul < arity; ul++)
 	{
 		IStatistics *child_stats = NULL;
@@ -204,16 +232,11 @@ CExpressionHandle::CopyStats()
 		if (NULL != child_stats)
 		{
 			child_stats->AddRef();
-		}
-		else
-		{
-			GPOS_ASSERT(FScalarChild(ul));
-
-			// create dummy stats for missing scalar children
-			child_stats = CStatistics::MakeEmptyStats(m_mp);
+			m_rgpstat.Replace(ul, child_stats);
 		}
 
-		m_pdrgpstat->Append(child_stats);
+		// dummy stats of scalar children are created in Pstats()
+		GPOS_ASSERT(NULL != child_stats || FScalarChild(ul));
 	}
 }
 
@@ -446,18 +469,19 @@ CExpressionHandle::DeriveStats
 	)
 {
 	GPOS_ASSERT(NULL != stats_ctxt);
-	GPOS_ASSERT(NULL == m_pdrgpstat);
+	GPOS_ASSERT(!m_rgpstat.FInitialized());
 	GPOS_ASSERT(NULL == m_pstats);
-	GPOS_ASSERT(NULL != m_pdrgprp);
+	GPOS_ASSERT(m_rgprp.FInitialized());
 
 	// copy input context
 	IStatisticsArray *pdrgpstatCurrentCtxt = GPOS_NEW(m_mp) IStatisticsArray(m_mp);
 	CUtils::AddRefAppend<IStatistics, CleanupStats>(pdrgpstatCurrentCtxt, stats_ctxt);
 
 	// create array of children stats
-	m_pdrgpstat = GPOS_NEW(m_mp) IStatisticsArray(m_mp);
 	ULONG ulMaxChildRisk = 1;
 	const ULONG arity = Arity();
+	m_rgpstat.Init(m_mp, arity);
+	CountChildArray(m_rgpstat.FInline());
 	for (ULONG ul = 0; ul < arity; ul++)
 	{
 		// create a new context for outer references used by current child
@@ -483,7 +507,7 @@ CExpressionHandle::DeriveStats
 
 		// add child stat to children stat array
 		stats->AddRef();
-		m_pdrgpstat->Append(stats);
+		m_rgpstat.Replace(ul, stats);
 		if (stats->StatsEstimationRisk() > ulMaxChildRisk)
 		{
 			ulMaxChildRisk = stats->StatsEstimationRisk();
@@ -558,11 +582,11 @@ CExpressionHandle::DeriveCostContextStats()
 	m_pstats = NULL;
 
 	// load stats from child cost context -- these may be different from child groups stats
-	CRefCount::SafeRelease(m_pdrgpstat);
-	m_pdrgpstat = NULL;
+	m_rgpstat.Clear();
 
-	m_pdrgpstat = GPOS_NEW(m_mp) IStatisticsArray(m_mp);
 	const ULONG arity = m_pcc->Pdrgpoc()->Size();
+	m_rgpstat.Init(m_mp, arity);
+	CountChildArray(m_rgpstat.FInline());
 	for (ULONG ul = 0; ul < arity; ul++)
 	{
 		COptimizationContext *pocChild = (*m_pcc->Pdrgpoc())[ul];
@@ -571,16 +595,16 @@ CExpressionHandle::DeriveCostContextStats()
 		GPOS_ASSERT(NULL != pccChild->Pstats());
 
 		pccChild->Pstats()->AddRef();
-		m_pdrgpstat->Append(pccChild->Pstats());
+		m_rgpstat.Replace(ul, pccChild->Pstats());
 	}
 
 	if (CPhysical::PopConvert(m_pgexpr->Pop())->FPassThruStats())
 	{
-		GPOS_ASSERT(1 == m_pdrgpstat->Size());
+		GPOS_ASSERT(1 == m_rgpstat.Size());
 
 		// copy stats from first child
-		(*m_pdrgpstat)[0]->AddRef();
-		m_pstats = (*m_pdrgpstat)[0];
+		m_rgpstat[0]->AddRef();
+		m_pstats = m_rgpstat[0];
 
 		return;
 	}
@@ -592,8 +616,13 @@ CExpressionHandle::DeriveCostContextStats()
 	CExpressionHandle exprhdl(m_mp);
 	exprhdl.Attach(pgexprForStats);
 	exprhdl.DeriveProps(NULL /*pdpctxt*/);
-	m_pdrgpstat->AddRef();
-	exprhdl.m_pdrgpstat = m_pdrgpstat;
+	exprhdl.m_rgpstat.Init(m_mp, arity);
+	CountChildArray(exprhdl.m_rgpstat.FInline());
+	for (ULONG ul = 0; ul < arity; ul++)
+	{
+		m_rgpstat[ul]->AddRef();
+		exprhdl.m_rgpstat.Replace(ul, m_rgpstat[ul]);
+	}
 	exprhdl.ComputeReqdProps(m_pcc->Poc()->GetReqdRelationalProps(), 0 /*ulOptReq*/);
 
 	GPOS_ASSERT(NULL == exprhdl.m_pstats);
@@ -672,16 +701,46 @@ CExpressionHandle::DeriveStats
 // CDrvdPropCtxtPlan.
 // On the other hand, the properties in the gexpr may have been derived in
 // other non-default contexts (e.g with cte info).
+// Properties already derived for the cost context, or for another cost
+// context of the same gexpr with the same child plans, are reused. When
+// derived on demand, properties that are never accessed before the handle
+// goes away are not derived at all, and the result is not cached.
+// EopttraceDisablePlanPropsReuse turns off both reuse and on-demand
+// derivation.
 void
-CExpressionHandle::DerivePlanPropsForCostContext()
+CExpressionHandle::DerivePlanPropsForCostContext
+	(
+	BOOL fOnDemand
+	)
 {
 	GPOS_ASSERT(NULL != m_pcc);
 	GPOS_ASSERT(NULL != m_pgexpr);
+	GPOS_ASSERT(NULL == m_pdpplan);
 	GPOS_CHECK_ABORT;
 
-	CDrvdPropCtxtPlan *pdpctxtplan = GPOS_NEW(m_mp) CDrvdPropCtxtPlan(m_mp);
 	CopyStats();
 
+	BOOL fReuse = !GPOS_FTRACE(EopttraceDisablePlanPropsReuse);
+	CDrvdPropPlan *pdpplanCached = NULL;
+	if (fReuse)
+	{
+		pdpplanCached = m_pcc->Pdpplan();
+		if (NULL == pdpplanCached)
+		{
+			pdpplanCached = m_pgexpr->PdpplanLookup(m_pcc);
+		}
+	}
+
+	if (NULL != pdpplanCached)
+	{
+		COptCtxt::PoctxtFromTLS()->IncrementCounter(COptCtxt::EocPlanPropsReused);
+		pdpplanCached->AddRef();
+		m_pdpplan = pdpplanCached;
+
+		return;
+	}
+
+	CDrvdPropCtxtPlan *pdpctxtplan = GPOS_NEW(m_mp) CDrvdPropCtxtPlan(m_mp);
 
 	COperator *pop = m_pgexpr->Pop();
 	if (COperator::EopPhysicalCTEConsumer == pop->Eopid())
@@ -700,8 +759,39 @@ CExpressionHandle::DerivePlanPropsForCostContext()
 
 	// create/derive local properties
 	m_pdpplan = Pop()->PdpCreate(m_mp);
-	m_pdpplan->Derive(m_mp, *this, pdpctxtplan);
+	CDrvdPropPlan *pdpplan = CDrvdPropPlan::Pdpplan(m_pdpplan);
+	pdpplan->DeriveOnDemand(m_mp, *this, pdpctxtplan);
 	pdpctxtplan->Release();
+
+	if (!fReuse)
+	{
+		pdpplan->CompleteDerivation();
+	}
+	else if (!fOnDemand)
+	{
+		CompletePlanPropsForCostContext();
+	}
+}
+
+
+// Derive the plan properties of the attached cost context that were not
+// accessed yet, and share them with other cost contexts of the same gexpr
+// with the same child plans
+void
+CExpressionHandle::CompletePlanPropsForCostContext()
+{
+	GPOS_ASSERT(NULL != m_pcc);
+	GPOS_ASSERT(NULL != m_pdpplan);
+
+	CDrvdPropPlan *pdpplan = CDrvdPropPlan::Pdpplan(m_pdpplan);
+	if (!pdpplan->FAttached(this))
+	{
+		// properties were reused, or are already complete
+		return;
+	}
+
+	pdpplan->CompleteDerivation();
+	m_pgexpr->CachePdpplan(m_pcc, pdpplan);
 }
 
 //---------------------------------------------------------------------------
@@ -721,7 +811,7 @@ CExpressionHandle::InitReqdProps
 {
 	GPOS_ASSERT(NULL != prpInput);
 	GPOS_ASSERT(NULL == m_prp);
-	GPOS_ASSERT(NULL == m_pdrgprp);
+	GPOS_ASSERT(!m_rgprp.FInitialized());
 
 	// set required properties of attached expr/gexpr
 	m_prp = prpInput;
@@ -737,17 +827,16 @@ CExpressionHandle::InitReqdProps
 		}
 	}
 	
-	// compute required properties of children
-	m_pdrgprp = GPOS_NEW(m_mp) CReqdPropArray(m_mp);
-
 	// initialize array with input requirements,
 	// the initial requirements are only place holders in the array
 	// and they are replaced when computing the requirements of each child
 	const ULONG arity = Arity();
+	m_rgprp.Init(m_mp, arity);
+	CountChildArray(m_rgprp.FInline());
 	for (ULONG ul = 0; ul < arity; ul++)
 	{
 		m_prp->AddRef();
-		m_pdrgprp->Append(m_prp);
+		m_rgprp.Replace(ul, m_prp);
 	}
 }
 
@@ -770,9 +859,9 @@ CExpressionHandle::ComputeChildReqdProps
 	)
 {
 	GPOS_ASSERT(NULL != m_prp);
-	GPOS_ASSERT(NULL != m_pdrgprp);
-	GPOS_ASSERT(m_pdrgprp->Size() == Arity());
-	GPOS_ASSERT(child_index < m_pdrgprp->Size() && "uninitialized required child properties");
+	GPOS_ASSERT(m_rgprp.FInitialized());
+	GPOS_ASSERT(m_rgprp.Size() == Arity());
+	GPOS_ASSERT(child_index < m_rgprp.Size() && "uninitialized required child properties");
 	GPOS_CHECK_ABORT;
 
 	CReqdProp *prp = m_prp;
@@ -789,7 +878,7 @@ CExpressionHandle::ComputeChildReqdProps
 	}
 
 	// replace required properties of given child
-	m_pdrgprp->Replace(child_index, prp);
+	m_rgprp.Replace(child_index, prp);
 }
 
 
@@ -810,11 +899,11 @@ CExpressionHandle::CopyChildReqdProps
 	)
 {
 	GPOS_ASSERT(NULL != prp);
-	GPOS_ASSERT(NULL != m_pdrgprp);
-	GPOS_ASSERT(m_pdrgprp->Size() == Arity());
-	GPOS_ASSERT(child_index < m_pdrgprp->Size() && "uninitialized required child properties");
+	GPOS_ASSERT(m_rgprp.FInitialized());
+	GPOS_ASSERT(m_rgprp.Size() == Arity());
+	GPOS_ASSERT(child_index < m_rgprp.Size() && "uninitialized required child properties");
 
-	m_pdrgprp->Replace(child_index, prp);
+	m_rgprp.Replace(child_index, prp);
 }
 
 
@@ -835,9 +924,9 @@ CExpressionHandle::ComputeChildReqdCols
 	)
 {
 	GPOS_ASSERT(NULL != m_prp);
-	GPOS_ASSERT(NULL != m_pdrgprp);
-	GPOS_ASSERT(m_pdrgprp->Size() == Arity());
-	GPOS_ASSERT(child_index < m_pdrgprp->Size() && "uninitialized required child properties");
+	GPOS_ASSERT(m_rgprp.FInitialized());
+	GPOS_ASSERT(m_rgprp.Size() == Arity());
+	GPOS_ASSERT(child_index < m_rgprp.Size() && "uninitialized required child properties");
 
 	CReqdProp *prp = m_prp;
 	if (FScalarChild(child_index))
@@ -853,7 +942,7 @@ CExpressionHandle::ComputeChildReqdCols
 	}
 
 	// replace required properties of given child
-	m_pdrgprp->Replace(child_index, prp);
+	m_rgprp.Replace(child_index, prp);
 }
 
 
@@ -1112,9 +1201,19 @@ CExpressionHandle::Pstats
 	)
 	const
 {
-	GPOS_ASSERT(child_index < m_pdrgpstat->Size());
+	GPOS_ASSERT(child_index < m_rgpstat.Size());
+
+	IStatistics *stats = m_rgpstat[child_index];
+	if (NULL == stats)
+	{
+		GPOS_ASSERT(FScalarChild(child_index));
+
+		// create dummy stats for scalar children
+		stats = CStatistics::MakeEmptyStats(m_mp);
+		m_rgpstat.Replace(child_index, stats);
+	}
 
-	return (*m_pdrgpstat)[child_index];
+	return stats;
 }
 
 
@@ -1193,9 +1292,9 @@ CExpressionHandle::GetReqdRelationalProps
 	)
 	const
 {
-	GPOS_ASSERT(child_index < m_pdrgprp->Size());
+	GPOS_ASSERT(child_index < m_rgprp.Size());
 
-	CReqdProp *prp = (*m_pdrgprp)[child_index];
+	CReqdProp *prp = m_rgprp[child_index];
 	GPOS_ASSERT(prp->FRelational() && "Unexpected property type");
 
 	return CReqdPropRelational::GetReqdRelationalProps(prp);
@@ -1218,9 +1317,9 @@ CExpressionHandle::Prpp
 	)
 	const
 {
-	GPOS_ASSERT(child_index < m_pdrgprp->Size());
+	GPOS_ASSERT(child_index < m_rgprp.Size());
 
-	CReqdProp *prp = (*m_pdrgprp)[child_index];
+	CReqdProp *prp = m_rgprp[child_index];
 	GPOS_ASSERT(prp->FPlan() && "Unexpected property type");
 
 	return CReqdPropPlan::Prpp(prp);
@@ -0,0 +1,274 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (C) 2020 VMware, Inc. or its affiliates.
+//
+//	@filename:
+//		CExpressionInterner.cpp
+//
+//	@doc:
+//		Implementation of hash-consing table for scalar expression trees
+//---------------------------------------------------------------------------
+
+#include "gpos/base.h"
+
+#include "gpopt/operators/CExpressionInterner.h"
+
+using namespace gpopt;
+
+// number of hash chains in the interning table
+#define GPOPT_INTERNER_HT_BUCKETS	1031
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CExpressionInterner::CExpressionInterner
+//
+//	@doc:
+//		Ctor
+//
+//---------------------------------------------------------------------------
+CExpressionInterner::CExpressionInterner
+	(
+	CMemoryPool *mp
+	)
+	:
+	m_mp(mp),
+	m_phmexpr(NULL),
+	m_ulLookups(0),
+	m_ulHits(0)
+{
+	GPOS_ASSERT(NULL != mp);
+
+	m_phmexpr = GPOS_NEW(m_mp) ExprToExprMap(m_mp, GPOPT_INTERNER_HT_BUCKETS);
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CExpressionInterner::~CExpressionInterner
+//
+//	@doc:
+//		Dtor
+//
+//---------------------------------------------------------------------------
+CExpressionInterner::~CExpressionInterner()
+{
+	m_phmexpr->Release();
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CExpressionInterner::HashValue
+//
+//	@doc:
+//		Hash function; children of a candidate are interned, so their hash
+//		values are cached and the computation is shallow. Children of
+//		operators that are insensitive to input order are hashed in an
+//		order-independent way, as in CExpression::UlHashDedup
+//
+//---------------------------------------------------------------------------
+ULONG
+CExpressionInterner::HashValue
+	(
+	const CExpression *pexpr
+	)
+{
+	return CExpression::UlHashDedup(pexpr);
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CExpressionInterner::Equals
+//
+//	@doc:
+//		Shallow equality; children of interned expressions are shared
+//		instances and are compared by pointer. This mirrors CUtils::Equals,
+//		so children of operators insensitive to input order are compared
+//		as multisets
+//
+//---------------------------------------------------------------------------
+BOOL
+CExpressionInterner::Equals
+	(
+	const CExpression *pexprFst,
+	const CExpression *pexprSnd
+	)
+{
+	if (pexprFst == pexprSnd)
+	{
+		return true;
+	}
+
+	const ULONG arity = pexprFst->Arity();
+	if (arity != pexprSnd->Arity() || !pexprFst->Pop()->Matches(pexprSnd->Pop()))
+	{
+		return false;
+	}
+
+	const BOOL fOrdered = pexprFst->Pop()->FInputOrderSensitive();
+	for (ULONG ul = 0; ul < arity; ul++)
+	{
+		const CExpression *pexprChild = (*pexprFst)[ul];
+		if (fOrdered)
+		{
+			if (pexprChild != (*pexprSnd)[ul])
+			{
+				return false;
+			}
+			continue;
+		}
+
+		ULONG ulOccurrencesFst = 0;
+		ULONG ulOccurrencesSnd = 0;
+		for (ULONG ulPos = 0; ulPos < arity; ulPos++)
+		{
+			ulOccurrencesFst += (pexprChild == (*pexprFst)[ulPos]) ? 1 : 0;
+			ulOccurrencesSnd += (pexprChild == (*pexprSnd)[ulPos]) ? 1 : 0;
+		}
+
+		if (ulOccurrencesFst != ulOccurrencesSnd)
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CExpressionInterner::FInternable
+//
+//	@doc:
+//		Only scalar operators allocated in the interner's pool are shared;
+//		expressions attached to the memo are never interned
+//
+//---------------------------------------------------------------------------
+BOOL
+CExpressionInterner::FInternable
+	(
+	const CExpression *pexpr
+	)
+	const
+{
+	return pexpr->m_mp == m_mp &&
+			NULL == pexpr->Pgexpr() &&
+			pexpr->Pop()->FScalar();
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CExpressionInterner::PexprIntern
+//
+//	@doc:
+//		Return the shared instance of the given expression, interning its
+//		children bottom-up first. For operators insensitive to input order
+//		the shared instance may list its children in a different order
+//		than the given expression
+//
+//---------------------------------------------------------------------------
+CExpression *
+CExpressionInterner::PexprIntern
+	(
+	CExpression *pexpr
+	)
+{
+	GPOS_CHECK_STACK_SIZE;
+	GPOS_ASSERT(NULL != pexpr);
+
+	if (pexpr->FInterned() || !FInternable(pexpr))
+	{
+		return pexpr;
+	}
+
+	m_ulLookups++;
+
+	// intern children first, so that the candidate can be looked up using
+	// a shallow comparison
+	CExpression *pexprCandidate = pexpr;
+	const ULONG arity = pexpr->Arity();
+	if (0 < arity)
+	{
+		CExpressionArray *pdrgpexpr = GPOS_NEW(m_mp) CExpressionArray(m_mp, arity);
+		BOOL fChanged = false;
+		BOOL fChildrenInterned = true;
+		for (ULONG ul = 0; fChildrenInterned && ul < arity; ul++)
+		{
+			CExpression *pexprChild = (*pexpr)[ul];
+			pexprChild->AddRef();
+			CExpression *pexprChildInterned = PexprIntern(pexprChild);
+			pdrgpexpr->Append(pexprChildInterned);
+
+			fChanged = fChanged || (pexprChildInterned != pexprChild);
+			fChildrenInterned = pexprChildInterned->FInterned();
+		}
+
+		if (!fChildrenInterned)
+		{
+			// a child cannot be shared, e.g. it contains a subquery
+			pdrgpexpr->Release();
+			return pexpr;
+		}
+
+		if (fChanged)
+		{
+			COperator *pop = pexpr->Pop();
+			pop->AddRef();
+			pexprCandidate = GPOS_NEW(m_mp) CExpression(m_mp, pop, pdrgpexpr);
+			pexpr->Release();
+		}
+		else
+		{
+			pdrgpexpr->Release();
+		}
+	}
+
+	CExpression *pexprShared = m_phmexpr->Find(pexprCandidate);
+	if (NULL != pexprShared)
+	{
+		m_ulHits++;
+		pexprShared->AddRef();
+		pexprCandidate->Release();
+
+		return pexprShared;
+	}
+
+	pexprCandidate->m_ulHash = CExpression::HashValue(pexprCandidate);
+	pexprCandidate->m_fInterned = true;
+
+	// table holds its own reference
+	pexprCandidate->AddRef();
+#ifdef GPOS_DEBUG
+	BOOL fInserted =
+#endif // GPOS_DEBUG
+		m_phmexpr->Insert(pexprCandidate, pexprCandidate);
+	GPOS_ASSERT(fInserted);
+
+	return pexprCandidate;
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CExpressionInterner::OsPrint
+//
+//	@doc:
+//		Print interning statistics
+//
+//---------------------------------------------------------------------------
+IOstream &
+CExpressionInterner::OsPrint
+	(
+	IOstream &os
+	)
+	const
+{
+	return os
+		<< "[OPT]: Scalar Interning: " << m_ulLookups << " lookups, "
+		<< m_ulHits << " shared, " << Size() << " distinct expressions";
+}
+
+// EOF
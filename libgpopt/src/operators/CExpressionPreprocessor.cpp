@@ -16,6 +16,7 @@
 #include "gpopt/base/CColRefTable.h"
 #include "gpopt/base/CConstraintInterval.h"
 #include "gpos/common/CAutoTimer.h"
+#include "gpos/error/CAutoTrace.h"
 #include "gpos/common/CAutoRef.h"
 #include "gpopt/exception.h"
 
@@ -25,6 +26,7 @@
 #include "gpopt/operators/CNormalizer.h"
 #include "gpopt/operators/CExpressionUtils.h"
 #include "gpopt/operators/CExpressionFactorizer.h"
+#include "gpopt/operators/CExpressionInterner.h"
 #include "gpopt/operators/CExpressionPreprocessor.h"
 #include "gpopt/operators/CScalarNAryJoinPredList.h"
 #include "gpopt/optimizer/COptimizerConfig.h"
@@ -69,10 +71,7 @@ CExpressionPreprocessor::PexprEliminateSelfComparison
 		pdrgpexprChildren->Append(pexprChild);
 	}
 
-	COperator *pop = pexpr->Pop();
-	pop->AddRef();
-
-	return GPOS_NEW(mp) CExpression(mp, pop, pdrgpexprChildren);
+	return CExpressionUtils::PexprRebuild(mp, pexpr, pdrgpexprChildren);
 }
 
 // remove superfluous equality operations
@@ -102,9 +101,7 @@ CExpressionPreprocessor::PexprPruneSuperfluousEquality
 		pdrgpexprChildren->Append(pexprChild);
 	}
 
-	COperator *pop = pexpr->Pop();
-	pop->AddRef();
-	return GPOS_NEW(mp) CExpression(mp, pop, pdrgpexprChildren);
+	return CExpressionUtils::PexprRebuild(mp, pexpr, pdrgpexprChildren);
 }
 
 // an existential subquery whose inner expression is a GbAgg
@@ -163,8 +160,7 @@ CExpressionPreprocessor::PexprTrimExistentialSubqueries
 		return CPredicateUtils::PexprDisjunction(mp, pdrgpexprChildren);
 	}
 
-	pop->AddRef();
-	return GPOS_NEW(mp) CExpression(mp, pop, pdrgpexprChildren);
+	return CExpressionUtils::PexprRebuild(mp, pexpr, pdrgpexprChildren);
 }
 
 
@@ -239,8 +235,7 @@ CExpressionPreprocessor::PexprSimplifyQuantifiedSubqueries
 		pdrgpexprChildren->Append(pexprChild);
 	}
 
-	pop->AddRef();
-	return GPOS_NEW(mp) CExpression(mp, pop, pdrgpexprChildren);
+	return CExpressionUtils::PexprRebuild(mp, pexpr, pdrgpexprChildren);
 }
 
 // preliminary unnesting of scalar subqueries
@@ -342,8 +337,7 @@ CExpressionPreprocessor::PexprUnnestScalarSubqueries
 		pdrgpexprChildren->Append(pexprChild);
 	}
 
-	pop->AddRef();
-	return GPOS_NEW(mp) CExpression(mp, pop, pdrgpexprChildren);
+	return CExpressionUtils::PexprRebuild(mp, pexpr, pdrgpexprChildren);
 }
 
 // an intermediate limit is removed if it has neither row count nor offset
@@ -386,8 +380,7 @@ CExpressionPreprocessor::PexprRemoveSuperfluousLimit
 		pdrgpexprChildren->Append(pexprChild);
 	}
 
-	pop->AddRef();
-	return GPOS_NEW(mp) CExpression(mp, pop, pdrgpexprChildren);
+	return CExpressionUtils::PexprRebuild(mp, pexpr, pdrgpexprChildren);
 }
 
 // distinct is removed from a DQA if it has a max or min agg
@@ -443,8 +436,7 @@ CExpressionPreprocessor::PexprRemoveSuperfluousDistinctInDQA
 		pdrgpexprChildren->Append(pexprChild);
 	}
 
-	pop->AddRef();
-	return GPOS_NEW(mp) CExpression(mp, pop, pdrgpexprChildren);
+	return CExpressionUtils::PexprRebuild(mp, pexpr, pdrgpexprChildren);
 }
 
 //	Remove outer references from order spec inside limit, grouping columns
@@ -810,9 +802,7 @@ CExpressionPreprocessor::PexprConvert2In
 		pdrgpexpr->Append(PexprConvert2In(mp, (*pdrgexprChildren)[ul]));
 	}
 
-	pop->AddRef();
-	return GPOS_NEW(mp) CExpression(mp, pop, pdrgpexpr);
-
+	return CExpressionUtils::PexprRebuild(mp, pexpr, pdrgpexpr);
 }
 
 // collapse cascaded inner and left outer joins into NAry-joins
@@ -828,7 +818,6 @@ CExpressionPreprocessor::PexprCollapseJoins
 	GPOS_ASSERT(NULL != mp);
 	GPOS_ASSERT(NULL != pexpr);
 
-	COperator *pop = pexpr->Pop();
 	const ULONG arity = pexpr->Arity();
 
 	if (CPredicateUtils::FInnerJoin(pexpr) ||
@@ -939,8 +928,7 @@ CExpressionPreprocessor::PexprCollapseJoins
 		pdrgpexprChildren->Append(pexprChild);
 	}
 
-	pop->AddRef();
-	return GPOS_NEW(mp) CExpression(mp, pop, pdrgpexprChildren);
+	return CExpressionUtils::PexprRebuild(mp, pexpr, pdrgpexprChildren);
 }
 
 // collect the children of a join backbone into an array of logical leaf
@@ -1142,8 +1130,7 @@ CExpressionPreprocessor::PexprProjBelowSubquery
 		pdrgpexpr->Append(pexprChild);
 	}
 
-	pop->AddRef();
-	return GPOS_NEW(mp) CExpression(mp, pop, pdrgpexpr);
+	return CExpressionUtils::PexprRebuild(mp, pexpr, pdrgpexpr);
 }
 
 // collapse cascaded union/union all into an NAry union/union all operator
@@ -1329,8 +1316,7 @@ CExpressionPreprocessor::PexprOuterJoinToInnerJoin
 		pdrgpexprChildren->Append(pexprChild);
 	}
 
-	pop->AddRef();
-	return GPOS_NEW(mp) CExpression(mp, pop, pdrgpexprChildren);
+	return CExpressionUtils::PexprRebuild(mp, pexpr, pdrgpexprChildren);
 }
 
 // generate n*(n-1)/2 equality predicates, up to GPOPT_MAX_DERIVED_PREDS, between
@@ -1368,7 +1354,10 @@ CExpressionPreprocessor::PexprConjEqualityPredicates
 				break;
 			}
 
-			pdrgpexpr->Append(CUtils::PexprScalarEqCmp(mp, pcrLeft, pcrRight));
+			// equality predicates of an equivalence class are regenerated at
+			// every level of the tree, share them across levels
+			CExpression *pexprEquality = CUtils::PexprScalarEqCmp(mp, pcrLeft, pcrRight);
+			pdrgpexpr->Append(CUtils::PexprInternScalar(pexprEquality));
 			ulPreds++;
 		}
 	}
@@ -1396,8 +1385,20 @@ CExpressionPreprocessor::FEquivClassFromChild
 		{
 			continue;
 		}
-		CColRefSetArray *pdrgpcrs = pexprChild->DerivePropertyConstraint()->PdrgpcrsEquivClasses();
-		if (pcrs->FContained(pdrgpcrs))
+		CPropConstraint *ppc = pexprChild->DerivePropertyConstraint();
+		if (0 == pcrs->Size())
+		{
+			if (pcrs->FContained(ppc->PdrgpcrsEquivClasses()))
+			{
+				return true;
+			}
+			continue;
+		}
+
+		// classes are disjoint, so only the class of any one of the columns
+		// can contain all of them
+		CColRefSet *pcrsEquivClass = ppc->PcrsEquivClass(pcrs->PcrAny());
+		if (NULL != pcrsEquivClass && pcrsEquivClass->ContainsAll(pcrs))
 		{
 			return true;
 		}
@@ -1573,9 +1574,7 @@ CExpressionPreprocessor::PexprFromConstraintsScalar
 		pdrgpexprChildren->Append(pexprChild);
 	}
 
-	COperator *pop = pexpr->Pop();
-	pop->AddRef();
-	return GPOS_NEW(mp) CExpression(mp, pop, pdrgpexprChildren);
+	return CExpressionUtils::PexprRebuild(mp, pexpr, pdrgpexprChildren);
 }
 
 // Imply new predicates on LOJ's inner child based on constraints derived
@@ -1699,8 +1698,7 @@ CExpressionPreprocessor::PexprOuterJoinInferPredsFromOuterChildToInnerChild
 		pdrgpexpr->Append(pexprChild);
 	}
 
-	pop->AddRef();
-	return GPOS_NEW(mp) CExpression(mp, pop, pdrgpexpr);
+	return CExpressionUtils::PexprRebuild(mp, pexpr, pdrgpexpr);
 }
 
 // additional predicates are generated based on the derived constraint
@@ -1761,10 +1759,7 @@ CExpressionPreprocessor::PexprFromConstraints
 		}
 	}
 
-	COperator *pop = pexpr->Pop();
-	pop->AddRef();
-
-	return GPOS_NEW(mp) CExpression(mp, pop, pdrgpexprChildren);
+	return CExpressionUtils::PexprRebuild(mp, pexpr, pdrgpexprChildren);
 }
 
 // eliminate subtrees that have a zero output cardinality, replacing them
@@ -1805,8 +1800,7 @@ CExpressionPreprocessor::PexprPruneEmptySubtrees
 		pdrgpexpr->Append(pexprChild);
 	}
 
-	pop->AddRef();
-	return GPOS_NEW(mp) CExpression(mp, pop, pdrgpexpr);
+	return CExpressionUtils::PexprRebuild(mp, pexpr, pdrgpexpr);
 }
 
 // eliminate CTE Anchors for CTEs that have zero consumers
@@ -1840,8 +1834,7 @@ CExpressionPreprocessor::PexprRemoveUnusedCTEs
 		pdrgpexpr->Append(pexprChild);
 	}
 
-	pop->AddRef();
-	return GPOS_NEW(mp) CExpression(mp, pop, pdrgpexpr);
+	return CExpressionUtils::PexprRebuild(mp, pexpr, pdrgpexpr);
 }
 
 // for all consumers of the same CTE, collect all selection predicates
@@ -2132,10 +2125,7 @@ CExpressionPreprocessor::PexprPruneUnusedComputedColsRecursive
 		pdrgpexpr->Append(pexprChild);
 	}
 
-	pop->AddRef();
-
-	return GPOS_NEW(mp) CExpression(mp, pop, pdrgpexpr);
-
+	return CExpressionUtils::PexprRebuild(mp, pexpr, pdrgpexpr);
 }
 
 // Construct new Project or GroupBy operator without unused computed
@@ -2273,8 +2263,7 @@ CExpressionPreprocessor::PexprReorderScalarCmpChildren
 		pdrgpexpr->Append(pexprChild);
 	}
 
-	pop->AddRef();
-	return GPOS_NEW(mp) CExpression(mp, pop, pdrgpexpr);
+	return CExpressionUtils::PexprRebuild(mp, pexpr, pdrgpexpr);
 }
 
 // converts IN subquery to a predicate AND an EXISTS subquery
@@ -2450,6 +2439,91 @@ CExpressionPreprocessor::PexprExistWithPredFromINSubq
 	return pexprNew;
 }
 
+// add the nodes of the given expression tree to the given set
+void
+CExpressionPreprocessor::CollectNodes
+	(
+	CExpression *pexpr,
+	ExprPtrSet *phs
+	)
+{
+	GPOS_CHECK_STACK_SIZE;
+
+	if (!phs->Insert(pexpr))
+	{
+		// subtree already collected
+		return;
+	}
+
+	const ULONG arity = pexpr->Arity();
+	for (ULONG ul = 0; ul < arity; ul++)
+	{
+		CollectNodes((*pexpr)[ul], phs);
+	}
+}
+
+// count the nodes of the given expression tree that are not in the given set;
+// nodes found in the set were shared with the input of a rewrite, and so are
+// their subtrees
+ULONG
+CExpressionPreprocessor::UlRewrittenNodes
+	(
+	CExpression *pexpr,
+	ExprPtrSet *phs
+	)
+{
+	GPOS_CHECK_STACK_SIZE;
+
+	if (!phs->Insert(pexpr))
+	{
+		// shared with the input, or already counted
+		return 0;
+	}
+
+	ULONG ulNodes = 1;
+	const ULONG arity = pexpr->Arity();
+	for (ULONG ul = 0; ul < arity; ul++)
+	{
+		ulNodes += UlRewrittenNodes((*pexpr)[ul], phs);
+	}
+
+	return ulNodes;
+}
+
+// print the time spent in a preprocessing step and the number of nodes in its
+// output that are not shared with its input, and restart the given clock
+void
+CExpressionPreprocessor::PrintStepStats
+	(
+	CMemoryPool *mp,
+	CWallClock *pclock,
+	const CHAR *szStep,
+	CExpression *pexprInput,
+	CExpression *pexprOutput
+	)
+{
+	if (!GPOS_FTRACE(EopttracePrintOptimizationStatistics))
+	{
+		return;
+	}
+
+	ULONG ulElapsedUS = pclock->ElapsedUS();
+
+	ExprPtrSet *phs = GPOS_NEW(mp) ExprPtrSet(mp);
+	CollectNodes(pexprInput, phs);
+	ULONG ulRewritten = UlRewrittenNodes(pexprOutput, phs);
+	phs->Release();
+
+	{
+		CAutoTrace at(mp);
+		at.Os() << "[OPT]: Preprocessing step " << szStep << ": "
+				<< ulElapsedUS << " us, " << ulRewritten << " nodes rewritten";
+	}
+
+	// do not charge the reporting to the next step
+	pclock->Restart();
+}
+
 // main driver, pre-processing of input logical expression
 CExpression *
 CExpressionPreprocessor::PexprPreprocess
@@ -2464,54 +2538,67 @@ CExpressionPreprocessor::PexprPreprocess
 
 	CAutoTimer at("\n[OPT]: Expression Preprocessing Time", GPOS_FTRACE(EopttracePrintOptimizationStatistics));
 
+	// clock for reporting the time spent in each step
+	CWallClock clock;
+
 	// (1) remove unused CTE anchors
 	CExpression *pexprNoUnusedCTEs = PexprRemoveUnusedCTEs(mp, pexpr);
 	GPOS_CHECK_ABORT;
+	PrintStepStats(mp, &clock, "(1) remove unused CTE anchors", pexpr, pexprNoUnusedCTEs);
 
 	// (2.a) remove intermediate superfluous limit
 	CExpression *pexprSimplifiedLimit = PexprRemoveSuperfluousLimit(mp, pexprNoUnusedCTEs);
 	GPOS_CHECK_ABORT;
+	PrintStepStats(mp, &clock, "(2.a) remove superfluous limit", pexprNoUnusedCTEs, pexprSimplifiedLimit);
 	pexprNoUnusedCTEs->Release();
 
 	// (2.b) remove intermediate superfluous distinct
 	CExpression *pexprSimplifiedDistinct = PexprRemoveSuperfluousDistinctInDQA(mp, pexprSimplifiedLimit);
 	GPOS_CHECK_ABORT;
+	PrintStepStats(mp, &clock, "(2.b) remove superfluous distinct", pexprSimplifiedLimit, pexprSimplifiedDistinct);
 	pexprSimplifiedLimit->Release();
 
 	// (3) trim unnecessary existential subqueries
 	CExpression * pexprTrimmed = PexprTrimExistentialSubqueries(mp, pexprSimplifiedDistinct);
 	GPOS_CHECK_ABORT;
+	PrintStepStats(mp, &clock, "(3) trim existential subqueries", pexprSimplifiedDistinct, pexprTrimmed);
 	pexprSimplifiedDistinct->Release();
 
 	// (4) collapse cascaded union / union all
 	CExpression *pexprNaryUnionUnionAll = PexprCollapseUnionUnionAll(mp, pexprTrimmed);
 	GPOS_CHECK_ABORT;
+	PrintStepStats(mp, &clock, "(4) collapse union / union all", pexprTrimmed, pexprNaryUnionUnionAll);
 	pexprTrimmed->Release();
 
 	// (5) remove superfluous outer references from the order spec in limits, grouping columns in GbAgg, and
 	// Partition/Order columns in window operators
 	CExpression *pexprOuterRefsEleminated = PexprRemoveSuperfluousOuterRefs(mp, pexprNaryUnionUnionAll);
 	GPOS_CHECK_ABORT;
+	PrintStepStats(mp, &clock, "(5) remove superfluous outer references", pexprNaryUnionUnionAll, pexprOuterRefsEleminated);
 	pexprNaryUnionUnionAll->Release();
 
 	// (6) remove superfluous equality
 	CExpression *pexprTrimmed2 = PexprPruneSuperfluousEquality(mp, pexprOuterRefsEleminated);
 	GPOS_CHECK_ABORT;
+	PrintStepStats(mp, &clock, "(6) remove superfluous equality", pexprOuterRefsEleminated, pexprTrimmed2);
 	pexprOuterRefsEleminated->Release();
 
 	// (7) simplify quantified subqueries
 	CExpression *pexprSubqSimplified = PexprSimplifyQuantifiedSubqueries(mp, pexprTrimmed2);
 	GPOS_CHECK_ABORT;
+	PrintStepStats(mp, &clock, "(7) simplify quantified subqueries", pexprTrimmed2, pexprSubqSimplified);
 	pexprTrimmed2->Release();
 
 	// (8) do preliminary unnesting of scalar subqueries
 	CExpression *pexprSubqUnnested = PexprUnnestScalarSubqueries(mp, pexprSubqSimplified);
 	GPOS_CHECK_ABORT;
+	PrintStepStats(mp, &clock, "(8) unnest scalar subqueries", pexprSubqSimplified, pexprSubqUnnested);
 	pexprSubqSimplified->Release();
 
 	// (9) unnest AND/OR/NOT predicates
 	CExpression *pexprUnnested = CExpressionUtils::PexprUnnest(mp, pexprSubqUnnested);
 	GPOS_CHECK_ABORT;
+	PrintStepStats(mp, &clock, "(9) unnest AND/OR/NOT predicates", pexprSubqUnnested, pexprUnnested);
 	pexprSubqUnnested->Release();
 
 	CExpression *pexprConvert2In = pexprUnnested;
@@ -2521,95 +2608,119 @@ CExpressionPreprocessor::PexprPreprocess
 		// (9.5) ensure predicates are array IN or NOT IN where applicable
 		pexprConvert2In = PexprConvert2In(mp, pexprUnnested);
 		GPOS_CHECK_ABORT;
+		PrintStepStats(mp, &clock, "(9.5) convert to array IN / NOT IN", pexprUnnested, pexprConvert2In);
 		pexprUnnested->Release();
 	}
 
 	// (10) infer predicates from constraints
 	CExpression *pexprInferredPreds = PexprInferPredicates(mp, pexprConvert2In);
 	GPOS_CHECK_ABORT;
+	PrintStepStats(mp, &clock, "(10) infer predicates", pexprConvert2In, pexprInferredPreds);
 	pexprConvert2In->Release();
 
 	// (11) eliminate self comparisons
 	CExpression *pexprSelfCompEliminated = PexprEliminateSelfComparison(mp, pexprInferredPreds);
 	GPOS_CHECK_ABORT;
+	PrintStepStats(mp, &clock, "(11) eliminate self comparisons", pexprInferredPreds, pexprSelfCompEliminated);
 	pexprInferredPreds->Release();
 
 	// (12) remove duplicate AND/OR children
 	CExpression *pexprDeduped = CExpressionUtils::PexprDedupChildren(mp, pexprSelfCompEliminated);
 	GPOS_CHECK_ABORT;
+	PrintStepStats(mp, &clock, "(12) remove duplicate AND/OR children", pexprSelfCompEliminated, pexprDeduped);
 	pexprSelfCompEliminated->Release();
 
 	// (13) factorize common expressions
 	CExpression *pexprFactorized = CExpressionFactorizer::PexprFactorize(mp, pexprDeduped);
 	GPOS_CHECK_ABORT;
+	PrintStepStats(mp, &clock, "(13) factorize common expressions", pexprDeduped, pexprFactorized);
 	pexprDeduped->Release();
 
 	// (14) infer filters out of components of disjunctive filters
 	CExpression *pexprPrefiltersExtracted =
 			CExpressionFactorizer::PexprExtractInferredFilters(mp, pexprFactorized);
 	GPOS_CHECK_ABORT;
+	PrintStepStats(mp, &clock, "(14) extract inferred filters", pexprFactorized, pexprPrefiltersExtracted);
 	pexprFactorized->Release();
 
 	// (15) pre-process window functions
 	CExpression *pexprWindowPreprocessed = CWindowPreprocessor::PexprPreprocess(mp, pexprPrefiltersExtracted);
 	GPOS_CHECK_ABORT;
+	PrintStepStats(mp, &clock, "(15) preprocess window functions", pexprPrefiltersExtracted, pexprWindowPreprocessed);
 	pexprPrefiltersExtracted->Release();
 
 	// (16) eliminate unused computed columns
 	CExpression *pexprNoUnusedPrEl = PexprPruneUnusedComputedCols(mp, pexprWindowPreprocessed, pcrsOutputAndOrderCols);
 	GPOS_CHECK_ABORT;
+	PrintStepStats(mp, &clock, "(16) prune unused computed columns", pexprWindowPreprocessed, pexprNoUnusedPrEl);
 	pexprWindowPreprocessed->Release();
 
 	// (17) normalize expression
 	CExpression *pexprNormalized1 = CNormalizer::PexprNormalize(mp, pexprNoUnusedPrEl);
 	GPOS_CHECK_ABORT;
+	PrintStepStats(mp, &clock, "(17) normalize", pexprNoUnusedPrEl, pexprNormalized1);
 	pexprNoUnusedPrEl->Release();
 
 	// (18) transform outer join into inner join whenever possible
 	CExpression *pexprLOJToIJ = PexprOuterJoinToInnerJoin(mp, pexprNormalized1);
 	GPOS_CHECK_ABORT;
+	PrintStepStats(mp, &clock, "(18) outer join to inner join", pexprNormalized1, pexprLOJToIJ);
 	pexprNormalized1->Release();
 
 	// (19) collapse cascaded inner and left outer joins
 	CExpression *pexprCollapsed = PexprCollapseJoins(mp, pexprLOJToIJ);
 	GPOS_CHECK_ABORT;
+	PrintStepStats(mp, &clock, "(19) collapse joins", pexprLOJToIJ, pexprCollapsed);
 	pexprLOJToIJ->Release();
 
 	// (20) after transforming outer joins to inner joins, we may be able to generate more predicates from constraints
 	CExpression *pexprWithPreds = PexprAddPredicatesFromConstraints(mp, pexprCollapsed);
 	GPOS_CHECK_ABORT;
+	PrintStepStats(mp, &clock, "(20) add predicates from constraints", pexprCollapsed, pexprWithPreds);
 	pexprCollapsed->Release();
 
 	// (21) eliminate empty subtrees
 	CExpression *pexprPruned = PexprPruneEmptySubtrees(mp, pexprWithPreds);
 	GPOS_CHECK_ABORT;
+	PrintStepStats(mp, &clock, "(21) prune empty subtrees", pexprWithPreds, pexprPruned);
 	pexprWithPreds->Release();
 
 	// (22) collapse cascade of projects
 	CExpression *pexprCollapsedProjects = PexprCollapseProjects(mp, pexprPruned);
 	GPOS_CHECK_ABORT;
+	PrintStepStats(mp, &clock, "(22) collapse projects", pexprPruned, pexprCollapsedProjects);
 	pexprPruned->Release();
 
 	// (23) insert dummy project when the scalar subquery is under a project and returns an outer reference
 	CExpression *pexprSubquery = PexprProjBelowSubquery(mp, pexprCollapsedProjects, false /* fUnderPrList */);
 	GPOS_CHECK_ABORT;
+	PrintStepStats(mp, &clock, "(23) project below subquery", pexprCollapsedProjects, pexprSubquery);
 	pexprCollapsedProjects->Release();
 
 	// (24) reorder the children of scalar cmp operator to ensure that left child is scalar ident and right child is scalar const
 	CExpression *pexrReorderedScalarCmpChildren = PexprReorderScalarCmpChildren(mp, pexprSubquery);
 	GPOS_CHECK_ABORT;
+	PrintStepStats(mp, &clock, "(24) reorder scalar comparisons", pexprSubquery, pexrReorderedScalarCmpChildren);
 	pexprSubquery->Release();
 
 	// (25) rewrite IN subquery to EXIST subquery with a predicate
 	CExpression *pexprExistWithPredFromINSubq = PexprExistWithPredFromINSubq(mp, pexrReorderedScalarCmpChildren);
 	GPOS_CHECK_ABORT;
+	PrintStepStats(mp, &clock, "(25) IN subquery to EXISTS", pexrReorderedScalarCmpChildren, pexprExistWithPredFromINSubq);
 	pexrReorderedScalarCmpChildren->Release();
 
 	// (26) normalize expression again
 	CExpression *pexprNormalized2 = CNormalizer::PexprNormalize(mp, pexprExistWithPredFromINSubq);
 	GPOS_CHECK_ABORT;
+	PrintStepStats(mp, &clock, "(26) normalize again", pexprExistWithPredFromINSubq, pexprNormalized2);
 	pexprExistWithPredFromINSubq->Release();
 
+	if (GPOS_FTRACE(EopttracePrintOptimizationStatistics))
+	{
+		CAutoTrace atInterner(mp);
+		COptCtxt::PoctxtFromTLS()->Pinterner()->OsPrint(atInterner.Os());
+	}
+
 	return pexprNormalized2;
 }
 
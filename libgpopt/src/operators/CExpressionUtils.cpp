@@ -176,11 +176,9 @@ CExpressionUtils::PexprUnnest
 		return GPOS_NEW(mp) CExpression(mp, pop, pdrgpexpr);
 	}
 
-	COperator *pop = pexpr->Pop();
 	CExpressionArray *pdrgpexpr = PdrgpexprUnnestChildren(mp, pexpr);
-	pop->AddRef();
 
-	return GPOS_NEW(mp) CExpression(mp, pop, pdrgpexpr);
+	return PexprRebuild(mp, pexpr, pdrgpexpr);
 }
 
 
@@ -313,9 +311,56 @@ CExpressionUtils::PexprDedupChildren
 		}
 	}
 
+	return PexprRebuild(mp, pexpr, pdrgpexprChildren);
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CExpressionUtils::PexprRebuild
+//
+//	@doc:
+//		Combine the operator of the given expression with the given children,
+//		which are the results of processing the children of the expression.
+//		If a rewrite left all children in place, the expression is shared with
+//		the result instead of being copied, so that unchanged subtrees are not
+//		re-allocated by every rewrite pass. Takes ownership of the children
+//
+//---------------------------------------------------------------------------
+CExpression *
+CExpressionUtils::PexprRebuild
+	(
+	CMemoryPool *mp,
+	CExpression *pexpr,
+	CExpressionArray *pdrgpexprChildren
+	)
+{
+	GPOS_ASSERT(NULL != pexpr);
+	GPOS_ASSERT(NULL != pdrgpexprChildren);
 
 	COperator *pop = pexpr->Pop();
+
+	// CTE consumers derive their properties from the producer registered in
+	// the CTE info, which preprocessing may replace; always copy them so that
+	// properties derived against an earlier producer are not carried over
+	const ULONG arity = pexpr->Arity();
+	BOOL fUnchanged = (COperator::EopLogicalCTEConsumer != pop->Eopid() &&
+					   arity == pdrgpexprChildren->Size());
+	for (ULONG ul = 0; fUnchanged && ul < arity; ul++)
+	{
+		fUnchanged = ((*pexpr)[ul] == (*pdrgpexprChildren)[ul]);
+	}
+
+	if (fUnchanged)
+	{
+		pdrgpexprChildren->Release();
+		pexpr->AddRef();
+
+		return pexpr;
+	}
+
 	pop->AddRef();
+
 	return GPOS_NEW(mp) CExpression(mp, pop, pdrgpexprChildren);
 }
 
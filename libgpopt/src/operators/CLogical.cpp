@@ -18,6 +18,7 @@
 #include "gpopt/base/CColRef.h"
 #include "gpopt/base/CColRefSet.h"
 #include "gpopt/base/CColRefSetIter.h"
+#include "gpopt/base/CColRefUnionFind.h"
 #include "gpopt/base/CConstraintConjunction.h"
 #include "gpopt/base/CConstraintInterval.h"
 #include "gpopt/base/CDrvdPropRelational.h"
@@ -657,7 +658,9 @@ CLogical::PpcDeriveConstraintFromPredicates
 	CExpressionHandle &exprhdl
 	)
 {
-	CColRefSetArray *pdrgpcrs = GPOS_NEW(mp) CColRefSetArray(mp);
+	// equivalence classes of all children are merged, which is done once at
+	// the end rather than once per child; n-ary joins may have many children
+	CColRefUnionFind *pcruf = GPOS_NEW(mp) CColRefUnionFind(mp);
 
 	CConstraintArray *pdrgpcnstr = GPOS_NEW(mp) CConstraintArray(mp);
 
@@ -684,9 +687,7 @@ CLogical::PpcDeriveConstraintFromPredicates
 				pdrgpcnstr->Append(pcnstr);
 
 				// merge with the equivalence classes we have so far
-				CColRefSetArray *pdrgpcrsMerged = CUtils::PdrgpcrsMergeEquivClasses(mp, pdrgpcrs, pdrgpcrsChild);
-				pdrgpcrs->Release();
-				pdrgpcrs = pdrgpcrsMerged;
+				pcruf->AddEquivClasses(pdrgpcrsChild);
 			}
 			CRefCount::SafeRelease(pdrgpcrsChild);
 		}
@@ -694,13 +695,9 @@ CLogical::PpcDeriveConstraintFromPredicates
 		{
 			CPropConstraint *ppc = exprhdl.DerivePropertyConstraint(ul);
 
-			// equivalence classes coming from child
-			CColRefSetArray *pdrgpcrsChild = ppc->PdrgpcrsEquivClasses();
-
-			// merge with the equivalence classes we have so far
-			CColRefSetArray *pdrgpcrsMerged = CUtils::PdrgpcrsMergeEquivClasses(mp, pdrgpcrs, pdrgpcrsChild);
-			pdrgpcrs->Release();
-			pdrgpcrs = pdrgpcrsMerged;
+			// merge equivalence classes coming from child with the
+			// equivalence classes we have so far
+			pcruf->AddEquivClasses(ppc->PdrgpcrsEquivClasses());
 
 			// constraint coming from child
 			CConstraint *pcnstr = ppc->Pcnstr();
@@ -714,6 +711,9 @@ CLogical::PpcDeriveConstraintFromPredicates
 
 	CConstraint *pcnstrNew = CConstraint::PcnstrConjunction(mp, pdrgpcnstr);
 
+	CColRefSetArray *pdrgpcrs = pcruf->PdrgpcrsEquivClasses(mp);
+	pcruf->Release();
+
 	return GPOS_NEW(mp) CPropConstraint(mp, pdrgpcrs, pcnstrNew);
 }
 
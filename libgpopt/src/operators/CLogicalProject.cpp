@@ -327,6 +327,39 @@ CLogicalProject::DeriveMaxCard
 	return exprhdl.DeriveMaxCard(0);
 }
 
+//---------------------------------------------------------------------------
+//	@function:
+//		CLogicalProject::PcrsStat
+//
+//	@doc:
+//		Compute required stat columns of the n-th child. Statistics of the
+//		projected columns do not depend on the histograms of the columns
+//		used by the project list, so in demand-driven mode only the columns
+//		required from the project are requested from its child
+//
+//---------------------------------------------------------------------------
+CColRefSet *
+CLogicalProject::PcrsStat
+	(
+	CMemoryPool *mp,
+	CExpressionHandle &exprhdl,
+	CColRefSet *pcrsInput,
+	ULONG child_index
+	)
+	const
+{
+	if (!GPOS_FTRACE(EopttraceDemandDrivenStats))
+	{
+		return CLogicalUnary::PcrsStat(mp, exprhdl, pcrsInput, child_index);
+	}
+
+	CColRefSet *pcrsUsed = GPOS_NEW(mp) CColRefSet(mp);
+	CColRefSet *pcrsStat = PcrsReqdChildStats(mp, exprhdl, pcrsInput, pcrsUsed, child_index);
+	pcrsUsed->Release();
+
+	return pcrsStat;
+}
+
 //---------------------------------------------------------------------------
 //	@function:
 //		CLogicalProject::PxfsCandidates
@@ -15,6 +15,7 @@
 #include "gpopt/base/CColRefSetIter.h"
 #include "gpopt/base/CColRefTable.h"
 #include "gpopt/base/COptCtxt.h"
+#include "gpopt/mdcache/CStatsCache.h"
 
 #include "gpopt/operators/CExpression.h"
 #include "gpopt/operators/CExpressionHandle.h"
@@ -190,7 +191,7 @@ CLogicalSelect::PstatsDerive
 	CPredicateUtils::SeparateOuterRefs(mp, pexprPredicate, outer_refs, &local_expr, &expr_with_outer_refs);
 	pexprPredicate->Release();
 
-	IStatistics *stats = CFilterStatsProcessor::MakeStatsFilterForScalarExpr(mp, exprhdl, child_stats, local_expr, expr_with_outer_refs, stats_ctxt);
+	IStatistics *stats = CStatsCache::PstatsDeriveFilter(mp, exprhdl, child_stats, local_expr, expr_with_outer_refs, stats_ctxt);
 	local_expr->Release();
 	expr_with_outer_refs->Release();
 
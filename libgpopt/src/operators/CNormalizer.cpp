@@ -13,6 +13,7 @@
 #include "gpos/memory/CAutoMemoryPool.h"
 
 #include "gpopt/base/CUtils.h"
+#include "gpopt/operators/CExpressionUtils.h"
 #include "gpopt/operators/CNormalizer.h"
 #include "gpopt/operators/CPredicateUtils.h"
 #include "gpopt/operators/CScalarNAryJoinPredList.h"
@@ -176,10 +177,7 @@ CNormalizer::PexprRecursiveNormalize
 		pdrgpexpr->Append(pexprChild);
 	}
 
-	COperator *pop = pexpr->Pop();
-	pop->AddRef();
-
-	return GPOS_NEW(mp) CExpression(mp, pop, pdrgpexpr);
+	return CExpressionUtils::PexprRebuild(mp, pexpr, pdrgpexpr);
 }
 
 
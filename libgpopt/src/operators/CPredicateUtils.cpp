@@ -15,6 +15,7 @@
 #include "gpopt/base/CCastUtils.h"
 #include "gpopt/base/CColRefTable.h"
 #include "gpopt/base/CColRefSetIter.h"
+#include "gpopt/base/CColRefUnionFind.h"
 #include "gpopt/base/CConstraintInterval.h"
 #include "gpopt/base/CConstraintDisjunction.h"
 
@@ -2373,8 +2374,17 @@ CPredicateUtils::PexprRemoveImpliedConjuncts
 	CExpressionHandle &exprhdl
 	)
 {
-	// extract equivalence classes from logical children
-	CColRefSetArray *pdrgpcrs = CUtils::PdrgpcrsCopyChildEquivClasses(mp, exprhdl);
+	// extract equivalence classes from logical children; they are kept in a
+	// union-find structure that is updated in place as conjuncts are added
+	CColRefUnionFind *pcruf = GPOS_NEW(mp) CColRefUnionFind(mp);
+	const ULONG arity = exprhdl.Arity();
+	for (ULONG ul = 0; ul < arity; ul++)
+	{
+		if (!exprhdl.FScalarChild(ul))
+		{
+			pcruf->AddEquivClasses(exprhdl.DerivePropertyConstraint(ul)->PdrgpcrsEquivClasses());
+		}
+	}
 
 	// extract all the conjuncts
 	CExpressionArray *pdrgpexprConjuncts = PdrgpexprConjuncts(mp, pexprScalar);
@@ -2383,7 +2393,7 @@ CPredicateUtils::PexprRemoveImpliedConjuncts
 	for (ULONG ul = 0; ul < size; ul++)
 	{
 		CExpression *pexprConj = (*pdrgpexprConjuncts)[ul];
-		if (FCheckPredicateImplication(pexprConj) && FImpliedPredicate(pexprConj, pdrgpcrs))
+		if (FCheckPredicateImplication(pexprConj) && pcruf->FSameClass(pexprConj->DeriveUsedColumns()))
 		{
 			// skip implied conjunct
 			continue;
@@ -2395,10 +2405,8 @@ CPredicateUtils::PexprRemoveImpliedConjuncts
 		CRefCount::SafeRelease(pcnstr);
 		if (NULL != pdrgpcrsConj)
 		{
-			CColRefSetArray *pdrgpcrsMerged = CUtils::PdrgpcrsMergeEquivClasses(mp, pdrgpcrs, pdrgpcrsConj);
-			pdrgpcrs->Release();
+			pcruf->AddEquivClasses(pdrgpcrsConj);
 			pdrgpcrsConj->Release();
-			pdrgpcrs = pdrgpcrsMerged;
 		}
 
 		// add conjunct to new conjuncts array
@@ -2407,7 +2415,7 @@ CPredicateUtils::PexprRemoveImpliedConjuncts
 	}
 
 	pdrgpexprConjuncts->Release();
-	pdrgpcrs->Release();
+	pcruf->Release();
 
 	return PexprConjunction(mp, pdrgpexprNewConjuncts);
 }
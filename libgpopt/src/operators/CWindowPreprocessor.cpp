@@ -12,6 +12,7 @@
 #include "gpos/base.h"
 
 #include "gpopt/base/CUtils.h"
+#include "gpopt/operators/CExpressionUtils.h"
 #include "gpopt/operators/CPredicateUtils.h"
 #include "gpopt/operators/ops.h"
 #include "gpopt/operators/CWindowPreprocessor.h"
@@ -446,8 +447,7 @@ CWindowPreprocessor::PexprPreprocess
 		pdrgpexprChildren->Append(pexprChild);
 	}
 
-	pop->AddRef();
-	return GPOS_NEW(mp) CExpression(mp, pop, pdrgpexprChildren);
+	return CExpressionUtils::PexprRebuild(mp, pexpr, pdrgpexprChildren);
 }
 
 // EOF
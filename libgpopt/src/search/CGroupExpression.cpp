@@ -15,6 +15,7 @@
 #include "gpos/task/CWorker.h"
 
 #include "gpopt/base/CUtils.h"
+#include "gpopt/base/CDrvdPropCtxtPlan.h"
 #include "gpopt/base/COptimizationContext.h"
 #include "gpopt/operators/ops.h"
 #include "gpopt/search/CGroupExpression.h"
@@ -67,7 +68,10 @@ CGroupExpression::CGroupExpression
 	m_estate(estUnexplored),
 	m_eol(EolLow),
 	m_ppartialplancostmap(NULL),
-	m_ecirculardependency(ecdDefault)
+	m_pdpplancostctxtmap(NULL),
+	m_pcostedctxtmap(NULL),
+	m_ecirculardependency(ecdDefault),
+	m_psht(NULL)
 {
 	GPOS_ASSERT(NULL != pop);
 	GPOS_ASSERT(NULL != pdrgpgroup);
@@ -83,12 +87,31 @@ CGroupExpression::CGroupExpression
 		GPOS_ASSERT(m_pdrgpgroupSorted->IsSorted());
 	}
 
-	m_ppartialplancostmap = GPOS_NEW(mp) PartialPlanToCostMap(mp);
+	if (GPOS_FTRACE(EopttraceDisableLazyCostTables))
+	{
+		m_ppartialplancostmap = GPOS_NEW(mp) PartialPlanToCostMap(mp);
+		InitCostContexts();
+	}
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CGroupExpression::InitCostContexts
+//
+//	@doc:
+//		Create the cost contexts hash table
+//
+//---------------------------------------------------------------------------
+void
+CGroupExpression::InitCostContexts()
+{
+	GPOS_ASSERT(NULL == m_psht);
 
-	// initialize cost contexts hash table
-	m_sht.Init
+	m_psht = GPOS_NEW(m_mp) ShtCC();
+	m_psht->Init
 		(
-		mp,
+		m_mp,
 		GPOPT_COSTCTXT_HT_BUCKETS,
 		GPOS_OFFSET(CCostContext, m_link),
 		GPOS_OFFSET(CCostContext, m_poc),
@@ -96,6 +119,8 @@ CGroupExpression::CGroupExpression
 		COptimizationContext::HashValue,
 		COptimizationContext::Equals
 		);
+
+	COptCtxt::PoctxtFromTLS()->IncrementCounter(COptCtxt::EocCostTablesCreated);
 }
 
 
@@ -112,12 +137,15 @@ CGroupExpression::~CGroupExpression()
 	if (this != &(CGroupExpression::m_gexprInvalid))
 	{
 		CleanupContexts();
+		GPOS_DELETE(m_psht);
 
 		m_pop->Release();
 		m_pdrgpgroup->Release();
 
 		CRefCount::SafeRelease(m_pdrgpgroupSorted);
-		m_ppartialplancostmap->Release();
+		CRefCount::SafeRelease(m_ppartialplancostmap);
+		CRefCount::SafeRelease(m_pdpplancostctxtmap);
+		CRefCount::SafeRelease(m_pcostedctxtmap);
 	}
 }
 
@@ -133,11 +161,16 @@ CGroupExpression::~CGroupExpression()
 void
 CGroupExpression::CleanupContexts()
 {
+	if (NULL == m_psht)
+	{
+		return;
+	}
+
 	// need to suspend cancellation while cleaning up
 	{
 		CAutoSuspendAbort asa;
 
-		ShtIter shtit(m_sht);
+		ShtIter shtit(*m_psht);
 		CCostContext *pcc = NULL;
 		while (NULL != pcc || shtit.Advance())
 		{
@@ -326,6 +359,11 @@ CGroupExpression::FCostContextExists
 {
 	GPOS_ASSERT(NULL != poc);
 
+	if (NULL == m_psht)
+	{
+		return false;
+	}
+
 	// lookup context based on required properties
 	CCostContext *pccFound = NULL;
 	{
@@ -367,6 +405,12 @@ CGroupExpression::PccRemove
 	)
 {
 	GPOS_ASSERT(NULL != poc);
+
+	if (NULL == m_psht)
+	{
+		return NULL;
+	}
+
 	ShtAcc shta(Sht(), poc);
 	CCostContext *pccFound = shta.Find();
 	while (NULL != pccFound)
@@ -491,8 +535,45 @@ CGroupExpression::PccComputeCost
 		fValid = pcc->IsValid(mp);
 		if (fValid)
 		{
-			CCost cost = CostCompute(mp, pcc);
-			pcc->SetCost(cost);
+			// contexts requesting different plan properties from the same
+			// child plans often differ only in properties that do not
+			// affect cost, e.g. an order request on a hash aggregate
+			BOOL fReuseCost = !GPOS_FTRACE(EopttraceDisableCostReuse);
+			CCostContext *pccEquivalent = NULL;
+			if (fReuseCost)
+			{
+				pccEquivalent = PccLookupCostEquivalent(pcc);
+			}
+
+			if (NULL != pccEquivalent)
+			{
+				pcc->CopyCost(pccEquivalent);
+				COptCtxt::PoctxtFromTLS()->IncrementCounter(COptCtxt::EocCostComputationsSaved);
+			}
+			else if (fReuseCost)
+			{
+				// contexts that are not equivalent may still pass equal
+				// inputs to the cost model, e.g. when their required
+				// columns differ but have the same width
+				pcc->DeriveCostInputs(mp);
+				CCostContext *pccEqualInputs = PccLookupCostInputs(pcc);
+				if (NULL != pccEqualInputs)
+				{
+					pcc->SetCost(pccEqualInputs->Cost());
+					COptCtxt::PoctxtFromTLS()->IncrementCounter(COptCtxt::EocCostResultsReused);
+				}
+				else
+				{
+					CCost cost = CostCompute(mp, pcc);
+					pcc->SetCost(cost);
+				}
+				InsertCostedContext(pcc);
+			}
+			else
+			{
+				CCost cost = CostCompute(mp, pcc);
+				pcc->SetCost(cost);
+			}
 		}
 		GPOS_ASSERT_IMP(COptCtxt::FAllEnforcersEnabled(), fValid &&
 				"Cost context carries an invalid plan");
@@ -542,6 +623,11 @@ CGroupExpression::CostLowerBound
 	{
 		pccChild->AddRef();
 	}
+	if (NULL == m_ppartialplancostmap)
+	{
+		m_ppartialplancostmap = GPOS_NEW(m_mp) PartialPlanToCostMap(m_mp);
+	}
+
 	CPartialPlan *ppp = GPOS_NEW(mp) CPartialPlan(this, prppInput, pccChild, child_index);
 	CCost *pcostLowerBound = m_ppartialplancostmap->Find(ppp);
 	if (NULL != pcostLowerBound)
@@ -673,6 +759,11 @@ CGroupExpression::PccLookup
 {
 	GPOS_ASSERT(NULL != poc);
 
+	if (NULL == m_psht)
+	{
+		return NULL;
+	}
+
 	ShtAcc shta(Sht(), poc);
 	CCostContext *pccFound = shta.Find();
 	while (NULL != pccFound)
@@ -706,6 +797,10 @@ CGroupExpression::PdrgpccLookupAll
 {
 	GPOS_ASSERT(NULL != poc);
 	CCostContextArray *pdrgpcc = GPOS_NEW(mp) CCostContextArray(mp);
+	if (NULL == m_psht)
+	{
+		return pdrgpcc;
+	}
 
 	CCostContext *pccFound = NULL;
 	BOOL fValid = false;
@@ -748,6 +843,11 @@ CGroupExpression::PccInsert
 	CCostContext *pcc
 	)
 {
+	if (NULL == m_psht)
+	{
+		InitCostContexts();
+	}
+
 	// HERE BE DRAGONS
 	// See comment in CCache::InsertEntry
 	COptimizationContext *const poc = pcc->Poc();
@@ -769,6 +869,343 @@ CGroupExpression::PccInsert
 }
 
 
+//---------------------------------------------------------------------------
+//	@function:
+//		CGroupExpression::HashCostContexts
+//
+//	@doc:
+//		Hash function of an array of child cost contexts
+//
+//---------------------------------------------------------------------------
+ULONG
+CGroupExpression::HashCostContexts
+	(
+	const CCostContextArray *pdrgpcc
+	)
+{
+	ULONG ulHash = 0;
+	const ULONG size = pdrgpcc->Size();
+	for (ULONG ul = 0; ul < size; ul++)
+	{
+		ulHash = gpos::CombineHashes(ulHash, gpos::HashPtr<CCostContext>((*pdrgpcc)[ul]));
+	}
+
+	return ulHash;
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CGroupExpression::EqualCostContexts
+//
+//	@doc:
+//		Equality function of arrays of child cost contexts
+//
+//---------------------------------------------------------------------------
+BOOL
+CGroupExpression::EqualCostContexts
+	(
+	const CCostContextArray *pdrgpccFst,
+	const CCostContextArray *pdrgpccSnd
+	)
+{
+	const ULONG size = pdrgpccFst->Size();
+	if (size != pdrgpccSnd->Size())
+	{
+		return false;
+	}
+
+	for (ULONG ul = 0; ul < size; ul++)
+	{
+		if ((*pdrgpccFst)[ul] != (*pdrgpccSnd)[ul])
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CGroupExpression::PdrgpccChildBest
+//
+//	@doc:
+//		Return the best cost contexts of the children of the given cost
+//		context, which determine the plan carried by the cost context.
+//		Return NULL if the plan properties derived for the given cost context
+//		also depend on its own requirements, i.e. for CTE consumers and for
+//		operators that expect partition selectors; such contexts share
+//		neither plan properties nor costs
+//
+//---------------------------------------------------------------------------
+CCostContextArray *
+CGroupExpression::PdrgpccChildBest
+	(
+	CCostContext *pcc
+	)
+	const
+{
+	GPOS_ASSERT(this == pcc->Pgexpr());
+
+	ULONG scan_id = 0;
+	if (COperator::EopPhysicalCTEConsumer == m_pop->Eopid() ||
+		CDrvdPropCtxtPlan::FExpectsPartitionSelectors(m_pop, &scan_id))
+	{
+		return NULL;
+	}
+
+	COptimizationContextArray *pdrgpoc = pcc->Pdrgpoc();
+	GPOS_ASSERT(NULL != pdrgpoc);
+
+	const ULONG size = pdrgpoc->Size();
+	CCostContextArray *pdrgpcc = GPOS_NEW(m_mp) CCostContextArray(m_mp, size);
+	for (ULONG ul = 0; ul < size; ul++)
+	{
+		CCostContext *pccChild = (*pdrgpoc)[ul]->PccBest();
+		if (NULL == pccChild)
+		{
+			pdrgpcc->Release();
+			return NULL;
+		}
+
+		pccChild->AddRef();
+		pdrgpcc->Append(pccChild);
+	}
+
+	return pdrgpcc;
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CGroupExpression::PdrgpccCostedLookup
+//
+//	@doc:
+//		Lookup the costed contexts carrying the same child plans as the
+//		given one; the returned array is not add-ref'd
+//
+//---------------------------------------------------------------------------
+CCostContextArray *
+CGroupExpression::PdrgpccCostedLookup
+	(
+	CCostContext *pcc
+	)
+{
+	if (NULL == m_pcostedctxtmap)
+	{
+		return NULL;
+	}
+
+	CCostContextArray *pdrgpcc = PdrgpccChildBest(pcc);
+	if (NULL == pdrgpcc)
+	{
+		return NULL;
+	}
+
+	CCostContextArray *pdrgpccCosted = m_pcostedctxtmap->Find(pdrgpcc);
+	pdrgpcc->Release();
+
+	return pdrgpccCosted;
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CGroupExpression::PccLookupCostEquivalent
+//
+//	@doc:
+//		Lookup a costed context with the same child plans as the given one
+//		whose required properties are equivalent for costing
+//
+//---------------------------------------------------------------------------
+CCostContext *
+CGroupExpression::PccLookupCostEquivalent
+	(
+	CCostContext *pcc
+	)
+{
+	CCostContextArray *pdrgpccCosted = PdrgpccCostedLookup(pcc);
+	if (NULL == pdrgpccCosted)
+	{
+		return NULL;
+	}
+
+	const ULONG size = pdrgpccCosted->Size();
+	for (ULONG ul = 0; ul < size; ul++)
+	{
+		CCostContext *pccCosted = (*pdrgpccCosted)[ul];
+		if (CCostContext::FEqualForCosting(pcc, pccCosted))
+		{
+			return pccCosted;
+		}
+	}
+
+	return NULL;
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CGroupExpression::PccLookupCostInputs
+//
+//	@doc:
+//		Lookup a costed context with the same child plans as the given one
+//		that passed the same stats, rows and width to the cost model; this
+//		catches contexts whose required columns differ in columns that do
+//		not change the row width, or whose stats requirements differ
+//		without leading to new stats
+//
+//---------------------------------------------------------------------------
+CCostContext *
+CGroupExpression::PccLookupCostInputs
+	(
+	CCostContext *pcc
+	)
+{
+	GPOS_ASSERT(pcc->FCostInputsDerived());
+
+	CCostContextArray *pdrgpccCosted = PdrgpccCostedLookup(pcc);
+	if (NULL == pdrgpccCosted)
+	{
+		return NULL;
+	}
+
+	const ULONG size = pdrgpccCosted->Size();
+	for (ULONG ul = 0; ul < size; ul++)
+	{
+		CCostContext *pccCosted = (*pdrgpccCosted)[ul];
+		if (CCostContext::FEqualCostInputs(pcc, pccCosted))
+		{
+			return pccCosted;
+		}
+	}
+
+	return NULL;
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CGroupExpression::InsertCostedContext
+//
+//	@doc:
+//		Remember a costed context under the child plans it carries
+//
+//---------------------------------------------------------------------------
+void
+CGroupExpression::InsertCostedContext
+	(
+	CCostContext *pcc
+	)
+{
+	GPOS_ASSERT(!pcc->FPruned());
+
+	CCostContextArray *pdrgpcc = PdrgpccChildBest(pcc);
+	if (NULL == pdrgpcc)
+	{
+		return;
+	}
+
+	if (NULL == m_pcostedctxtmap)
+	{
+		m_pcostedctxtmap = GPOS_NEW(m_mp) CostContextsToCostContextsMap(m_mp);
+	}
+
+	CCostContextArray *pdrgpccCosted = m_pcostedctxtmap->Find(pdrgpcc);
+	if (NULL == pdrgpccCosted)
+	{
+		pdrgpccCosted = GPOS_NEW(m_mp) CCostContextArray(m_mp);
+#ifdef GPOS_DEBUG
+		BOOL fInserted =
+#endif // GPOS_DEBUG
+			m_pcostedctxtmap->Insert(pdrgpcc, pdrgpccCosted);
+		GPOS_ASSERT(fInserted);
+	}
+	else
+	{
+		pdrgpcc->Release();
+	}
+
+	pcc->AddRef();
+	pdrgpccCosted->Append(pcc);
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CGroupExpression::PdpplanLookup
+//
+//	@doc:
+//		Lookup plan properties derived for a cost context whose children
+//		have the same best plans as the children of the given one; the
+//		returned properties are not add-ref'd
+//
+//---------------------------------------------------------------------------
+CDrvdPropPlan *
+CGroupExpression::PdpplanLookup
+	(
+	CCostContext *pcc
+	)
+{
+	if (NULL == m_pdpplancostctxtmap)
+	{
+		return NULL;
+	}
+
+	CCostContextArray *pdrgpcc = PdrgpccChildBest(pcc);
+	if (NULL == pdrgpcc)
+	{
+		return NULL;
+	}
+
+	CDrvdPropPlan *pdpplan = m_pdpplancostctxtmap->Find(pdrgpcc);
+	pdrgpcc->Release();
+
+	return pdpplan;
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CGroupExpression::CachePdpplan
+//
+//	@doc:
+//		Cache completely derived plan properties of the given cost context
+//
+//---------------------------------------------------------------------------
+void
+CGroupExpression::CachePdpplan
+	(
+	CCostContext *pcc,
+	CDrvdPropPlan *pdpplan
+	)
+{
+	GPOS_ASSERT(NULL != pdpplan);
+	GPOS_ASSERT(pdpplan->FComplete());
+
+	CCostContextArray *pdrgpcc = PdrgpccChildBest(pcc);
+	if (NULL == pdrgpcc)
+	{
+		return;
+	}
+
+	if (NULL == m_pdpplancostctxtmap)
+	{
+		m_pdpplancostctxtmap = GPOS_NEW(m_mp) CostContextsToDrvdPropPlanMap(m_mp);
+	}
+
+	pdpplan->AddRef();
+	if (!m_pdpplancostctxtmap->Insert(pdrgpcc, pdpplan))
+	{
+		// properties for the same child plans are already cached
+		pdrgpcc->Release();
+		pdpplan->Release();
+	}
+}
+
+
 //---------------------------------------------------------------------------
 //	@function:
 //		CGroupExpression::PreprocessTransform
@@ -879,16 +1316,28 @@ CGroupExpression::Transform
 	// extract memo bindings to apply xform
 	CBinding binding;
 	CXformContext *pxfctxt = GPOS_NEW(mp) CXformContext(mp);
+	BOOL fStaticBinding = !GPOS_FTRACE(EopttraceDisableStaticBinding);
+	BOOL fBlockDuplicates = !GPOS_FTRACE(EopttraceDisableDuplicateBindingBlocking);
 
 	CExpression *pexprPattern = pxform->PexprPattern();
-	CExpression *pexpr = binding.PexprExtract(mp, this, pexprPattern , NULL);
+	CExpression *pexpr = fStaticBinding ?
+							pxform->PexprExtractBinding(mp, this, NULL) :
+							binding.PexprExtract(mp, this, pexprPattern, NULL);
 	while (NULL != pexpr)
 	{
 		++(*pulNumberOfBindings);
-		ULONG ulNumResults = pxfres->Pdrgpexpr()->Size();
-		pxform->Transform(pxfctxt, pxfres, pexpr);
-		ulNumResults = pxfres->Pdrgpexpr()->Size() - ulNumResults;
-		PrintXform(mp, pxform, pexpr, pxfres, ulNumResults);
+		if (fBlockDuplicates && pxform->FDuplicateBinding(pexpr))
+		{
+			// results of binding are already in the memo
+			COptCtxt::PoctxtFromTLS()->IncrementCounter(COptCtxt::EocDuplicateBindingsBlocked);
+		}
+		else
+		{
+			ULONG ulNumResults = pxfres->Pdrgpexpr()->Size();
+			pxform->Transform(pxfctxt, pxfres, pexpr);
+			ulNumResults = pxfres->Pdrgpexpr()->Size() - ulNumResults;
+			PrintXform(mp, pxform, pexpr, pxfres, ulNumResults);
+		}
 
 		if (pxform->IsApplyOnce() ||
 			(0 < pxfres->Pdrgpexpr()->Size() &&
@@ -900,7 +1349,9 @@ CGroupExpression::Transform
 		}
 
 		CExpression *pexprLast = pexpr;
-		pexpr = binding.PexprExtract(mp, this, pexprPattern, pexprLast);
+		pexpr = fStaticBinding ?
+					pxform->PexprExtractBinding(mp, this, pexprLast) :
+					binding.PexprExtract(mp, this, pexprPattern, pexprLast);
 
 		// release last extracted expression
 		pexprLast->Release();
@@ -1152,7 +1603,7 @@ CGroupExpression::OsPrintCostContexts
 	const CHAR *szPrefix
 	)
 {
-	if (Pop()->FPhysical() && GPOS_FTRACE(EopttracePrintOptimizationContext))
+	if (Pop()->FPhysical() && NULL != m_psht && GPOS_FTRACE(EopttracePrintOptimizationContext))
 	{
 		// print cost contexts
 		os << szPrefix << szPrefix << "Cost Ctxts:" << std::endl;
@@ -415,6 +415,62 @@ CJobGroupExpressionOptimization::DerivePrevChildProps
 }
 
 
+//---------------------------------------------------------------------------
+//	@function:
+//		CJobGroupExpressionOptimization::FPruneOptimizedChildren
+//
+//	@doc:
+//		Check if job can be early terminated once all children have been
+//		optimized, using the best plan of the last optimized relational
+//		child; this is done before enforcers are added and the group
+//		expression is costed, and covers operators with a single relational
+//		child which are never checked while scheduling children
+//
+//---------------------------------------------------------------------------
+BOOL
+CJobGroupExpressionOptimization::FPruneOptimizedChildren
+	(
+	CSchedulerContext *psc
+	)
+{
+	if (0 == m_ulArity)
+	{
+		// job was already checked for pruning before optimizing children
+		return false;
+	}
+
+	// find last optimized relational child
+	ULONG child_index = m_pexprhdlPlan->UlLastOptimizedChildIndex();
+	while (gpos::ulong_max != child_index && (*m_pgexpr)[child_index]->FScalar())
+	{
+		child_index = m_pexprhdlPlan->UlPreviousOptimizedChildIndex(child_index);
+	}
+
+	if (gpos::ulong_max == child_index)
+	{
+		return false;
+	}
+
+	COptimizationContext *pocChild =
+		(*m_pgexpr)[child_index]->PocLookupBest(psc->GetGlobalMemoryPool(), psc->Peng()->UlSearchStages(), m_pexprhdlPlan->Prpp(child_index));
+	if (NULL == pocChild || NULL == pocChild->PccBest())
+	{
+		// failed to optimize child, this is detected when adding enforcers
+		return false;
+	}
+
+	CCost costLowerBound(GPOPT_INVALID_COST);
+	if (!psc->Peng()->FSafeToPrune(m_pgexpr, m_poc->Prpp(), pocChild->PccBest(), child_index, &costLowerBound))
+	{
+		return false;
+	}
+
+	(void) m_pgexpr->PccComputeCost(psc->GetGlobalMemoryPool(), m_poc, m_ulOptReq, NULL /*pdrgpoc*/, true /*fPruned*/, costLowerBound);
+
+	return true;
+}
+
+
 //---------------------------------------------------------------------------
 //	@function:
 //		CJobGroupExpressionOptimization::ComputeCurrentChildRequirements
@@ -594,6 +650,13 @@ CJobGroupExpressionOptimization::EevtAddEnforcers
 	// get a job pointer
 	CJobGroupExpressionOptimization *pjgeo = PjConvert(pjOwner);
 
+	// check if job can be early terminated without adding enforcers or costing
+	if (pjgeo->FPruneOptimizedChildren(psc))
+	{
+		pjgeo->Cleanup();
+		return eevFinalized;
+	}
+
 	// build child contexts array
 	GPOS_ASSERT(NULL == pjgeo->m_pdrgpoc);
 	pjgeo->m_pdrgpoc = psc->Peng()->PdrgpocChildren(psc->GetGlobalMemoryPool(), *pjgeo->m_pexprhdlPlan);
@@ -0,0 +1,128 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (C) 2020 VMware, Inc. or its affiliates.
+//
+//	@filename:
+//		CStaticBinding.cpp
+//
+//	@doc:
+//		Implementation of the non-template parts of static pattern binding
+//---------------------------------------------------------------------------
+
+#include "gpos/base.h"
+
+#include "gpopt/search/CGroupProxy.h"
+#include "gpopt/search/CStaticBinding.h"
+
+using namespace gpopt;
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CStaticBinding::PgexprNext
+//
+//	@doc:
+//		Move cursor within a group (initialize if NULL); as in CBinding,
+//		only logical expressions of non-scalar groups are bound
+//
+//---------------------------------------------------------------------------
+CGroupExpression *
+CStaticBinding::PgexprNext
+	(
+	CGroup *pgroup,
+	CGroupExpression *pgexpr
+	)
+{
+	CGroupProxy gp(pgroup);
+
+	if (pgroup->FScalar())
+	{
+		// initialize
+		if (NULL == pgexpr)
+		{
+			return gp.PgexprFirst();
+		}
+
+		return gp.PgexprNext(pgexpr);
+	}
+
+	return gp.PgexprNextLogical(pgexpr);
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CStaticBinding::PexprFinalize
+//
+//	@doc:
+//		Assemble the binding of the given group expression
+//
+//---------------------------------------------------------------------------
+CExpression *
+CStaticBinding::PexprFinalize
+	(
+	CMemoryPool *mp,
+	CGroupExpression *pgexpr,
+	CExpressionArray *pdrgpexpr
+	)
+{
+	COperator *pop = pgexpr->Pop();
+	pop->AddRef();
+
+	return GPOS_NEW(mp) CExpression(mp, pop, pgexpr, pdrgpexpr, NULL /*input_stats*/);
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CStaticBinding::PexprLeaf
+//
+//	@doc:
+//		Binding of a leaf pattern to the given group expression; no deep
+//		extraction for leaf patterns
+//
+//---------------------------------------------------------------------------
+CExpression *
+CStaticBinding::PexprLeaf
+	(
+	CMemoryPool *mp,
+	CGroupExpression *pgexpr
+	)
+{
+	GPOS_CHECK_ABORT;
+
+	COperator *pop = pgexpr->Pop();
+	pop->AddRef();
+
+	return GPOS_NEW(mp) CExpression(mp, pop, pgexpr);
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CStaticBinding::PexprLeafGroup
+//
+//	@doc:
+//		Binding of a leaf pattern to a group; leaf patterns do not iterate
+//		on group expressions, so a group yields a single binding
+//
+//---------------------------------------------------------------------------
+CExpression *
+CStaticBinding::PexprLeafGroup
+	(
+	CMemoryPool *mp,
+	CGroup *pgroup,
+	CExpression *pexprLast
+	)
+{
+	GPOS_ASSERT(NULL != pgroup);
+
+	if (NULL != pexprLast)
+	{
+		// if a leaf was extracted before, then group is exhausted
+		return NULL;
+	}
+
+	CGroupExpression *pgexpr = PgexprNext(pgroup, NULL);
+	GPOS_ASSERT(NULL != pgexpr);
+
+	return PexprLeaf(mp, pgexpr);
+}
+
+// EOF
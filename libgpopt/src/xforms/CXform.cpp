@@ -11,6 +11,7 @@
 
 #include "gpos/base.h"
 #include "gpopt/operators/CExpressionHandle.h"
+#include "gpopt/search/CBinding.h"
 #include "gpopt/xforms/CXform.h"
 
 
@@ -77,6 +78,30 @@ CXform::OsPrint
 }
 
 
+//---------------------------------------------------------------------------
+//	@function:
+//		CXform::PexprExtractBinding
+//
+//	@doc:
+//		Extract the next binding of the pattern tree from the given group
+//		expression
+//
+//---------------------------------------------------------------------------
+CExpression *
+CXform::PexprExtractBinding
+	(
+	CMemoryPool *mp,
+	CGroupExpression *pgexpr,
+	CExpression *pexprLast
+	)
+	const
+{
+	CBinding binding;
+
+	return binding.PexprExtract(mp, pgexpr, m_pexpr, pexprLast);
+}
+
+
 #ifdef GPOS_DEBUG
 
 //---------------------------------------------------------------------------
@@ -39,17 +39,7 @@ CXformExpandNAryJoinDPv2::CXformExpandNAryJoinDPv2
 	CMemoryPool *mp
 	)
 	:
-	CXformExploration
-		(
-		 // pattern
-		GPOS_NEW(mp) CExpression
-					(
-					mp,
-					GPOS_NEW(mp) CLogicalNAryJoin(mp),
-					GPOS_NEW(mp) CExpression(mp, GPOS_NEW(mp) CPatternMultiLeaf(mp)),
-					GPOS_NEW(mp) CExpression(mp, GPOS_NEW(mp) CPatternTree(mp))
-					)
-		)
+	CXformStaticPattern<CXformExploration, CPatternExpandNAryJoinDPv2>(mp)
 {}
 
 
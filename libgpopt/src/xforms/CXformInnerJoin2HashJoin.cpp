@@ -32,18 +32,7 @@ CXformInnerJoin2HashJoin::CXformInnerJoin2HashJoin
 	CMemoryPool *mp
 	)
 	:
-	// pattern
-	CXformImplementation
-		(
-		GPOS_NEW(mp) CExpression
-					(
-					mp, 
-					GPOS_NEW(mp) CLogicalInnerJoin(mp),
-					GPOS_NEW(mp) CExpression(mp, GPOS_NEW(mp) CPatternLeaf(mp)), // left child
-					GPOS_NEW(mp) CExpression(mp, GPOS_NEW(mp) CPatternLeaf(mp)), // right child
-					GPOS_NEW(mp) CExpression(mp, GPOS_NEW(mp) CPatternTree(mp))  // predicate
-					) 
-		)
+	CXformStaticPattern<CXformImplementation, CPatternInnerJoin2HashJoin>(mp)
 {}
 
 
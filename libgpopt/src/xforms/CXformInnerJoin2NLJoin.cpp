@@ -32,18 +32,7 @@ CXformInnerJoin2NLJoin::CXformInnerJoin2NLJoin
 	CMemoryPool *mp
 	)
 	:
-	// pattern
-	CXformImplementation
-		(
-		GPOS_NEW(mp) CExpression
-					(
-					mp, 
-					GPOS_NEW(mp) CLogicalInnerJoin(mp),
-					GPOS_NEW(mp) CExpression(mp, GPOS_NEW(mp) CPatternLeaf(mp)), // left child
-					GPOS_NEW(mp) CExpression(mp, GPOS_NEW(mp) CPatternLeaf(mp)), // right child
-					GPOS_NEW(mp) CExpression(mp, GPOS_NEW(mp) CPatternLeaf(mp))  // predicate
-					)
-		)
+	CXformStaticPattern<CXformImplementation, CPatternInnerJoin2NLJoin>(mp)
 {}
 
 
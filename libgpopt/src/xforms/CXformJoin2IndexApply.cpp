@@ -207,6 +207,21 @@ CXformJoin2IndexApply::CreateHomogeneousBtreeIndexApplyAlternatives
 	CMDAccessor *md_accessor = COptCtxt::PoctxtFromTLS()->Pmda();
 	const IMDRelation *pmdrel = md_accessor->RetrieveRel(ptabdescInner->MDId());
 
+	// indexes defined on the same partition range share their part constraint
+	const CMDIndexApplicabilityMap *md_index_map = NULL;
+	CPartConstraint **rgppartcnstrRange = NULL;
+	ULONG ulRanges = 0;
+	if (NULL != popDynamicGet)
+	{
+		md_index_map = md_accessor->RetrieveIndexApplicabilityMap(pmdrel);
+		ulRanges = md_index_map->RangeCount();
+		rgppartcnstrRange = GPOS_NEW_ARRAY(mp, CPartConstraint*, ulRanges);
+		for (ULONG ul = 0; ul < ulRanges; ul++)
+		{
+			rgppartcnstrRange[ul] = NULL;
+		}
+	}
+
 	for (ULONG ul = 0; ul < ulIndices; ul++)
 	{
 		IMDId *pmdidIndex = pmdrel->IndexMDidAt(ul);
@@ -215,14 +230,20 @@ CXformJoin2IndexApply::CreateHomogeneousBtreeIndexApplyAlternatives
 		CPartConstraint *ppartcnstrIndex = NULL;
 		if (NULL != popDynamicGet)
 		{
-			ppartcnstrIndex = CUtils::PpartcnstrFromMDPartCnstr
-									(
-									mp,
-									COptCtxt::PoctxtFromTLS()->Pmda(),
-									popDynamicGet->PdrgpdrgpcrPart(),
-									pmdindex->MDPartConstraint(),
-									popDynamicGet->PdrgpcrOutput()
-									);
+			const ULONG ulRange = md_index_map->RangeIdAt(ul);
+			if (NULL == rgppartcnstrRange[ulRange])
+			{
+				rgppartcnstrRange[ulRange] = CUtils::PpartcnstrFromMDPartCnstr
+											(
+											mp,
+											md_accessor,
+											popDynamicGet->PdrgpdrgpcrPart(),
+											pmdindex->MDPartConstraint(),
+											popDynamicGet->PdrgpcrOutput()
+											);
+			}
+			ppartcnstrIndex = rgppartcnstrRange[ulRange];
+			ppartcnstrIndex->AddRef();
 		}
 		CreateAlternativesForBtreeIndex
 			(
@@ -242,6 +263,12 @@ CXformJoin2IndexApply::CreateHomogeneousBtreeIndexApplyAlternatives
 			);
 	}
 
+	for (ULONG ul = 0; ul < ulRanges; ul++)
+	{
+		CRefCount::SafeRelease(rgppartcnstrRange[ul]);
+	}
+	GPOS_DELETE_ARRAY(rgppartcnstrRange);
+
 	//clean-up
 	pdrgpexpr->Release();
 }
@@ -35,29 +35,7 @@ CXformJoinAssociativity::CXformJoinAssociativity
 	CMemoryPool *mp
 	)
 	:
-	CXformExploration
-		(
-		 // pattern
-		GPOS_NEW(mp) CExpression
-					(
-					mp,
-					GPOS_NEW(mp) CLogicalInnerJoin(mp),
-					GPOS_NEW(mp) CExpression  // left child is a join tree
-					 	 (
-					 	 mp,
-					 	 GPOS_NEW(mp) CLogicalInnerJoin(mp),
-					 	 GPOS_NEW(mp) CExpression(mp, GPOS_NEW(mp) CPatternLeaf(mp)), // left child
-					 	 GPOS_NEW(mp) CExpression(mp, GPOS_NEW(mp) CPatternLeaf(mp)), // right child
-					 	 GPOS_NEW(mp) CExpression(mp, GPOS_NEW(mp) CPatternTree(mp)) // predicate
-					 	 ),
-					GPOS_NEW(mp) CExpression // right child is a pattern leaf
-								(
-								mp,
-								GPOS_NEW(mp) CPatternLeaf(mp)
-								),
-					GPOS_NEW(mp) CExpression(mp, GPOS_NEW(mp) CPatternTree(mp)) // join predicate
-					)
-		)
+	CXformStaticPattern<CXformExploration, CPatternJoinAssociativity>(mp)
 {}
 
 
@@ -187,6 +165,39 @@ CXformJoinAssociativity::Exfp
 }
 
 
+//---------------------------------------------------------------------------
+//	@function:
+//		CXformJoinAssociativity::FDuplicateBinding
+//
+//	@doc:
+//		Check if the binding undoes an earlier associativity step:
+//		applying the xform to (RS)T produces (RT)S, where the lower join
+//		(RT) is an intermediate group expression with the same origin as
+//		the root. Applying the xform to (RT)S binding that same lower join
+//		produces (RS)T again, which is the origin itself; such bindings
+//		are skipped instead of being detected as duplicates by the memo
+//
+//---------------------------------------------------------------------------
+BOOL
+CXformJoinAssociativity::FDuplicateBinding
+	(
+	CExpression *pexpr
+	)
+	const
+{
+	CGroupExpression *pgexpr = pexpr->Pgexpr();
+	CGroupExpression *pgexprLeft = (*pexpr)[0]->Pgexpr();
+	GPOS_ASSERT(NULL != pgexpr);
+	GPOS_ASSERT(NULL != pgexprLeft);
+
+	return
+		ExfJoinAssociativity == pgexpr->ExfidOrigin() &&
+		ExfJoinAssociativity == pgexprLeft->ExfidOrigin() &&
+		pgexprLeft->FIntermediate() &&
+		pgexprLeft->PgexprOrigin() == pgexpr->PgexprOrigin();
+}
+
+
 //	Associativity Transform: (RS)T ==> (RT)S
 //	Example:
 //	Input Expression:
@@ -31,18 +31,7 @@ CXformJoinCommutativity::CXformJoinCommutativity
 	CMemoryPool *mp
 	)
 	:
-	CXformExploration
-		(
-		 // pattern
-		GPOS_NEW(mp) CExpression
-					(
-					mp,
-					GPOS_NEW(mp) CLogicalInnerJoin(mp),
-					GPOS_NEW(mp) CExpression(mp, GPOS_NEW(mp) CPatternLeaf(mp)), // left child
-					GPOS_NEW(mp) CExpression(mp, GPOS_NEW(mp) CPatternLeaf(mp)), // right child
-					GPOS_NEW(mp) CExpression(mp, GPOS_NEW(mp) CPatternLeaf(mp))
-					) // predicate
-		)
+	CXformStaticPattern<CXformExploration, CPatternJoinCommutativity>(mp)
 {}
 
 
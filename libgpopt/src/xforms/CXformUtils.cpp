@@ -4065,24 +4065,61 @@ CXformUtils::PdrgpdrgppartdigCandidates
 	)
 {
 	SPartDynamicIndexGetInfoArrays *pdrgpdrgppartdig = GPOS_NEW(mp) SPartDynamicIndexGetInfoArrays(mp);
-	const ULONG ulIndexes = pmdrel->IndexCount();
+
+	// partial indexes grouped by the partition range they are defined on;
+	// indexes handled in other functions are not looked at
+	const CMDIndexApplicabilityMap *md_index_map = md_accessor->RetrieveIndexApplicabilityMap(pmdrel);
+	const ULONG ulPartialIndexes = md_index_map->PartialIndexCount();
+	const ULONG ulRanges = md_index_map->RangeCount();
+
+	// part constraint of each range, translated on first use, and whether
+	// the range was found to be unusable; as the covered parts only grow, a
+	// range overlapping them stays unusable for all its remaining indexes
+	CPartConstraint **rgppartcnstrRange = GPOS_NEW_ARRAY(mp, CPartConstraint*, ulRanges);
+	BOOL *rgfRangeRejected = GPOS_NEW_ARRAY(mp, BOOL, ulRanges);
+	for (ULONG ul = 0; ul < ulRanges; ul++)
+	{
+		rgppartcnstrRange[ul] = NULL;
+		rgfRangeRejected[ul] = false;
+	}
 
 	// currently covered parts
 	CPartConstraint *ppartcnstrCovered = NULL;
 	SPartDynamicIndexGetInfoArray *pdrgppartdig = GPOS_NEW(mp) SPartDynamicIndexGetInfoArray(mp);
 
-	for (ULONG ul = 0; ul < ulIndexes; ul++)
+	for (ULONG ul = 0; ul < ulPartialIndexes; ul++)
 	{
-		const IMDIndex *pmdindex = md_accessor->RetrieveIndex(pmdrel->IndexMDidAt(ul));
+		const ULONG ulIndexPos = md_index_map->PartialIndexPosAt(ul);
+		const ULONG ulRange = md_index_map->RangeIdAt(ulIndexPos);
+		if (rgfRangeRejected[ulRange])
+		{
+			continue;
+		}
+
+		const IMDIndex *pmdindex = md_accessor->RetrieveIndex(pmdrel->IndexMDidAt(ulIndexPos));
+		GPOS_ASSERT(pmdrel->IsPartialIndex(pmdindex->MDId()));
+
+		if (!CXformUtils::FIndexApplicable(mp, pmdindex, pmdrel, pdrgpcrOutput, pcrsReqd, pcrsScalarExpr, IMDIndex::EmdindBtree /*emdindtype*/))
+		{
+			// index does not apply to predicate
+			continue;
+		}
 
-		if (!CXformUtils::FIndexApplicable(mp, pmdindex, pmdrel, pdrgpcrOutput, pcrsReqd, pcrsScalarExpr, IMDIndex::EmdindBtree /*emdindtype*/) ||
-			!pmdrel->IsPartialIndex(pmdindex->MDId()))
+		if (NULL == rgppartcnstrRange[ulRange])
 		{
-			// not a partial index (handled in another function), or index does not apply to predicate
+			rgppartcnstrRange[ulRange] = CUtils::PpartcnstrFromMDPartCnstr(mp, md_accessor, pdrgpdrgpcrPartKey, pmdindex->MDPartConstraint(), pdrgpcrOutput);
+		}
+		CPartConstraint *ppartcnstr = rgppartcnstrRange[ulRange];
+
+		if (NULL == ppartcnstr->PcnstrCombined() ||
+			(NULL != ppartcnstrCovered && ppartcnstrCovered->FOverlap(mp, ppartcnstr)))
+		{
+			// unsupported constraint type: do not produce a partial index scan as we cannot reason about it;
+			// or index overlaps with already considered indexes: skip
+			rgfRangeRejected[ulRange] = true;
 			continue;
 		}
 
-		CPartConstraint *ppartcnstr = CUtils::PpartcnstrFromMDPartCnstr(mp, md_accessor, pdrgpdrgpcrPartKey, pmdindex->MDPartConstraint(), pdrgpcrOutput);
 		CExpressionArray *pdrgpexprIndex = GPOS_NEW(mp) CExpressionArray(mp);
 		CExpressionArray *pdrgpexprResidual = GPOS_NEW(mp) CExpressionArray(mp);
 		CPartConstraint *ppartcnstrNewlyCovered = PpartcnstrUpdateCovered
@@ -4102,7 +4139,6 @@ CXformUtils::PdrgpdrgppartdigCandidates
 
 		if (NULL == ppartcnstrNewlyCovered)
 		{
-			ppartcnstr->Release();
 			pdrgpexprResidual->Release();
 			pdrgpexprIndex->Release();
 			continue;
@@ -4111,9 +4147,17 @@ CXformUtils::PdrgpdrgppartdigCandidates
 		CRefCount::SafeRelease(ppartcnstrCovered);
 		ppartcnstrCovered = ppartcnstrNewlyCovered;
 
+		ppartcnstr->AddRef();
 		pdrgppartdig->Append(GPOS_NEW(mp) SPartDynamicIndexGetInfo(pmdindex, ppartcnstr, pdrgpexprIndex, pdrgpexprResidual));
 	}
 
+	for (ULONG ul = 0; ul < ulRanges; ul++)
+	{
+		CRefCount::SafeRelease(rgppartcnstrRange[ul]);
+	}
+	GPOS_DELETE_ARRAY(rgppartcnstrRange);
+	GPOS_DELETE_ARRAY(rgfRangeRejected);
+
 	if (NULL != ppartcnstrCovered && !ppartcnstrRel->FEquivalent(ppartcnstrCovered))
 	{
 		pdrgpexprScalar->AddRef();
@@ -4140,7 +4184,8 @@ CXformUtils::PdrgpdrgppartdigCandidates
 //
 //	@doc:
 //		Compute the newly covered part constraint based on the old covered part
-//		constraint and the given part constraint
+//		constraint and the given part constraint, which the caller has checked
+//		to be supported and not to overlap the old covered part constraint
 //
 //---------------------------------------------------------------------------
 CPartConstraint *
@@ -4159,17 +4204,7 @@ CXformUtils::PpartcnstrUpdateCovered
 	CColRefSet *pcrsAcceptedOuterRefs
 	)
 {
-	if (NULL == ppartcnstr->PcnstrCombined())
-	{
-		// unsupported constraint type: do not produce a partial index scan as we cannot reason about it
-		return NULL;
-	}
-
-	if (NULL != ppartcnstrCovered && ppartcnstrCovered->FOverlap(mp, ppartcnstr))
-	{
-		// index overlaps with already considered indexes: skip
-		return NULL;
-	}
+	GPOS_ASSERT(NULL != ppartcnstr->PcnstrCombined());
 
 	CColRefArray *pdrgpcrIndexCols = PdrgpcrIndexKeys(mp, pdrgpcrOutput, pmdindex, pmdrel);
 	CPredicateUtils::ExtractIndexPredicates
@@ -57,6 +57,8 @@ struct gpos_exec_params
 struct gpos_init_params
 {
 	bool (*abort_requested) (void);	/* callback to report abort requests */
+	unsigned int num_workers;		/* number of pool worker threads; 0 runs
+									 * scheduled tasks on the waiting thread */
 };
 
 /* initialize GPOS memory pool, worker pool and message repository */
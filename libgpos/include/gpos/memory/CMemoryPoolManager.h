@@ -19,6 +19,7 @@
 #include "gpos/common/CSyncHashtableAccessByIter.h"
 #include "gpos/common/CSyncHashtableIter.h"
 #include "gpos/memory/CMemoryPool.h"
+#include "gpos/sync/CMutex.h"
 
 
 
@@ -61,6 +62,10 @@ namespace gpos
 			// hash table to maintain created pools
 			CSyncHashtable<CMemoryPool, ULONG_PTR> *m_ht_all_pools;
 
+			// lock protecting the hash table and the internal memory pool
+			// against concurrent creation of pools by pool workers
+			CMutex m_mutex;
+
 			// global instance
 			static CMemoryPoolManager *m_memory_pool_mgr;
 
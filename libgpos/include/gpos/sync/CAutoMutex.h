@@ -0,0 +1,63 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (C) 2020 VMware, Inc. or its affiliates.
+//
+//	@filename:
+//		CAutoMutex.h
+//
+//	@doc:
+//		Scoped lock on a mutex
+//---------------------------------------------------------------------------
+#ifndef GPOS_CAutoMutex_H
+#define GPOS_CAutoMutex_H
+
+#include "gpos/common/CStackObject.h"
+#include "gpos/sync/CMutex.h"
+
+namespace gpos
+{
+	//---------------------------------------------------------------------------
+	//	@class:
+	//		CAutoMutex
+	//
+	//	@doc:
+	//		Acquires the given mutex on construction and releases it when going
+	//		out of scope, including when an exception is raised
+	//
+	//---------------------------------------------------------------------------
+	class CAutoMutex : public CStackObject
+	{
+		private:
+
+			// mutex
+			CMutex &m_mutex;
+
+			// no copy ctor
+			CAutoMutex(const CAutoMutex&);
+
+		public:
+
+			// ctor
+			explicit
+			CAutoMutex
+				(
+				CMutex &mutex
+				)
+				:
+				m_mutex(mutex)
+			{
+				m_mutex.Lock();
+			}
+
+			// dtor
+			~CAutoMutex()
+			{
+				m_mutex.Unlock();
+			}
+
+	}; // class CAutoMutex
+}
+
+#endif // !GPOS_CAutoMutex_H
+
+// EOF
@@ -0,0 +1,70 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (C) 2020 VMware, Inc. or its affiliates.
+//
+//	@filename:
+//		CEvent.h
+//
+//	@doc:
+//		Condition variable bound to a mutex
+//---------------------------------------------------------------------------
+#ifndef GPOS_CEvent_H
+#define GPOS_CEvent_H
+
+#include <pthread.h>
+
+#include "gpos/types.h"
+#include "gpos/sync/CMutex.h"
+
+namespace gpos
+{
+	//---------------------------------------------------------------------------
+	//	@class:
+	//		CEvent
+	//
+	//	@doc:
+	//		Wrapper of a pthread condition variable; all operations must be
+	//		called while holding the mutex the event is bound to. Waits may
+	//		return spuriously, so callers re-check their condition in a loop.
+	//
+	//---------------------------------------------------------------------------
+	class CEvent
+	{
+		private:
+
+			// mutex protecting the condition
+			CMutex *m_mutex;
+
+			// pthread condition variable
+			pthread_cond_t m_cond;
+
+			// no copy ctor
+			CEvent(const CEvent&);
+
+		public:
+
+			// ctor
+			explicit
+			CEvent(CMutex *mutex);
+
+			// dtor
+			~CEvent();
+
+			// wait until signaled
+			void Wait();
+
+			// wait until signaled or the timeout expired; returns false on timeout
+			BOOL TimedWait(ULONG timeout_ms);
+
+			// wake up one waiter
+			void Signal();
+
+			// wake up all waiters
+			void Broadcast();
+
+	}; // class CEvent
+}
+
+#endif // !GPOS_CEvent_H
+
+// EOF
@@ -0,0 +1,63 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (C) 2020 VMware, Inc. or its affiliates.
+//
+//	@filename:
+//		CMutex.h
+//
+//	@doc:
+//		Mutual exclusion lock
+//---------------------------------------------------------------------------
+#ifndef GPOS_CMutex_H
+#define GPOS_CMutex_H
+
+#include <pthread.h>
+
+#include "gpos/types.h"
+
+namespace gpos
+{
+	//---------------------------------------------------------------------------
+	//	@class:
+	//		CMutex
+	//
+	//	@doc:
+	//		Non-recursive mutex wrapping a pthread mutex; used by the few
+	//		structures that are shared between the workers of the worker pool
+	//
+	//---------------------------------------------------------------------------
+	class CMutex
+	{
+		friend class CEvent;
+
+		private:
+
+			// pthread mutex
+			pthread_mutex_t m_mutex;
+
+			// no copy ctor
+			CMutex(const CMutex&);
+
+		public:
+
+			// ctor
+			CMutex();
+
+			// dtor
+			~CMutex();
+
+			// acquire lock
+			void Lock();
+
+			// attempt to acquire lock without blocking
+			BOOL TryLock();
+
+			// release lock
+			void Unlock();
+
+	}; // class CMutex
+}
+
+#endif // !GPOS_CMutex_H
+
+// EOF
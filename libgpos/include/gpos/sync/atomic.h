@@ -0,0 +1,40 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (C) 2020 VMware, Inc. or its affiliates.
+//
+//	@filename:
+//		atomic.h
+//
+//	@doc:
+//		Atomic operations on words shared between workers
+//---------------------------------------------------------------------------
+#ifndef GPOS_atomic_H
+#define GPOS_atomic_H
+
+#include "gpos/types.h"
+
+namespace gpos
+{
+	// add given value to a variable and return its previous value
+	inline
+	ULONG_PTR ExchangeAddUlongPtrWithInt
+		(
+		volatile ULONG_PTR *value,
+		INT inc
+		)
+	{
+		return __sync_fetch_and_add(value, inc);
+	}
+
+	// full memory barrier; orders the publication of a result with the store
+	// of the flag announcing it
+	inline
+	void MemoryBarrier()
+	{
+		__sync_synchronize();
+	}
+}
+
+#endif // !GPOS_atomic_H
+
+// EOF
@@ -29,6 +29,12 @@ namespace gpos
 	//		ATP operations are not thread-safe; only one worker can use each ATP
 	//		object.
 	//
+	//		Scheduled tasks run on the workers of the worker pool; Wait and
+	//		WaitAny join them, executing queued tasks on the calling worker in
+	//		the meantime. Errors of a subtask are propagated to the waiting
+	//		task, and the cancellation of the waiting task is propagated to its
+	//		subtasks when the ATP goes out of scope.
+	//
 	//---------------------------------------------------------------------------
 	class CAutoTaskProxy : CStackObject
 	{
@@ -50,6 +56,14 @@ namespace gpos
 			GPOS_RESULT
 			FindFinished(CTask **task);
 
+			// execute the given task, or any unfinished task of the ATP if NULL,
+			// on the calling worker if it is still queued
+			BOOL FExecuteQueued(CTask *task);
+
+			// block until the given task, or any unreported task if NULL,
+			// finished; the finished task is marked as reported
+			CTask *PtskAwait(CTask *task, BOOL help_others);
+
 			// no copy ctor
 			CAutoTaskProxy(const CAutoTaskProxy&);
 
@@ -93,6 +107,12 @@ namespace gpos
 			// execute task in thread owning ATP (synchronous execution)
 			void Execute(CTask *task);
 
+			// wait for the given scheduled task to finish
+			void Wait(CTask *task);
+
+			// wait for any scheduled task to finish
+			void WaitAny(CTask **task);
+
 			// cancel task
 			void Cancel(CTask *task);
 
@@ -37,7 +37,7 @@ namespace gpos
 
 		friend class CAutoTaskProxy;
 		friend class CAutoTaskProxyTest;
-		friend class CTaskSchedulerFifo;
+		friend class CTaskSchedulerWorkStealing;
 		friend class CWorker;
 		friend class CWorkerPoolManager;
 		friend class CUnittest;
@@ -78,6 +78,10 @@ namespace gpos
 			// local cancellation flag; used when no flag is externally passed
 			BOOL m_cancel_local;
 
+			// task that created this task, if any; the parent outlives the
+			// task and its cancellation is propagated to the task
+			CTask *m_parent;
+
 			// counter of requests to suspend cancellation
 			ULONG m_abort_suspend_count;
 
@@ -93,7 +97,8 @@ namespace gpos
 				CMemoryPool *mp,
 				CTaskContext *task_ctxt,
 				IErrorContext *err_ctxt,
-				BOOL *cancel
+				BOOL *cancel,
+				CTask *parent
 				);
 
 			// no copy ctor
@@ -195,10 +200,10 @@ namespace gpos
 				return m_task_ctxt->Locale();
 			}
 
-			// check if task is canceled
+			// check if task or one of its ancestors is canceled
 			BOOL IsCanceled() const
 			{
-				return *m_cancel;
+				return *m_cancel || (NULL != m_parent && m_parent->IsCanceled());
 			}
 
 			// reset cancel flag
@@ -14,6 +14,7 @@
 
 #include "gpos/types.h"
 #include "gpos/utils.h"
+#include "gpos/sync/atomic.h"
 
 namespace gpos
 {
@@ -34,14 +35,14 @@ namespace gpos
 			ULONG_PTR m_task_id;
 
 			// atomic counter
-			static ULONG_PTR m_counter;
+			static volatile ULONG_PTR m_counter;
 
 		public:
 
 			// ctor
 			CTaskId()
 				:
-				m_task_id(m_counter++)
+				m_task_id(ExchangeAddUlongPtrWithInt(&m_counter, 1))
 			{}
 
 			// simple comparison
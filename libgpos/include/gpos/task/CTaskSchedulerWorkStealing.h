@@ -0,0 +1,128 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (C) 2020 VMware, Inc. or its affiliates.
+//
+//	@filename:
+//		CTaskSchedulerWorkStealing.h
+//
+//	@doc:
+//		Task scheduler with per-worker queues and work stealing
+//---------------------------------------------------------------------------
+#ifndef GPOS_CTaskSchedulerWorkStealing_H
+#define GPOS_CTaskSchedulerWorkStealing_H
+
+#include "gpos/base.h"
+#include "gpos/common/CList.h"
+#include "gpos/sync/CMutex.h"
+#include "gpos/task/CTask.h"
+#include "gpos/task/ITaskScheduler.h"
+
+#define GPOS_WORKERPOOL_MAX_WORKERS			(64)		// max number of pool workers
+
+namespace gpos
+{
+
+	//---------------------------------------------------------------------------
+	//	@class:
+	//		CTaskSchedulerWorkStealing
+	//
+	//	@doc:
+	//		Task scheduler keeping one double-ended queue per worker. Queue 0
+	//		is shared by all threads outside of the worker pool; queue i > 0
+	//		belongs to pool worker i.
+	//
+	//		A worker pushes the tasks it schedules to the tail of its own queue
+	//		and takes work from the same end, so forked subtasks run
+	//		depth-first on the worker that created them. A worker whose queue
+	//		is empty steals the oldest task from the head of another queue,
+	//		visiting the other queues round-robin starting at its neighbor.
+	//
+	//		Each queue is protected by its own mutex; the number of queued
+	//		tasks is maintained atomically so that idle workers can poll for
+	//		work without taking any lock.
+	//
+	//---------------------------------------------------------------------------
+	class CTaskSchedulerWorkStealing : public ITaskScheduler
+	{
+		private:
+
+			//---------------------------------------------------------------------------
+			//	@struct:
+			//		SWorkerQueue
+			//
+			//	@doc:
+			//		Queue of a single worker
+			//
+			//---------------------------------------------------------------------------
+			struct SWorkerQueue
+			{
+				// lock protecting the queue
+				CMutex m_mutex;
+
+				// queued tasks, oldest first
+				CList<CTask> m_tasks;
+
+				// ctor
+				SWorkerQueue()
+				{
+					m_tasks.Init(GPOS_OFFSET(CTask, m_task_scheduler_link));
+				}
+			};
+
+			// queues; one more than workers for threads outside the pool
+			SWorkerQueue m_queues[GPOS_WORKERPOOL_MAX_WORKERS + 1];
+
+			// number of queues in use
+			ULONG m_num_queues;
+
+			// number of queued tasks
+			volatile ULONG_PTR m_num_queued;
+
+			// private copy ctor
+			CTaskSchedulerWorkStealing(const CTaskSchedulerWorkStealing&);
+
+			// take a task from the given end of the given queue
+			CTask *PtskTake(ULONG queue_idx, BOOL from_tail);
+
+		public:
+
+			// ctor
+			CTaskSchedulerWorkStealing();
+
+			// dtor
+			~CTaskSchedulerWorkStealing()
+			{}
+
+			// set number of pool workers; not to be called while the workers are
+			// running
+			void SetWorkers(ULONG num_workers);
+
+			// add task to the queue of the given worker
+			void Enqueue(CTask *task, ULONG worker_idx);
+
+			// get next task to execute by the given worker, stealing from the
+			// other queues if the worker's queue is empty
+			CTask *Dequeue(ULONG worker_idx);
+
+			// check if task is waiting to be scheduled and remove it
+			GPOS_RESULT Remove(CTask *task);
+
+			// get number of waiting tasks
+			ULONG GetQueueSize()
+			{
+				return (ULONG) m_num_queued;
+			}
+
+			// check if task queue is empty
+			BOOL
+			IsEmpty() const
+			{
+				return 0 == m_num_queued;
+			}
+
+	};	// class CTaskSchedulerWorkStealing
+}
+
+#endif /* GPOS_CTaskSchedulerWorkStealing_H */
+
+// EOF
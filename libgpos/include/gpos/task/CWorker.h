@@ -36,6 +36,7 @@ namespace gpos
 	class CWorker : public IWorker
 	{	
 		friend class CAutoTaskProxy;
+		friend class CWorkerPoolManager;
 		
 		private:
 
@@ -48,6 +49,9 @@ namespace gpos
 			// start address of current thread's stack
 			const ULONG_PTR m_stack_start;
 
+			// index of the worker's task queue
+			const ULONG m_idx;
+
 			// execute single task
 			void Execute(CTask *task);
 
@@ -64,8 +68,8 @@ namespace gpos
 
 		public:
 		
-			// ctor
-			CWorker(ULONG stack_size, ULONG_PTR stack_start);
+			// ctor; workers outside of the worker pool share queue 0
+			CWorker(ULONG stack_size, ULONG_PTR stack_start, ULONG idx = 0);
 
 			// dtor
 			virtual ~CWorker();
@@ -80,6 +84,12 @@ namespace gpos
 			// stack check
 			BOOL CheckStackSize(ULONG request = 0) const;
 
+			// task queue accessor
+			ULONG GetIdx() const
+			{
+				return m_idx;
+			}
+
 			// accessor
 			inline
 			CTask *GetTask()
@@ -17,13 +17,18 @@
 #include "gpos/base.h"
 #include "gpos/common/CSyncHashtable.h"
 #include "gpos/common/CSyncHashtableAccessByKey.h"
+#include "gpos/sync/CEvent.h"
+#include "gpos/sync/CMutex.h"
+#include "gpos/sync/atomic.h"
 #include "gpos/task/CTask.h"
 #include "gpos/task/CTaskId.h"
-#include "gpos/task/CTaskSchedulerFifo.h"
+#include "gpos/task/CTaskSchedulerWorkStealing.h"
 #include "gpos/task/CWorker.h"
 
 #define GPOS_WORKERPOOL_HT_SIZE 			(1024)				// number of buckets in hash tables
 #define GPOS_WORKER_STACK_SIZE				(500 * 1024)		// max worker stack size
+#define GPOS_WORKER_HELP_STACK_SIZE			(128 * 1024)		// stack needed to run another task while waiting
+#define GPOS_WORKERPOOL_WAIT_MSEC			(10)				// interval of abort checks while waiting
 
 namespace gpos
 {
@@ -36,6 +41,18 @@ namespace gpos
 	//		maintains WLS (worker local storage);
 	//		assigns tasks to workers;
 	//
+	//		By default the pool has no workers of its own: scheduled tasks are
+	//		run by the threads waiting for them, which keeps hosts with
+	//		thread-unsafe memory pools single-threaded. StartWorkers, called
+	//		by gpos_init when the host asks for workers in gpos_init_params,
+	//		spawns pool workers that execute scheduled tasks in parallel, stealing
+	//		work from each other when their own queue runs dry. A thread
+	//		waiting for a task keeps executing queued tasks, the awaited one
+	//		first, so that nested fork/join does not block workers.
+	//
+	//		Tasks running on pool workers must only allocate from their own
+	//		memory pool or from structures that are otherwise synchronized.
+	//
 	//------------------------------------------------------------------------
 	class CWorkerPoolManager
 	{	
@@ -55,21 +72,45 @@ namespace gpos
 			CMemoryPool *m_mp;
 		
 			// task scheduler
-			CTaskSchedulerFifo m_task_scheduler;
+			CTaskSchedulerWorkStealing m_task_scheduler;
 
 			// auto task proxy counter
-			ULONG_PTR m_auto_task_proxy_counter;
+			volatile ULONG_PTR m_auto_task_proxy_counter;
 
 			// active flag
 			BOOL m_active;
 
-			// we only support a single worker now
-			CWorker *m_single_worker;
+			// lock protecting the state of the pool workers
+			CMutex m_mutex;
+
+			// signaled when a task is queued or finished
+			CEvent m_event;
+
+			// number of threads waiting for the event; protected by m_mutex
+			ULONG m_num_sleepers;
+
+			// number of finished tasks; used by waiters to detect progress
+			volatile ULONG_PTR m_num_finished;
+
+			// threads of the pool workers
+			pthread_t m_threads[GPOS_WORKERPOOL_MAX_WORKERS];
+
+			// number of pool workers
+			ULONG m_num_workers;
+
+			// flag asking pool workers to exit
+			BOOL m_stop;
+
+			// lock protecting task storage
+			CMutex m_mutex_tasks;
 
 			// task storage
 			CSyncHashtable
 			<CTask, CTaskId> m_shtTS;
 
+			// worker of the current thread
+			static __thread CWorker *m_self;
+
 			//-------------------------------------------------------------------
 			// Interface for CAutoTaskProxy
 			//-------------------------------------------------------------------
@@ -80,7 +121,7 @@ namespace gpos
 			// increment AutoTaskProxy reference counter
 			void AddRef()
 			{
-				m_auto_task_proxy_counter++;
+				(void) ExchangeAddUlongPtrWithInt(&m_auto_task_proxy_counter, 1);
 			}
 
 			// decrement AutoTaskProxy reference counter
@@ -88,7 +129,7 @@ namespace gpos
 			{
 				GPOS_ASSERT(m_auto_task_proxy_counter != 0 &&
 							"AutoTaskProxy counter decremented from 0");
-				m_auto_task_proxy_counter--;
+				(void) ExchangeAddUlongPtrWithInt(&m_auto_task_proxy_counter, -1);
 			}
 
 			// insert task in table
@@ -97,6 +138,24 @@ namespace gpos
 			// remove task from table
 			CTask *RemoveTask(CTaskId tid);
 
+			// execute the given task on the calling worker if it is still queued
+			BOOL FExecuteIfQueued(CTask *task);
+
+			// execute one queued task on the calling worker, if any and if the
+			// worker has enough stack left
+			BOOL FExecuteQueued();
+
+			// number of finished tasks
+			ULONG_PTR NumFinished() const
+			{
+				return m_num_finished;
+			}
+
+			// block until a task finished after the given number of tasks
+			// finished, a task is queued that the caller can help with, or the
+			// wait interval elapsed
+			void WaitProgress(ULONG_PTR num_finished, BOOL can_help);
+
 			//-------------------------------------------------------------------
 			// Interface for CWorker
 			//-------------------------------------------------------------------
@@ -111,6 +170,28 @@ namespace gpos
 			// Methods for internal use
 			//-------------------------------------------------------------------
 
+			// queue of the calling worker
+			ULONG WorkerIdx() const
+			{
+				return (NULL == m_self) ? 0 : m_self->GetIdx();
+			}
+
+			// run task on the given worker and announce its completion
+			void Execute(CWorker *worker, CTask *task);
+
+			// wake up one sleeping thread after a task was queued
+			void SignalQueued();
+
+			// wake up all sleeping threads after a task finished
+			void SignalFinished();
+
+			// main loop of a pool worker
+			void RunWorker(CWorker *worker);
+
+			// entry point of the thread of a pool worker
+			static
+			void *RunWorkerThread(void *arg);
+
 			// no copy ctor
 			CWorkerPoolManager(const CWorkerPoolManager&);
 
@@ -129,7 +210,7 @@ namespace gpos
 			inline
 			CWorker *Self()
 			{
-				return m_single_worker;
+				return m_self;
 			}
 
 			// dtor
@@ -157,6 +238,18 @@ namespace gpos
 			// cancel task by task id
 			void Cancel(CTaskId tid);
 
+			// spawn the given number of pool workers
+			GPOS_RESULT StartWorkers(ULONG num_workers);
+
+			// stop and join all pool workers
+			void StopWorkers();
+
+			// number of pool workers
+			ULONG GetNumWorkers() const
+			{
+				return m_num_workers;
+			}
+
 	}; // class CWorkerPoolManager
 
 }
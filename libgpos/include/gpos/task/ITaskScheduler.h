@@ -45,17 +45,17 @@ namespace gpos
 			virtual
 			~ITaskScheduler() {}
 
-			// add task to waiting queue
+			// add task to the queue of the given worker
 			virtual
-			void Enqueue(CTask *) = 0;
+			void Enqueue(CTask *, ULONG worker_idx) = 0;
 
-			// get next task to execute
+			// get next task to execute by the given worker, NULL if there is none
 			virtual
-			CTask *Dequeue() = 0;
+			CTask *Dequeue(ULONG worker_idx) = 0;
 
 			// check if task is waiting to be scheduled and remove it
 			virtual
-			GPOS_RESULT Cancel(CTask *task) = 0;
+			GPOS_RESULT Remove(CTask *task) = 0;
 
 			// get number of waiting tasks
 			virtual
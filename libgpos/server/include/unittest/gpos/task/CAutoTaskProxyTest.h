@@ -26,62 +26,51 @@ namespace gpos
 	class CAutoTaskProxyTest
 	{
 		public:
-			enum EWaitType
-			{
-				EwtInvalid = 0,
-
-				EwtWait,
-				EwtWaitAny,
-				EwtTimedWait,
-				EwtTimedWaitAny,
-				EwtDestroy,
 
-				EwtSentinel
-			};
-
-			struct STestThreadDescriptor
+			// argument of test tasks
+			struct STaskArg
 			{
-				// pthread descriptor
-				PTHREAD_T m_pthrdt;
-
-				// thread id
-				ULONG id;
-
-			// return value
-				BOOL fException;
-
-				// Propagate Exception
-				BOOL fPropagateException;
-
-				// CMemoryPool
-				CMemoryPool *m_mp;
+				// input of the task
+				ULONG m_input;
+
+				// result of the task
+				ULLONG m_result;
+
+				// set once the task started running
+				volatile BOOL m_started;
+
+				// set if the task was aborted
+				volatile BOOL m_aborted;
+
+				// ctor
+				explicit
+				STaskArg
+					(
+					ULONG input
+					)
+					:
+					m_input(input),
+					m_result(0),
+					m_started(false),
+					m_aborted(false)
+				{}
 			};
 
 			// unittests
 			static GPOS_RESULT EresUnittest();
 			static GPOS_RESULT EresUnittest_Wait();
 			static GPOS_RESULT EresUnittest_WaitAny();
-			static GPOS_RESULT EresUnittest_TimedWait();
-			static GPOS_RESULT EresUnittest_TimedWaitAny();
 			static GPOS_RESULT EresUnittest_Destroy();
-			static GPOS_RESULT EresUnittest_PropagateCancelError();
 			static GPOS_RESULT EresUnittest_PropagateExecError();
-			static GPOS_RESULT EresUnittest_ExecuteError();
-			static GPOS_RESULT EresUnittest_CheckErrorPropagation();
+			static GPOS_RESULT EresUnittest_PropagateCancel();
 
-		// propagate error with/without cancel by specific value
-			// need to access the private method of CTask
-			static void Unittest_PropagateErrorInternal(void *(*)(void*), BOOL);
-			static void* Unittest_CheckExecuteErrorInternal(void*);
-
-			// execute *wait* functions with/without cancel
-			static void Unittest_ExecuteWaitFunc(CAutoTaskProxy &, CTask *, BOOL, EWaitType);
+			// wait for a task to start, for a bounded time
+			static void Unittest_WaitStarted(STaskArg *arg);
 
 			static void *PvUnittest_Short(void *);
-			static void *PvUnittest_Long(void *);
 			static void *PvUnittest_Infinite(void *);
 			static void *PvUnittest_Error(void *);
-			static void PvUnittest_CheckAborted(CTask *ptsk);
+			static void *PvUnittest_Parent(void *);
 
 	}; // CAutoTaskProxyTest
 }
@@ -89,4 +78,3 @@ namespace gpos
 #endif // !GPOS_CAutoTaskProxyTest_H
 
 // EOF
-
@@ -11,8 +11,8 @@
 #ifndef GPOS_CWorkerPoolManagerTest_H
 #define GPOS_CWorkerPoolManagerTest_H
 
+#include "gpos/task/CTaskLocalStorageObject.h"
 #include "gpos/task/CWorkerPoolManager.h"
-#include "unittest/gpos/task/CAutoTaskProxyTest.h"
 
 namespace gpos
 {
@@ -21,50 +21,83 @@ namespace gpos
 	//		CWorkerPoolManagerTest
 	//
 	//	@doc:
-	//		Unit and stress tests for worker pool class
+	//		Unit tests and scalability benchmark for worker pool class
 	//
 	//---------------------------------------------------------------------------
 	class CWorkerPoolManagerTest
 	{
+		private:
+
+			//---------------------------------------------------------------------------
+			//	@class:
+			//		CTestObject
+			//
+			//	@doc:
+			//		TLS object identifying the task that stored it
+			//
+			//---------------------------------------------------------------------------
+			class CTestObject : public CTaskLocalStorageObject
+			{
+				public:
+
+					// task that stored the object
+					ITask *m_task;
+
+					// ctor
+					explicit
+					CTestObject
+						(
+						ITask *task
+						)
+						:
+						CTaskLocalStorageObject(CTaskLocalStorage::EtlsidxTest),
+						m_task(task)
+					{}
+
+#ifdef GPOS_DEBUG
+					// overwrite abstract member
+					IOstream &OsPrint
+						(
+						IOstream &os
+						)
+						const
+					{
+						return os;
+					}
+#endif // GPOS_DEBUG
+
+			};
+
+			// argument of fork/join tasks
+			struct SForkJoinArg
+			{
+				// depth of the subtree rooted at the task
+				ULONG m_depth;
+
+				// number of leaves of the subtree
+				ULONG m_leaves;
+			};
+
 		public:
 
 			// unittests
 			static GPOS_RESULT EresUnittest();
+			static GPOS_RESULT EresUnittest_TaskLocalStorage();
+			static GPOS_RESULT EresUnittest_ForkJoin();
 			static GPOS_RESULT EresUnittest_Performance();
-			static GPOS_RESULT EresUnittest_Stress();
-
-			static void Unittest_TestTaskPerformance
-				(
-				ULONG culWrkrCnt,
-				ULONG culIterCnt,
-				void *funcSingle(void *),
-				void *funcRepeated(void *)
-				);
-
-			static void Unittest_TestSingleTaskPerformance
-				(
-				CMemoryPool *mp,
-				ULONG culWrkrCnt,
-				ULONG culIterCnt,
-				void *funcRepeated(void *)
-				);
 
-			static void Unittest_TestMultiTaskPerformance
+			// run the given number of tasks and return the elapsed time in ms
+			static ULONG Unittest_TestTaskPerformance
 				(
 				CMemoryPool *mp,
-				ULONG culWrkrCnt,
-				ULONG culIterCnt,
-				void *funcSingle(void *)
-				);
-
-			static void Unittest_Stress
-				(
-				ULONG culWrkrCnt,
-				ULONG culTskCnt,
+				ULONG num_workers,
+				ULONG num_tasks,
 				void *func(void *)
 				);
-			static void *PvUnittest_ShortRepeated(void *);
-			static void *PvUnittest_LongRepeated(void *);
+
+			static void *PvUnittest_TaskLocalStorage(void *);
+			static void *PvUnittest_ForkJoin(void *);
+			static void *PvUnittest_Compute(void *);
 
 	}; // CWorkerPoolManagerTest
 }
@@ -72,4 +105,3 @@ namespace gpos
 #endif // !GPOS_CWorkerPoolManagerTest_H
 
 // EOF
-
@@ -58,7 +58,9 @@
 #include "unittest/gpos/string/CStringTest.h"
 #include "unittest/gpos/string/CWStringTest.h"
 
+#include "unittest/gpos/task/CAutoTaskProxyTest.h"
 #include "unittest/gpos/task/CTaskLocalStorageTest.h"
+#include "unittest/gpos/task/CWorkerPoolManagerTest.h"
 
 #include "unittest/gpos/test/CUnittestTest.h"
 
@@ -112,7 +114,9 @@ static gpos::CUnittest rgut[] =
 	GPOS_UNITTEST_STD(CStringTest),
 
 	// task
+	GPOS_UNITTEST_STD(CAutoTaskProxyTest),
 	GPOS_UNITTEST_STD(CTaskLocalStorageTest),
+	GPOS_UNITTEST_STD(CWorkerPoolManagerTest),
 
 	// test
 	GPOS_UNITTEST_STD_SUBTEST(CUnittestTest, 0),
@@ -169,7 +173,7 @@ INT main
 	// setup args for unittest params
 	CMainArgs ma(iArgs, rgszArgs, "cuU:xT:");
 
-	struct gpos_init_params init_params = { NULL };
+	struct gpos_init_params init_params = { NULL, 0 /* num_workers */ };
 	gpos_init(&init_params);
 
 	GPOS_ASSERT(iArgs >= 0);
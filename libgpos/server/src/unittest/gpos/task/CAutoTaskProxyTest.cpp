@@ -0,0 +1,465 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (C) 2010 Greenplum, Inc.
+//
+//	@filename:
+//		CAutoTaskProxyTest.cpp
+//
+//	@doc:
+//		Tests for CAutoTaskProxy
+//---------------------------------------------------------------------------
+
+#include "gpos/base.h"
+#include "gpos/common/CWallClock.h"
+#include "gpos/common/syslibwrapper.h"
+#include "gpos/memory/CAutoMemoryPool.h"
+#include "gpos/task/CAutoTaskProxy.h"
+#include "gpos/test/CUnittest.h"
+
+#include "unittest/gpos/task/CAutoTaskProxyTest.h"
+
+#define GPOS_ATP_TEST_TASKS				(8)			// number of tasks per test
+#define GPOS_ATP_TEST_START_TIMEOUT_MS	(10000)		// max wait for a task to start
+
+using namespace gpos;
+
+// numbers of pool workers the tests run with
+static const ULONG rgulWorkers[] = {0, 2};
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CAutoTaskProxyTest::EresUnittest
+//
+//	@doc:
+//		Unittest for auto task proxy
+//
+//---------------------------------------------------------------------------
+GPOS_RESULT
+CAutoTaskProxyTest::EresUnittest()
+{
+	CUnittest rgut[] =
+		{
+		GPOS_UNITTEST_FUNC(CAutoTaskProxyTest::EresUnittest_Wait),
+		GPOS_UNITTEST_FUNC(CAutoTaskProxyTest::EresUnittest_WaitAny),
+		GPOS_UNITTEST_FUNC(CAutoTaskProxyTest::EresUnittest_Destroy),
+		GPOS_UNITTEST_FUNC(CAutoTaskProxyTest::EresUnittest_PropagateExecError),
+		GPOS_UNITTEST_FUNC(CAutoTaskProxyTest::EresUnittest_PropagateCancel),
+		};
+
+	return CUnittest::EresExecute(rgut, GPOS_ARRAY_SIZE(rgut));
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CAutoTaskProxyTest::EresUnittest_Wait
+//
+//	@doc:
+//		Schedule tasks and wait for each of them
+//
+//---------------------------------------------------------------------------
+GPOS_RESULT
+CAutoTaskProxyTest::EresUnittest_Wait()
+{
+	CAutoMemoryPool amp;
+	CMemoryPool *mp = amp.Pmp();
+
+	CWorkerPoolManager *pwpm = CWorkerPoolManager::WorkerPoolManager();
+
+	for (ULONG ulWorkers = 0; ulWorkers < GPOS_ARRAY_SIZE(rgulWorkers); ulWorkers++)
+	{
+		GPOS_RTL_ASSERT(GPOS_OK == pwpm->StartWorkers(rgulWorkers[ulWorkers]));
+
+		// scope for ATP
+		{
+			CAutoTaskProxy atp(mp, pwpm);
+
+			STaskArg *rgarg[GPOS_ATP_TEST_TASKS];
+			CTask *rgptsk[GPOS_ATP_TEST_TASKS];
+			for (ULONG ul = 0; ul < GPOS_ATP_TEST_TASKS; ul++)
+			{
+				rgarg[ul] = GPOS_NEW(mp) STaskArg(1000 * (ul + 1));
+				rgptsk[ul] = atp.Create(PvUnittest_Short, rgarg[ul]);
+				atp.Schedule(rgptsk[ul]);
+			}
+
+			for (ULONG ul = 0; ul < GPOS_ATP_TEST_TASKS; ul++)
+			{
+				atp.Wait(rgptsk[ul]);
+
+				GPOS_ASSERT(CTask::EtsCompleted == rgptsk[ul]->GetStatus());
+				GPOS_ASSERT(rgarg[ul] == rgptsk[ul]->GetRes());
+
+				ULLONG input = rgarg[ul]->m_input;
+				GPOS_RTL_ASSERT(input * (input - 1) / 2 == rgarg[ul]->m_result);
+
+				GPOS_DELETE(rgarg[ul]);
+			}
+		}
+
+		pwpm->StopWorkers();
+	}
+
+	return GPOS_OK;
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CAutoTaskProxyTest::EresUnittest_WaitAny
+//
+//	@doc:
+//		Schedule tasks and wait for any of them until all finished
+//
+//---------------------------------------------------------------------------
+GPOS_RESULT
+CAutoTaskProxyTest::EresUnittest_WaitAny()
+{
+	CAutoMemoryPool amp;
+	CMemoryPool *mp = amp.Pmp();
+
+	CWorkerPoolManager *pwpm = CWorkerPoolManager::WorkerPoolManager();
+
+	for (ULONG ulWorkers = 0; ulWorkers < GPOS_ARRAY_SIZE(rgulWorkers); ulWorkers++)
+	{
+		GPOS_RTL_ASSERT(GPOS_OK == pwpm->StartWorkers(rgulWorkers[ulWorkers]));
+
+		// scope for ATP
+		{
+			CAutoTaskProxy atp(mp, pwpm);
+
+			STaskArg *rgarg[GPOS_ATP_TEST_TASKS];
+			for (ULONG ul = 0; ul < GPOS_ATP_TEST_TASKS; ul++)
+			{
+				rgarg[ul] = GPOS_NEW(mp) STaskArg(1000 * (ul + 1));
+				atp.Schedule(atp.Create(PvUnittest_Short, rgarg[ul]));
+			}
+
+			ULLONG ullResults = 0;
+			for (ULONG ul = 0; ul < GPOS_ATP_TEST_TASKS; ul++)
+			{
+				CTask *ptsk = NULL;
+				atp.WaitAny(&ptsk);
+
+				GPOS_ASSERT(NULL != ptsk);
+				GPOS_ASSERT(CTask::EtsCompleted == ptsk->GetStatus());
+
+				STaskArg *arg = (STaskArg *) ptsk->GetRes();
+				ullResults += arg->m_result;
+
+				atp.Destroy(ptsk);
+			}
+			GPOS_ASSERT(0 == atp.TaskCount());
+
+			ULLONG ullExpected = 0;
+			for (ULONG ul = 0; ul < GPOS_ATP_TEST_TASKS; ul++)
+			{
+				ULLONG input = rgarg[ul]->m_input;
+				ullExpected += input * (input - 1) / 2;
+
+				GPOS_DELETE(rgarg[ul]);
+			}
+			GPOS_RTL_ASSERT(ullExpected == ullResults);
+		}
+
+		pwpm->StopWorkers();
+	}
+
+	return GPOS_OK;
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CAutoTaskProxyTest::EresUnittest_Destroy
+//
+//	@doc:
+//		Destroy scheduled tasks that never finish by themselves; running
+//		tasks must be aborted, queued ones must never start
+//
+//---------------------------------------------------------------------------
+GPOS_RESULT
+CAutoTaskProxyTest::EresUnittest_Destroy()
+{
+	CAutoMemoryPool amp;
+	CMemoryPool *mp = amp.Pmp();
+
+	CWorkerPoolManager *pwpm = CWorkerPoolManager::WorkerPoolManager();
+
+	for (ULONG ulWorkers = 0; ulWorkers < GPOS_ARRAY_SIZE(rgulWorkers); ulWorkers++)
+	{
+		GPOS_RTL_ASSERT(GPOS_OK == pwpm->StartWorkers(rgulWorkers[ulWorkers]));
+
+		STaskArg *rgarg[GPOS_ATP_TEST_TASKS];
+
+		// scope for ATP
+		{
+			CAutoTaskProxy atp(mp, pwpm);
+
+			for (ULONG ul = 0; ul < GPOS_ATP_TEST_TASKS; ul++)
+			{
+				rgarg[ul] = GPOS_NEW(mp) STaskArg(0);
+				atp.Schedule(atp.Create(PvUnittest_Infinite, rgarg[ul]));
+			}
+
+			if (0 < rgulWorkers[ulWorkers])
+			{
+				Unittest_WaitStarted(rgarg[0]);
+			}
+		}
+
+		for (ULONG ul = 0; ul < GPOS_ATP_TEST_TASKS; ul++)
+		{
+			GPOS_RTL_ASSERT(rgarg[ul]->m_started == rgarg[ul]->m_aborted);
+			GPOS_DELETE(rgarg[ul]);
+		}
+
+		pwpm->StopWorkers();
+	}
+
+	return GPOS_OK;
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CAutoTaskProxyTest::EresUnittest_PropagateExecError
+//
+//	@doc:
+//		Error raised by a subtask is propagated to the waiting task
+//
+//---------------------------------------------------------------------------
+GPOS_RESULT
+CAutoTaskProxyTest::EresUnittest_PropagateExecError()
+{
+	CAutoMemoryPool amp;
+	CMemoryPool *mp = amp.Pmp();
+
+	CWorkerPoolManager *pwpm = CWorkerPoolManager::WorkerPoolManager();
+
+	for (ULONG ulWorkers = 0; ulWorkers < GPOS_ARRAY_SIZE(rgulWorkers); ulWorkers++)
+	{
+		GPOS_RTL_ASSERT(GPOS_OK == pwpm->StartWorkers(rgulWorkers[ulWorkers]));
+
+		BOOL fRaised = false;
+
+		GPOS_TRY
+		{
+			CAutoTaskProxy atp(mp, pwpm);
+
+			CTask *ptsk = atp.Create(PvUnittest_Error, NULL);
+			atp.Schedule(ptsk);
+			atp.Wait(ptsk);
+		}
+		GPOS_CATCH_EX(ex)
+		{
+			GPOS_ASSERT(GPOS_MATCH_EX(ex, CException::ExmaSystem, CException::ExmiOOM));
+			GPOS_RESET_EX;
+
+			fRaised = true;
+		}
+		GPOS_CATCH_END;
+
+		GPOS_RTL_ASSERT(fRaised);
+
+		pwpm->StopWorkers();
+	}
+
+	return GPOS_OK;
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CAutoTaskProxyTest::EresUnittest_PropagateCancel
+//
+//	@doc:
+//		Cancelling a task aborts the subtasks it is waiting for; requires
+//		pool workers, as the canceled task must run concurrently
+//
+//---------------------------------------------------------------------------
+GPOS_RESULT
+CAutoTaskProxyTest::EresUnittest_PropagateCancel()
+{
+	CAutoMemoryPool amp;
+	CMemoryPool *mp = amp.Pmp();
+
+	CWorkerPoolManager *pwpm = CWorkerPoolManager::WorkerPoolManager();
+
+	for (ULONG ulWorkers = 1; ulWorkers <= 2; ulWorkers++)
+	{
+		GPOS_RTL_ASSERT(GPOS_OK == pwpm->StartWorkers(ulWorkers));
+
+		STaskArg argChild(0);
+
+		// scope for ATP
+		{
+			CAutoTaskProxy atp(mp, pwpm);
+
+			CTask *ptsk = atp.Create(PvUnittest_Parent, &argChild);
+			atp.Schedule(ptsk);
+
+			Unittest_WaitStarted(&argChild);
+
+			atp.Cancel(ptsk);
+
+			// the abort raised by the subtask ends the parent task
+			atp.SetPropagateError(false);
+			atp.Wait(ptsk);
+
+			GPOS_RTL_ASSERT(CTask::EtsError == ptsk->GetStatus());
+		}
+
+		GPOS_RTL_ASSERT(argChild.m_aborted);
+
+		pwpm->StopWorkers();
+	}
+
+	return GPOS_OK;
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CAutoTaskProxyTest::Unittest_WaitStarted
+//
+//	@doc:
+//		Wait for the task of the given argument to start running
+//
+//---------------------------------------------------------------------------
+void
+CAutoTaskProxyTest::Unittest_WaitStarted
+	(
+	STaskArg *arg
+	)
+{
+	CWallClock clock;
+	while (!arg->m_started && clock.ElapsedMS() < GPOS_ATP_TEST_START_TIMEOUT_MS)
+	{
+		GPOS_CHECK_ABORT;
+		syslib::SchedYield();
+	}
+
+	GPOS_RTL_ASSERT(arg->m_started);
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CAutoTaskProxyTest::PvUnittest_Short
+//
+//	@doc:
+//		Sum up the numbers below the input
+//
+//---------------------------------------------------------------------------
+void *
+CAutoTaskProxyTest::PvUnittest_Short
+	(
+	void *pv
+	)
+{
+	STaskArg *arg = (STaskArg *) pv;
+	arg->m_started = true;
+
+	ULLONG result = 0;
+	for (ULONG ul = 0; ul < arg->m_input; ul++)
+	{
+		result += ul;
+
+		if (0 == ul % 256)
+		{
+			GPOS_CHECK_ABORT;
+		}
+	}
+	arg->m_result = result;
+
+	return arg;
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CAutoTaskProxyTest::PvUnittest_Infinite
+//
+//	@doc:
+//		Loop until aborted
+//
+//---------------------------------------------------------------------------
+void *
+CAutoTaskProxyTest::PvUnittest_Infinite
+	(
+	void *pv
+	)
+{
+	STaskArg *arg = (STaskArg *) pv;
+	arg->m_started = true;
+
+	GPOS_TRY
+	{
+		while (true)
+		{
+			GPOS_CHECK_ABORT;
+			syslib::SchedYield();
+		}
+	}
+	GPOS_CATCH_EX(ex)
+	{
+		GPOS_ASSERT(GPOS_MATCH_EX(ex, CException::ExmaSystem, CException::ExmiAbort));
+		arg->m_aborted = true;
+
+		GPOS_RETHROW(ex);
+	}
+	GPOS_CATCH_END;
+
+	return NULL;
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CAutoTaskProxyTest::PvUnittest_Error
+//
+//	@doc:
+//		Raise an error
+//
+//---------------------------------------------------------------------------
+void *
+CAutoTaskProxyTest::PvUnittest_Error
+	(
+	void *
+	)
+{
+	GPOS_RAISE(CException::ExmaSystem, CException::ExmiOOM);
+
+	return NULL;
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CAutoTaskProxyTest::PvUnittest_Parent
+//
+//	@doc:
+//		Fork a subtask that never finishes by itself and wait for it
+//
+//---------------------------------------------------------------------------
+void *
+CAutoTaskProxyTest::PvUnittest_Parent
+	(
+	void *pv
+	)
+{
+	CAutoMemoryPool amp;
+	CMemoryPool *mp = amp.Pmp();
+
+	CAutoTaskProxy atp(mp, CWorkerPoolManager::WorkerPoolManager());
+
+	CTask *ptsk = atp.Create(PvUnittest_Infinite, pv);
+	atp.Schedule(ptsk);
+	atp.Wait(ptsk);
+
+	return NULL;
+}
+
+// EOF
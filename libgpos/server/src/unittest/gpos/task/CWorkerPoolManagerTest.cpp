@@ -0,0 +1,380 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (C) 2010 Greenplum, Inc.
+//
+//	@filename:
+//		CWorkerPoolManagerTest.cpp
+//
+//	@doc:
+//		Tests for CWorkerPoolManager
+//---------------------------------------------------------------------------
+
+#include "gpos/base.h"
+#include "gpos/common/CWallClock.h"
+#include "gpos/common/syslibwrapper.h"
+#include "gpos/memory/CAutoMemoryPool.h"
+#include "gpos/task/CAutoTaskProxy.h"
+#include "gpos/test/CUnittest.h"
+
+#include "unittest/gpos/task/CWorkerPoolManagerTest.h"
+
+#define GPOS_WPM_TEST_TLS_DEPTH			(4)			// nesting depth of TLS test tasks
+#define GPOS_WPM_TEST_FORK_DEPTH		(6)			// depth of fork/join test tree
+#define GPOS_WPM_TEST_TASKS				(64)		// number of benchmark tasks
+#define GPOS_WPM_TEST_ITERATIONS		(1 << 18)	// iterations per benchmark task
+
+using namespace gpos;
+
+// numbers of pool workers the tests run with
+static const ULONG rgulWorkers[] = {0, 1, 2, 4};
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CWorkerPoolManagerTest::EresUnittest
+//
+//	@doc:
+//		Unittest for worker pool manager
+//
+//---------------------------------------------------------------------------
+GPOS_RESULT
+CWorkerPoolManagerTest::EresUnittest()
+{
+	CUnittest rgut[] =
+		{
+		GPOS_UNITTEST_FUNC(CWorkerPoolManagerTest::EresUnittest_TaskLocalStorage),
+		GPOS_UNITTEST_FUNC(CWorkerPoolManagerTest::EresUnittest_ForkJoin),
+		GPOS_UNITTEST_FUNC(CWorkerPoolManagerTest::EresUnittest_Performance),
+		};
+
+	return CUnittest::EresExecute(rgut, GPOS_ARRAY_SIZE(rgut));
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CWorkerPoolManagerTest::EresUnittest_TaskLocalStorage
+//
+//	@doc:
+//		Tasks running concurrently, or nested on the same worker while
+//		waiting for their subtasks, see their own TLS only
+//
+//---------------------------------------------------------------------------
+GPOS_RESULT
+CWorkerPoolManagerTest::EresUnittest_TaskLocalStorage()
+{
+	CAutoMemoryPool amp;
+	CMemoryPool *mp = amp.Pmp();
+
+	CWorkerPoolManager *pwpm = CWorkerPoolManager::WorkerPoolManager();
+
+	for (ULONG ulWorkers = 0; ulWorkers < GPOS_ARRAY_SIZE(rgulWorkers); ulWorkers++)
+	{
+		GPOS_RTL_ASSERT(GPOS_OK == pwpm->StartWorkers(rgulWorkers[ulWorkers]));
+
+		// scope for ATP
+		{
+			CAutoTaskProxy atp(mp, pwpm);
+
+			for (ULONG ul = 0; ul < rgulWorkers[ulWorkers] + 1; ul++)
+			{
+				atp.Schedule(atp.Create(PvUnittest_TaskLocalStorage, (void *) GPOS_WPM_TEST_TLS_DEPTH));
+			}
+
+			for (ULONG ul = 0; ul < rgulWorkers[ulWorkers] + 1; ul++)
+			{
+				CTask *ptsk = NULL;
+				atp.WaitAny(&ptsk);
+
+				GPOS_RTL_ASSERT(CTask::EtsCompleted == ptsk->GetStatus());
+			}
+		}
+
+		pwpm->StopWorkers();
+	}
+
+	return GPOS_OK;
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CWorkerPoolManagerTest::EresUnittest_ForkJoin
+//
+//	@doc:
+//		Recursively fork and join a binary tree of tasks
+//
+//---------------------------------------------------------------------------
+GPOS_RESULT
+CWorkerPoolManagerTest::EresUnittest_ForkJoin()
+{
+	CAutoMemoryPool amp;
+	CMemoryPool *mp = amp.Pmp();
+
+	CWorkerPoolManager *pwpm = CWorkerPoolManager::WorkerPoolManager();
+
+	for (ULONG ulWorkers = 0; ulWorkers < GPOS_ARRAY_SIZE(rgulWorkers); ulWorkers++)
+	{
+		GPOS_RTL_ASSERT(GPOS_OK == pwpm->StartWorkers(rgulWorkers[ulWorkers]));
+
+		SForkJoinArg arg;
+		arg.m_depth = GPOS_WPM_TEST_FORK_DEPTH;
+		arg.m_leaves = 0;
+
+		// scope for ATP
+		{
+			CAutoTaskProxy atp(mp, pwpm);
+
+			CTask *ptsk = atp.Create(PvUnittest_ForkJoin, &arg);
+			atp.Schedule(ptsk);
+			atp.Wait(ptsk);
+		}
+
+		GPOS_RTL_ASSERT((1 << GPOS_WPM_TEST_FORK_DEPTH) == arg.m_leaves);
+
+		pwpm->StopWorkers();
+	}
+
+	return GPOS_OK;
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CWorkerPoolManagerTest::EresUnittest_Performance
+//
+//	@doc:
+//		Scalability benchmark: run a fixed number of compute-bound tasks
+//		with an increasing number of pool workers; the thread running the
+//		test executes tasks as well while waiting
+//
+//---------------------------------------------------------------------------
+GPOS_RESULT
+CWorkerPoolManagerTest::EresUnittest_Performance()
+{
+	CAutoMemoryPool amp;
+	CMemoryPool *mp = amp.Pmp();
+
+	ULONG ulBaseMS = 0;
+	for (ULONG ulWorkers = 0; ulWorkers < GPOS_ARRAY_SIZE(rgulWorkers); ulWorkers++)
+	{
+		ULONG ulMS = Unittest_TestTaskPerformance
+						(
+						mp,
+						rgulWorkers[ulWorkers],
+						GPOS_WPM_TEST_TASKS,
+						PvUnittest_Compute
+						);
+
+		if (0 == ulWorkers)
+		{
+			ulBaseMS = ulMS;
+		}
+
+		GPOS_TRACE_FORMAT
+			(
+			"Pool workers: %d, tasks: %d, time: %d ms, speedup: %.2f",
+			rgulWorkers[ulWorkers],
+			GPOS_WPM_TEST_TASKS,
+			ulMS,
+			(DOUBLE) ulBaseMS / std::max(ulMS, (ULONG) 1)
+			);
+	}
+
+	return GPOS_OK;
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CWorkerPoolManagerTest::Unittest_TestTaskPerformance
+//
+//	@doc:
+//		Schedule the given number of tasks, wait for all of them and return
+//		the elapsed time
+//
+//---------------------------------------------------------------------------
+ULONG
+CWorkerPoolManagerTest::Unittest_TestTaskPerformance
+	(
+	CMemoryPool *mp,
+	ULONG num_workers,
+	ULONG num_tasks,
+	void *func(void *)
+	)
+{
+	CWorkerPoolManager *pwpm = CWorkerPoolManager::WorkerPoolManager();
+
+	GPOS_RTL_ASSERT(GPOS_OK == pwpm->StartWorkers(num_workers));
+
+	ULLONG *rgullResults = GPOS_NEW_ARRAY(mp, ULLONG, num_tasks);
+
+	CWallClock clock;
+
+	// scope for ATP
+	{
+		CAutoTaskProxy atp(mp, pwpm);
+
+		for (ULONG ul = 0; ul < num_tasks; ul++)
+		{
+			rgullResults[ul] = ul + 1;
+			atp.Schedule(atp.Create(func, &rgullResults[ul]));
+		}
+
+		for (ULONG ul = 0; ul < num_tasks; ul++)
+		{
+			CTask *ptsk = NULL;
+			atp.WaitAny(&ptsk);
+			atp.Destroy(ptsk);
+		}
+	}
+
+	ULONG ulMS = clock.ElapsedMS();
+
+	pwpm->StopWorkers();
+
+	// tasks with the same seed compute the same result
+	for (ULONG ul = 0; ul < num_tasks; ul++)
+	{
+		ULLONG ullSeed = ul + 1;
+		(void) PvUnittest_Compute(&ullSeed);
+
+		GPOS_RTL_ASSERT(ullSeed == rgullResults[ul]);
+	}
+
+	GPOS_DELETE_ARRAY(rgullResults);
+
+	return ulMS;
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CWorkerPoolManagerTest::PvUnittest_TaskLocalStorage
+//
+//	@doc:
+//		Store an object in TLS, run a nested subtask that does the same,
+//		and check that the object is still found
+//
+//---------------------------------------------------------------------------
+void *
+CWorkerPoolManagerTest::PvUnittest_TaskLocalStorage
+	(
+	void *pv
+	)
+{
+	ULONG ulDepth = (ULONG) (ULONG_PTR) pv;
+
+	ITask *ptsk = ITask::Self();
+	CTestObject tobj(ptsk);
+
+	ptsk->GetTls().Store(&tobj);
+
+	if (0 < ulDepth)
+	{
+		CAutoMemoryPool amp;
+		CAutoTaskProxy atp(amp.Pmp(), CWorkerPoolManager::WorkerPoolManager());
+
+		CTask *ptskChild = atp.Create(PvUnittest_TaskLocalStorage, (void *) (ULONG_PTR) (ulDepth - 1));
+		atp.Schedule(ptskChild);
+		atp.Wait(ptskChild);
+	}
+
+	for (ULONG ul = 0; ul < 16; ul++)
+	{
+		GPOS_CHECK_ABORT;
+		syslib::SchedYield();
+
+		GPOS_RTL_ASSERT(ptsk == ITask::Self());
+		GPOS_RTL_ASSERT(&tobj == ptsk->GetTls().Get(CTaskLocalStorage::EtlsidxTest));
+	}
+
+	ptsk->GetTls().Remove(&tobj);
+
+	return NULL;
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CWorkerPoolManagerTest::PvUnittest_ForkJoin
+//
+//	@doc:
+//		Count the leaves of a binary tree of tasks of the given depth
+//
+//---------------------------------------------------------------------------
+void *
+CWorkerPoolManagerTest::PvUnittest_ForkJoin
+	(
+	void *pv
+	)
+{
+	SForkJoinArg *arg = (SForkJoinArg *) pv;
+
+	if (0 == arg->m_depth)
+	{
+		arg->m_leaves = 1;
+		return NULL;
+	}
+
+	SForkJoinArg rgarg[2];
+
+	CAutoMemoryPool amp;
+	CAutoTaskProxy atp(amp.Pmp(), CWorkerPoolManager::WorkerPoolManager());
+
+	CTask *rgptsk[2];
+	for (ULONG ul = 0; ul < 2; ul++)
+	{
+		rgarg[ul].m_depth = arg->m_depth - 1;
+		rgarg[ul].m_leaves = 0;
+
+		rgptsk[ul] = atp.Create(PvUnittest_ForkJoin, &rgarg[ul]);
+		atp.Schedule(rgptsk[ul]);
+	}
+
+	arg->m_leaves = 0;
+	for (ULONG ul = 0; ul < 2; ul++)
+	{
+		atp.Wait(rgptsk[ul]);
+		arg->m_leaves += rgarg[ul].m_leaves;
+	}
+
+	return NULL;
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CWorkerPoolManagerTest::PvUnittest_Compute
+//
+//	@doc:
+//		Compute-bound task: iterate a pseudo-random generator seeded with
+//		the value pointed to by the argument and store the result there
+//
+//---------------------------------------------------------------------------
+void *
+CWorkerPoolManagerTest::PvUnittest_Compute
+	(
+	void *pv
+	)
+{
+	ULLONG *pullValue = (ULLONG *) pv;
+
+	ULLONG ull = *pullValue;
+	for (ULONG ul = 0; ul < GPOS_WPM_TEST_ITERATIONS; ul++)
+	{
+		ull ^= ull << 13;
+		ull ^= ull >> 7;
+		ull ^= ull << 17;
+
+		if (0 == ul % 4096)
+		{
+			GPOS_CHECK_ABORT;
+		}
+	}
+	*pullValue = ull;
+
+	return NULL;
+}
+
+// EOF
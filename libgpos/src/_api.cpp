@@ -146,9 +146,23 @@ void gpos_init(struct gpos_init_params* params) {
 		CMessageRepository::GetMessageRepository()->Shutdown();
 		CWorkerPoolManager::WorkerPoolManager()->Shutdown();
 		CMemoryPoolManager::GetMemoryPoolMgr()->Shutdown();
+		return;
 	}
 #endif // GPOS_FPSIMULATOR
 
+	// without pool workers, scheduled tasks run on the waiting thread
+	if (0 < params->num_workers &&
+		GPOS_OK != CWorkerPoolManager::WorkerPoolManager()->StartWorkers(params->num_workers))
+	{
+#ifdef GPOS_FPSIMULATOR
+		CFSimulator::FSim()->Shutdown();
+#endif // GPOS_FPSIMULATOR
+		CMessageRepository::GetMessageRepository()->Shutdown();
+		CWorkerPoolManager::WorkerPoolManager()->Shutdown();
+		CMemoryPoolManager::GetMemoryPoolMgr()->Shutdown();
+		return;
+	}
+
 #ifdef GPOS_DEBUG_COUNTERS
 	CDebugCounter::Init();
 #endif
@@ -207,9 +221,6 @@ int gpos_exec
 
 				CTask *ptsk = atp.Create(params->func, params->arg, params->abort_requested);
 
-				// init TLS
-				ptsk->GetTls().Reset(mp);
-
 				CAutoP<CWStringStatic> apwstr;
 				CAutoP<COstreamString> aposs;
 				CAutoP<CLoggerStream> aplogger;
@@ -282,6 +293,9 @@ int gpos_exec
 //---------------------------------------------------------------------------
 void gpos_terminate()
 {
+	// pool workers are joined in all builds
+	CWorkerPoolManager::WorkerPoolManager()->StopWorkers();
+
 #ifdef GPOS_DEBUG_COUNTERS
 	CDebugCounter::Shutdown();
 #endif
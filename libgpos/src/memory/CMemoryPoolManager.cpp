@@ -21,6 +21,7 @@
 #include "gpos/memory/CMemoryPoolManager.h"
 #include "gpos/memory/CMemoryPoolTracker.h"
 #include "gpos/memory/CMemoryVisitorPrint.h"
+#include "gpos/sync/CAutoMutex.h"
 #include "gpos/task/CAutoSuspendAbort.h"
 
 
@@ -88,6 +89,8 @@ CMemoryPoolManager::Init()
 CMemoryPool *
 CMemoryPoolManager::CreateMemoryPool()
 {
+	CAutoMutex am(m_mutex);
+
 	CMemoryPool *mp = NewMemoryPool();
 
 	// accessor scope
@@ -120,6 +123,8 @@ CMemoryPoolManager::Destroy
 {
 	GPOS_ASSERT(NULL != mp);
 
+	CAutoMutex am(m_mutex);
+
 	// accessor scope
 	{
 		// HERE BE DRAGONS
@@ -139,6 +144,8 @@ CMemoryPoolManager::Destroy
 ULLONG
 CMemoryPoolManager::TotalAllocatedSize()
 {
+	CAutoMutex am(m_mutex);
+
 	ULLONG total_size = 0;
 	MemoryPoolIter iter(*m_ht_all_pools);
 	while (iter.Advance())
@@ -180,6 +187,8 @@ CMemoryPoolManager::OsPrint
 {
 	os << "Print memory pools: " << std::endl;
 
+	CAutoMutex am(m_mutex);
+
 	MemoryPoolIter iter(*m_ht_all_pools);
 	while (iter.Advance())
 	{
@@ -212,6 +221,8 @@ CMemoryPoolManager::PrintOverSizedPools
 	CAutoTraceFlag Net(EtraceSimulateNetError, false);
 	CAutoTraceFlag IO(EtraceSimulateIOError, false);
 
+	CAutoMutex am(m_mutex);
+
 	MemoryPoolIter iter(*m_ht_all_pools);
 	while (iter.Advance())
 	{
@@ -0,0 +1,158 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (C) 2020 VMware, Inc. or its affiliates.
+//
+//	@filename:
+//		CEvent.cpp
+//
+//	@doc:
+//		Implementation of condition variable
+//---------------------------------------------------------------------------
+
+#include <errno.h>
+#include <sys/time.h>
+
+#include "gpos/base.h"
+#include "gpos/sync/CEvent.h"
+
+using namespace gpos;
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CEvent::CEvent
+//
+//	@doc:
+//		Ctor
+//
+//---------------------------------------------------------------------------
+CEvent::CEvent
+	(
+	CMutex *mutex
+	)
+	:
+	m_mutex(mutex)
+{
+	GPOS_ASSERT(NULL != mutex);
+
+#ifdef GPOS_DEBUG
+	INT res =
+#endif // GPOS_DEBUG
+	pthread_cond_init(&m_cond, NULL);
+
+	GPOS_ASSERT(0 == res);
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CEvent::~CEvent
+//
+//	@doc:
+//		Dtor
+//
+//---------------------------------------------------------------------------
+CEvent::~CEvent()
+{
+#ifdef GPOS_DEBUG
+	INT res =
+#endif // GPOS_DEBUG
+	pthread_cond_destroy(&m_cond);
+
+	GPOS_ASSERT(0 == res && "Destroying an event with waiters");
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CEvent::Wait
+//
+//	@doc:
+//		Release the mutex and wait until signaled; the mutex is re-acquired
+//		before returning
+//
+//---------------------------------------------------------------------------
+void
+CEvent::Wait()
+{
+#ifdef GPOS_DEBUG
+	INT res =
+#endif // GPOS_DEBUG
+	pthread_cond_wait(&m_cond, &m_mutex->m_mutex);
+
+	GPOS_ASSERT(0 == res);
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CEvent::TimedWait
+//
+//	@doc:
+//		Release the mutex and wait until signaled or the timeout expired;
+//		the mutex is re-acquired before returning
+//
+//---------------------------------------------------------------------------
+BOOL
+CEvent::TimedWait
+	(
+	ULONG timeout_ms
+	)
+{
+	struct timeval tv;
+	gettimeofday(&tv, NULL);
+
+	ULLONG nsec = (ULLONG) tv.tv_usec * 1000 + (ULLONG) (timeout_ms % 1000) * 1000000;
+
+	struct timespec ts;
+	ts.tv_sec = tv.tv_sec + timeout_ms / 1000 + (time_t) (nsec / 1000000000);
+	ts.tv_nsec = (long) (nsec % 1000000000);
+
+	INT res = pthread_cond_timedwait(&m_cond, &m_mutex->m_mutex, &ts);
+
+	GPOS_ASSERT(0 == res || ETIMEDOUT == res);
+
+	return ETIMEDOUT != res;
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CEvent::Signal
+//
+//	@doc:
+//		Wake up one waiter
+//
+//---------------------------------------------------------------------------
+void
+CEvent::Signal()
+{
+#ifdef GPOS_DEBUG
+	INT res =
+#endif // GPOS_DEBUG
+	pthread_cond_signal(&m_cond);
+
+	GPOS_ASSERT(0 == res);
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CEvent::Broadcast
+//
+//	@doc:
+//		Wake up all waiters
+//
+//---------------------------------------------------------------------------
+void
+CEvent::Broadcast()
+{
+#ifdef GPOS_DEBUG
+	INT res =
+#endif // GPOS_DEBUG
+	pthread_cond_broadcast(&m_cond);
+
+	GPOS_ASSERT(0 == res);
+}
+
+// EOF
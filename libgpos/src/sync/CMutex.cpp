@@ -0,0 +1,116 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (C) 2020 VMware, Inc. or its affiliates.
+//
+//	@filename:
+//		CMutex.cpp
+//
+//	@doc:
+//		Implementation of mutual exclusion lock
+//---------------------------------------------------------------------------
+
+#include <errno.h>
+
+#include "gpos/base.h"
+#include "gpos/sync/CMutex.h"
+
+using namespace gpos;
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CMutex::CMutex
+//
+//	@doc:
+//		Ctor
+//
+//---------------------------------------------------------------------------
+CMutex::CMutex()
+{
+#ifdef GPOS_DEBUG
+	INT res =
+#endif // GPOS_DEBUG
+	pthread_mutex_init(&m_mutex, NULL);
+
+	GPOS_ASSERT(0 == res);
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CMutex::~CMutex
+//
+//	@doc:
+//		Dtor
+//
+//---------------------------------------------------------------------------
+CMutex::~CMutex()
+{
+#ifdef GPOS_DEBUG
+	INT res =
+#endif // GPOS_DEBUG
+	pthread_mutex_destroy(&m_mutex);
+
+	GPOS_ASSERT(0 == res && "Destroying a locked mutex");
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CMutex::Lock
+//
+//	@doc:
+//		Acquire lock
+//
+//---------------------------------------------------------------------------
+void
+CMutex::Lock()
+{
+#ifdef GPOS_DEBUG
+	INT res =
+#endif // GPOS_DEBUG
+	pthread_mutex_lock(&m_mutex);
+
+	GPOS_ASSERT(0 == res);
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CMutex::TryLock
+//
+//	@doc:
+//		Attempt to acquire lock without blocking; returns true on success
+//
+//---------------------------------------------------------------------------
+BOOL
+CMutex::TryLock()
+{
+	INT res = pthread_mutex_trylock(&m_mutex);
+
+	GPOS_ASSERT(0 == res || EBUSY == res);
+
+	return 0 == res;
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CMutex::Unlock
+//
+//	@doc:
+//		Release lock
+//
+//---------------------------------------------------------------------------
+void
+CMutex::Unlock()
+{
+#ifdef GPOS_DEBUG
+	INT res =
+#endif // GPOS_DEBUG
+	pthread_mutex_unlock(&m_mutex);
+
+	GPOS_ASSERT(0 == res);
+}
+
+// EOF
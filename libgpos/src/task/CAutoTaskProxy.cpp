@@ -80,6 +80,15 @@ CAutoTaskProxy::~CAutoTaskProxy()
 void
 CAutoTaskProxy::DestroyAll()
 {
+	// cancel all tasks before waiting for any of them
+	for (CTask *task = m_list.First(); NULL != task; task = m_list.Next(task))
+	{
+		if (task->IsScheduled() && !task->IsReported())
+		{
+			Cancel(task);
+		}
+	}
+
 	// iterate task list
 	while (!m_list.IsEmpty())
 	{
@@ -106,7 +115,14 @@ CAutoTaskProxy::Destroy
 	if (task->IsScheduled() && !task->IsReported())
 	{
 		Cancel(task);
-		task->SetReported();
+
+		// a running task finishes at its next abort check; other tasks are
+		// not executed meanwhile, as they may not finish before canceled
+		{
+			CAutoSuspendAbort asa;
+			(void) PtskAwait(task, false /*help_others*/);
+		}
+
 		CheckError(task);
 	}
 
@@ -171,7 +187,7 @@ CAutoTaskProxy::Create
 	// auto pointer to hold new task
 	// task is created inside ATP's memory pool
 	CAutoP<CTask> new_task;
-	new_task = GPOS_NEW(m_mp) CTask(mp, task_ctxt.Value(), err_ctxt.Value(), cancel);
+	new_task = GPOS_NEW(m_mp) CTask(mp, task_ctxt.Value(), err_ctxt.Value(), cancel, task);
 
 	// reset auto pointers - task now handles task and error context
 	(void) task_ctxt.Reset();
@@ -184,6 +200,10 @@ CAutoTaskProxy::Create
 	task = new_task.Value();
 	task->Bind(pfunc, arg);
 
+	// init TLS; it is allocated in the ATP's memory pool, which outlives
+	// the task's own pool
+	task->GetTls().Reset(m_mp);
+
 	// add to task list
 	m_list.Append(task);
 
@@ -281,6 +301,146 @@ CAutoTaskProxy::FindFinished
 }
 
 
+//---------------------------------------------------------------------------
+//	@function:
+//		CAutoTaskProxy::FExecuteQueued
+//
+//	@doc:
+//		Execute the given task, or the first unfinished task of the ATP that
+//		is still queued if NULL, on the calling worker; returns false if no
+//		such task is queued
+//
+//---------------------------------------------------------------------------
+BOOL
+CAutoTaskProxy::FExecuteQueued
+	(
+	CTask *task
+	)
+{
+	if (NULL != task)
+	{
+		return m_pwpm->FExecuteIfQueued(task);
+	}
+
+	for (CTask *cur_task = m_list.First();
+		 NULL != cur_task;
+		 cur_task = m_list.Next(cur_task))
+	{
+		if (cur_task->IsScheduled() &&
+			!cur_task->IsFinished() &&
+			m_pwpm->FExecuteIfQueued(cur_task))
+		{
+			return true;
+		}
+	}
+
+	return false;
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CAutoTaskProxy::PtskAwait
+//
+//	@doc:
+//		Block until the given task, or any unreported task if NULL, finished;
+//		tasks of the ATP that no worker picked up yet are executed on the
+//		calling worker, then, if requested, tasks queued by others as long
+//		as there is enough stack left
+//
+//---------------------------------------------------------------------------
+CTask *
+CAutoTaskProxy::PtskAwait
+	(
+	CTask *task,
+	BOOL help_others
+	)
+{
+	CWorker *worker = CWorker::Self();
+	GPOS_ASSERT(NULL != worker);
+
+	const BOOL can_help =
+		help_others && worker->CheckStackSize(GPOS_WORKER_HELP_STACK_SIZE);
+
+	while (true)
+	{
+		// read before checking the tasks, so that a completion in between
+		// does not go unnoticed
+		ULONG_PTR num_finished = m_pwpm->NumFinished();
+
+		if (NULL == task)
+		{
+			CTask *finished_task = NULL;
+			if (GPOS_OK == FindFinished(&finished_task))
+			{
+				return finished_task;
+			}
+		}
+		else if (task->IsFinished())
+		{
+			task->SetReported();
+			return task;
+		}
+
+		GPOS_CHECK_ABORT;
+
+		if (FExecuteQueued(task) || (can_help && m_pwpm->FExecuteQueued()))
+		{
+			continue;
+		}
+
+		m_pwpm->WaitProgress(num_finished, can_help);
+	}
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CAutoTaskProxy::Wait
+//
+//	@doc:
+//		Wait for the given task to finish; errors of the task are
+//		propagated to the calling task
+//
+//---------------------------------------------------------------------------
+void
+CAutoTaskProxy::Wait
+	(
+	CTask *task
+	)
+{
+	GPOS_ASSERT(task->IsScheduled() && "Task not scheduled");
+	GPOS_ASSERT(!task->IsReported() && "Task already reported as finished");
+
+	(void) PtskAwait(task, true /*help_others*/);
+
+	CheckError(task);
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CAutoTaskProxy::WaitAny
+//
+//	@doc:
+//		Wait for any scheduled task that was not reported yet to finish;
+//		errors of the task are propagated to the calling task
+//
+//---------------------------------------------------------------------------
+void
+CAutoTaskProxy::WaitAny
+	(
+	CTask **task
+	)
+{
+	GPOS_ASSERT(NULL != task);
+
+	*task = PtskAwait(NULL /*task*/, true /*help_others*/);
+
+	CheckError(*task);
+}
+
+
 //---------------------------------------------------------------------------
 //	@function:
 //		CAutoTaskProxy::Execute
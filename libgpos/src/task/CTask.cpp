@@ -11,6 +11,7 @@
 
 #include "gpos/error/CErrorContext.h"
 #include "gpos/error/CErrorHandlerStandard.h"
+#include "gpos/sync/atomic.h"
 #include "gpos/task/CAutoSuspendAbort.h"
 #include "gpos/task/CTask.h"
 #include "gpos/task/CWorker.h"
@@ -18,7 +19,7 @@
 using namespace gpos;
 
 // init CTaskId's atomic counter
-ULONG_PTR CTaskId::m_counter(0);
+volatile ULONG_PTR CTaskId::m_counter(0);
 
 const CTaskId CTaskId::m_invalid_tid;
 
@@ -35,7 +36,8 @@ CTask::CTask
 	CMemoryPool *mp,
 	CTaskContext *task_ctxt,
 	IErrorContext *err_ctxt,
-	BOOL *cancel
+	BOOL *cancel,
+	CTask *parent
 	)
 	:
 	m_mp(mp),
@@ -48,6 +50,7 @@ CTask::CTask
 	m_status(EtsInit),
 	m_cancel(cancel),
 	m_cancel_local(false),
+	m_parent(parent),
 	m_abort_suspend_count(false),
 	m_reported(false)
 {
@@ -123,7 +126,7 @@ CTask::Execute()
 	ETaskStatus ets = m_status;
 
 	// check for cancel
-	if (*m_cancel)
+	if (IsCanceled())
 	{
 		ets = EtsError;
 	}
@@ -166,6 +169,8 @@ CTask::Execute()
 //	@doc:
 //		Set task status;
 //		Locking is required if updating more than one variable;
+//		the barrier publishes the task's result and error context to the
+//		worker observing the final status
 //
 //---------------------------------------------------------------------------
 void
@@ -174,6 +179,7 @@ CTask::SetStatus(ETaskStatus ets)
 	// status changes are monotonic
 	GPOS_ASSERT(ets >= m_status && "Invalid task status transition");
 
+	MemoryBarrier();
 	m_status = ets;
 }
 
@@ -219,7 +225,12 @@ CTask::IsScheduled() const
 BOOL
 CTask::IsFinished() const
 {
-	switch (m_status)
+	ETaskStatus status = m_status;
+
+	// pairs with the barrier in SetStatus
+	MemoryBarrier();
+
+	switch (status)
 	{
 		case EtsInit:
 		case EtsQueued:
@@ -0,0 +1,213 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (C) 2020 VMware, Inc. or its affiliates.
+//
+//	@filename:
+//		CTaskSchedulerWorkStealing.cpp
+//
+//	@doc:
+//		Implementation of task scheduler with work stealing
+//---------------------------------------------------------------------------
+
+#include "gpos/sync/CAutoMutex.h"
+#include "gpos/sync/atomic.h"
+#include "gpos/task/CTaskSchedulerWorkStealing.h"
+
+using namespace gpos;
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CTaskSchedulerWorkStealing::CTaskSchedulerWorkStealing
+//
+//	@doc:
+//		Ctor; without pool workers only the shared queue is used
+//
+//---------------------------------------------------------------------------
+CTaskSchedulerWorkStealing::CTaskSchedulerWorkStealing()
+	:
+	m_num_queues(1),
+	m_num_queued(0)
+{}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CTaskSchedulerWorkStealing::SetWorkers
+//
+//	@doc:
+//		Set number of pool workers; tasks left in the queues of removed
+//		workers move to the shared queue
+//
+//---------------------------------------------------------------------------
+void
+CTaskSchedulerWorkStealing::SetWorkers
+	(
+	ULONG num_workers
+	)
+{
+	GPOS_ASSERT(GPOS_WORKERPOOL_MAX_WORKERS >= num_workers);
+
+	CAutoMutex am(m_queues[0].m_mutex);
+
+	for (ULONG ul = num_workers + 1; ul < m_num_queues; ul++)
+	{
+		SWorkerQueue &queue = m_queues[ul];
+
+		CAutoMutex amQueue(queue.m_mutex);
+		while (!queue.m_tasks.IsEmpty())
+		{
+			m_queues[0].m_tasks.Append(queue.m_tasks.RemoveHead());
+		}
+	}
+
+	m_num_queues = num_workers + 1;
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CTaskSchedulerWorkStealing::Enqueue
+//
+//	@doc:
+//		Add task to the tail of the given worker's queue
+//
+//---------------------------------------------------------------------------
+void
+CTaskSchedulerWorkStealing::Enqueue
+	(
+	CTask *task,
+	ULONG worker_idx
+	)
+{
+	GPOS_ASSERT(worker_idx < m_num_queues);
+
+	SWorkerQueue &queue = m_queues[worker_idx];
+
+	CAutoMutex am(queue.m_mutex);
+
+	// status is set before the task becomes visible to thieves
+	task->SetStatus(CTask::EtsQueued);
+	queue.m_tasks.Append(task);
+
+	(void) ExchangeAddUlongPtrWithInt(&m_num_queued, 1);
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CTaskSchedulerWorkStealing::PtskTake
+//
+//	@doc:
+//		Take a task from the given end of the given queue; returns NULL
+//		if the queue is empty
+//
+//---------------------------------------------------------------------------
+CTask *
+CTaskSchedulerWorkStealing::PtskTake
+	(
+	ULONG queue_idx,
+	BOOL from_tail
+	)
+{
+	SWorkerQueue &queue = m_queues[queue_idx];
+
+	CAutoMutex am(queue.m_mutex);
+
+	if (queue.m_tasks.IsEmpty())
+	{
+		return NULL;
+	}
+
+	CTask *task = NULL;
+	if (from_tail)
+	{
+		task = queue.m_tasks.RemoveTail();
+	}
+	else
+	{
+		task = queue.m_tasks.RemoveHead();
+	}
+
+	task->SetStatus(CTask::EtsDequeued);
+
+	(void) ExchangeAddUlongPtrWithInt(&m_num_queued, -1);
+
+	return task;
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CTaskSchedulerWorkStealing::Dequeue
+//
+//	@doc:
+//		Get the most recently queued task of the given worker; if there is
+//		none, steal the oldest task of another queue
+//
+//---------------------------------------------------------------------------
+CTask *
+CTaskSchedulerWorkStealing::Dequeue
+	(
+	ULONG worker_idx
+	)
+{
+	GPOS_ASSERT(worker_idx < m_num_queues);
+
+	if (IsEmpty())
+	{
+		return NULL;
+	}
+
+	CTask *task = PtskTake(worker_idx, true /*from_tail*/);
+
+	for (ULONG ul = 1; NULL == task && ul < m_num_queues; ul++)
+	{
+		task = PtskTake((worker_idx + ul) % m_num_queues, false /*from_tail*/);
+	}
+
+	return task;
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CTaskSchedulerWorkStealing::Remove
+//
+//	@doc:
+//		Remove the given task if it is still queued and mark it as dequeued;
+//		recently queued tasks are found first
+//
+//---------------------------------------------------------------------------
+GPOS_RESULT
+CTaskSchedulerWorkStealing::Remove
+	(
+	CTask *task
+	)
+{
+	for (ULONG ul = 0; ul < m_num_queues; ul++)
+	{
+		SWorkerQueue &queue = m_queues[ul];
+
+		CAutoMutex am(queue.m_mutex);
+
+		for (CTask *task_it = queue.m_tasks.Last();
+			 NULL != task_it;
+			 task_it = queue.m_tasks.Prev(task_it))
+		{
+			if (task_it == task)
+			{
+				queue.m_tasks.Remove(task);
+				task->SetStatus(CTask::EtsDequeued);
+
+				(void) ExchangeAddUlongPtrWithInt(&m_num_queued, -1);
+
+				return GPOS_OK;
+			}
+		}
+	}
+
+	return GPOS_NOT_FOUND;
+}
+
+// EOF
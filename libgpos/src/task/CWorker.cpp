@@ -33,12 +33,14 @@ bool (*CWorker::abort_requested_by_system) (void);
 CWorker::CWorker
 	(
 	ULONG stack_size,
-	ULONG_PTR stack_start
+	ULONG_PTR stack_start,
+	ULONG idx
 	)
 	:
 	m_task(NULL),
 	m_stack_size(stack_size),
-	m_stack_start(stack_start)
+	m_stack_start(stack_start),
+	m_idx(idx)
 {
 	GPOS_ASSERT(stack_size >= 2 * 1024 && "Worker has to have at least 2KB stack");
 
@@ -71,24 +73,28 @@ CWorker::~CWorker()
 //		CWorker::Execute
 //
 //	@doc:
-//		Execute single task
+//		Execute single task; a task waiting for a subtask may execute other
+//		tasks on its worker, in which case the waiting task is resumed
+//		as the worker's task afterwards
 //
 //---------------------------------------------------------------------------
 void
 CWorker::Execute(CTask *task)
 {
 	GPOS_ASSERT(task);
-	GPOS_ASSERT(NULL == m_task && "Another task is assigned to worker");
+	GPOS_ASSERT(task != m_task && "Task is already assigned to worker");
+
+	CTask *task_waiting = m_task;
 
 	m_task = task;
 	GPOS_TRY
 	{
 		m_task->Execute();
-		m_task = NULL;
+		m_task = task_waiting;
 	}
 	GPOS_CATCH_EX(ex)
 	{
-		m_task = NULL;
+		m_task = task_waiting;
 		GPOS_RETHROW(ex);
 	}
 	GPOS_CATCH_END;
@@ -16,6 +16,9 @@
 #include "gpos/memory/CMemoryPoolManager.h"
 #include "gpos/memory/CMemoryPool.h"
 
+#include "gpos/sync/CAutoMutex.h"
+#include "gpos/sync/atomic.h"
+#include "gpos/task/CAutoSuspendAbort.h"
 #include "gpos/task/CWorkerPoolManager.h"
 
 using namespace gpos;
@@ -25,6 +28,11 @@ using namespace gpos;
 //---------------------------------------------------------------------------
 CWorkerPoolManager *CWorkerPoolManager::m_worker_pool_manager = NULL;
 
+//---------------------------------------------------------------------------
+// worker of the current thread
+//---------------------------------------------------------------------------
+__thread CWorker *CWorkerPoolManager::m_self = NULL;
+
 
 //---------------------------------------------------------------------------
 //	@function:
@@ -42,7 +50,11 @@ CWorkerPoolManager::CWorkerPoolManager
 	m_mp(mp),
 	m_auto_task_proxy_counter(0),
 	m_active(false),
-	m_single_worker(NULL)
+	m_event(&m_mutex),
+	m_num_sleepers(0),
+	m_num_finished(0),
+	m_num_workers(0),
+	m_stop(false)
 {
 	// initialize hash table
 	m_shtTS.Init
@@ -121,6 +133,9 @@ CWorkerPoolManager::Shutdown()
 	GPOS_ASSERT(0 == worker_pool_manager->m_auto_task_proxy_counter &&
 			    "AutoTaskProxy alive at worker pool shutdown");
 
+	// stop pool workers
+	worker_pool_manager->StopWorkers();
+
 	// stop scheduling tasks
 	worker_pool_manager->m_active = false;
 
@@ -150,8 +165,8 @@ CWorkerPoolManager::RegisterWorker
 	)
 {
 	GPOS_ASSERT(NULL != worker);
-	GPOS_ASSERT(NULL == m_single_worker);
-	m_single_worker = worker;
+	GPOS_ASSERT(NULL == m_self && "Found registered worker");
+	m_self = worker;
 }
 
 
@@ -166,7 +181,7 @@ CWorkerPoolManager::RegisterWorker
 void
 CWorkerPoolManager::RemoveWorker()
 {
-	m_single_worker = NULL;
+	m_self = NULL;
 }
 
 
@@ -186,6 +201,8 @@ CWorkerPoolManager::RegisterTask
 {
 	GPOS_ASSERT(m_active && "Worker pool is not operating");
 
+	CAutoMutex am(m_mutex_tasks);
+
 	// get access
 	CTaskId &tid = task->m_tid;
 	CSyncHashtableAccessByKey<CTask, CTaskId> shta(m_shtTS, tid);
@@ -216,6 +233,8 @@ CWorkerPoolManager::RemoveTask
 
 	// scope for hash table accessor
 	{
+		CAutoMutex am(m_mutex_tasks);
+
 		// get access
 		CSyncHashtableAccessByKey<CTask, CTaskId> shta(m_shtTS, tid);
 
@@ -246,8 +265,10 @@ CWorkerPoolManager::Schedule
 {
 	GPOS_ASSERT(m_active && "Worker pool is not operating");
 
-	// add task to scheduler's queue
-	m_task_scheduler.Enqueue(task);
+	// add task to the queue of the calling worker
+	m_task_scheduler.Enqueue(task, WorkerIdx());
+
+	SignalQueued();
 
 	GPOS_CHECK_ABORT;
 }
@@ -267,38 +288,367 @@ CWorkerPoolManager::Cancel
 	CTaskId tid
 	)
 {
-	BOOL is_queued = false;
-
 	CTask *task = NULL;
 
 	// scope for hash table accessor
 	{
+		CAutoMutex am(m_mutex_tasks);
+
 		CSyncHashtableAccessByKey<CTask, CTaskId> shta(m_shtTS, tid);
 		task = shta.Find();
 		if (NULL != task)
 		{
 			task->Cancel();
-			is_queued = (CTask::EtsQueued == task->m_status);
 		}
 	}
 
-	// remove task from scheduler's queue
-	if (is_queued)
+	// remove task from scheduler's queue; a worker may have dequeued it in
+	// the meantime, in which case it observes the cancellation flag
+	if (NULL != task && GPOS_OK == m_task_scheduler.Remove(task))
+	{
+		// signal task completion
+		task->SetStatus(CTask::EtsError);
+		SignalFinished();
+	}
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CWorkerPoolManager::SignalQueued
+//
+//	@doc:
+//		Wake up sleeping threads after a task was queued; the scheduler
+//		publishes the task before the lock is taken, so a thread going to
+//		sleep concurrently either is counted here or finds the task itself
+//
+//---------------------------------------------------------------------------
+void
+CWorkerPoolManager::SignalQueued()
+{
+	CAutoMutex am(m_mutex);
+
+	if (0 < m_num_sleepers)
+	{
+		m_event.Broadcast();
+	}
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CWorkerPoolManager::SignalFinished
+//
+//	@doc:
+//		Announce the completion of a task to waiting threads
+//
+//---------------------------------------------------------------------------
+void
+CWorkerPoolManager::SignalFinished()
+{
+	(void) ExchangeAddUlongPtrWithInt(&m_num_finished, 1);
+
+	CAutoMutex am(m_mutex);
+
+	if (0 < m_num_sleepers)
 	{
-		GPOS_ASSERT(NULL != task);
+		m_event.Broadcast();
+	}
+}
 
-		GPOS_RESULT eres = GPOS_OK;
 
-		eres = m_task_scheduler.Cancel(task);
+//---------------------------------------------------------------------------
+//	@function:
+//		CWorkerPoolManager::Execute
+//
+//	@doc:
+//		Run a dequeued task on the given worker; errors raised by the task
+//		are kept in its error context for the owning ATP to report
+//
+//---------------------------------------------------------------------------
+void
+CWorkerPoolManager::Execute
+	(
+	CWorker *worker,
+	CTask *task
+	)
+{
+	GPOS_ASSERT(NULL != worker);
+	GPOS_ASSERT(CTask::EtsDequeued == task->GetStatus());
 
-		// if task was dequeued, signal task completion
-		if (GPOS_OK == eres)
+	GPOS_TRY
+	{
+		worker->Execute(task);
+	}
+	GPOS_CATCH_EX(ex)
+	{
+		if (!task->IsFinished())
 		{
 			task->SetStatus(CTask::EtsError);
 		}
 	}
+	GPOS_CATCH_END;
+
+	SignalFinished();
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CWorkerPoolManager::FExecuteIfQueued
+//
+//	@doc:
+//		Execute the given task on the calling worker unless a pool worker
+//		has already picked it up; returns true if the task was executed
+//
+//---------------------------------------------------------------------------
+BOOL
+CWorkerPoolManager::FExecuteIfQueued
+	(
+	CTask *task
+	)
+{
+	if (GPOS_OK != m_task_scheduler.Remove(task))
+	{
+		return false;
+	}
+
+	Execute(Self(), task);
+
+	return true;
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CWorkerPoolManager::FExecuteQueued
+//
+//	@doc:
+//		Execute the next queued task on the calling worker; returns false if
+//		there is no queued task or not enough stack to run one
+//
+//---------------------------------------------------------------------------
+BOOL
+CWorkerPoolManager::FExecuteQueued()
+{
+	CWorker *worker = Self();
+	GPOS_ASSERT(NULL != worker);
+
+	if (!worker->CheckStackSize(GPOS_WORKER_HELP_STACK_SIZE))
+	{
+		return false;
+	}
+
+	CTask *task = m_task_scheduler.Dequeue(worker->GetIdx());
+	if (NULL == task)
+	{
+		return false;
+	}
+
+	Execute(worker, task);
+
+	return true;
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CWorkerPoolManager::WaitProgress
+//
+//	@doc:
+//		Block the calling thread until another task finished, a task was
+//		queued that the caller can help with, or the wait interval elapsed
+//
+//---------------------------------------------------------------------------
+void
+CWorkerPoolManager::WaitProgress
+	(
+	ULONG_PTR num_finished,
+	BOOL can_help
+	)
+{
+	CAutoMutex am(m_mutex);
+
+	if (num_finished == m_num_finished &&
+		!(can_help && !m_task_scheduler.IsEmpty()))
+	{
+		m_num_sleepers++;
+		(void) m_event.TimedWait(GPOS_WORKERPOOL_WAIT_MSEC);
+		m_num_sleepers--;
+	}
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CWorkerPoolManager::RunWorker
+//
+//	@doc:
+//		Main loop of a pool worker: execute queued tasks, stealing them from
+//		other workers if needed, and sleep while there are none
+//
+//---------------------------------------------------------------------------
+void
+CWorkerPoolManager::RunWorker
+	(
+	CWorker *worker
+	)
+{
+	while (true)
+	{
+		CTask *task = m_task_scheduler.Dequeue(worker->GetIdx());
+		if (NULL != task)
+		{
+			Execute(worker, task);
+			continue;
+		}
+
+		BOOL stop = false;
+
+		// scope for lock
+		{
+			CAutoMutex am(m_mutex);
+
+			m_num_sleepers++;
+			while (!m_stop && m_task_scheduler.IsEmpty())
+			{
+				m_event.Wait();
+			}
+			m_num_sleepers--;
+
+			stop = m_stop;
+		}
+
+		if (stop)
+		{
+			return;
+		}
+	}
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CWorkerPoolManager::RunWorkerThread
+//
+//	@doc:
+//		Entry point of the thread of a pool worker; the argument is the
+//		index of the worker's queue
+//
+//---------------------------------------------------------------------------
+void *
+CWorkerPoolManager::RunWorkerThread
+	(
+	void *arg
+	)
+{
+	CWorkerPoolManager *worker_pool_manager = WorkerPoolManager();
+	GPOS_ASSERT(NULL != worker_pool_manager);
+
+	// the worker is registered as the worker of this thread
+	CWorker worker(GPOS_WORKER_STACK_SIZE, (ULONG_PTR) &worker_pool_manager, (ULONG) (ULONG_PTR) arg);
+
+	worker_pool_manager->RunWorker(&worker);
+
+	return NULL;
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CWorkerPoolManager::StartWorkers
+//
+//	@doc:
+//		Spawn the given number of pool workers; must not run concurrently
+//		with tasks being scheduled
+//
+//---------------------------------------------------------------------------
+GPOS_RESULT
+CWorkerPoolManager::StartWorkers
+	(
+	ULONG num_workers
+	)
+{
+	GPOS_ASSERT(m_active && "Worker pool is not operating");
+	GPOS_ASSERT(0 == m_num_workers && "Pool workers are already running");
+
+	if (GPOS_WORKERPOOL_MAX_WORKERS < num_workers)
+	{
+		return GPOS_FAILED;
+	}
+
+	m_task_scheduler.SetWorkers(num_workers);
+
+	pthread_attr_t attr;
+	if (0 != pthread_attr_init(&attr))
+	{
+		m_task_scheduler.SetWorkers(0);
+		return GPOS_FAILED;
+	}
+
+	// leave room below the stack limit enforced by the worker
+	(void) pthread_attr_setstacksize(&attr, 2 * GPOS_WORKER_STACK_SIZE);
+
+	GPOS_RESULT eres = GPOS_OK;
+	while (m_num_workers < num_workers)
+	{
+		void *arg = (void *) (ULONG_PTR) (m_num_workers + 1);
+		if (0 != pthread_create(&m_threads[m_num_workers], &attr, RunWorkerThread, arg))
+		{
+			eres = GPOS_FAILED;
+			break;
+		}
+
+		m_num_workers++;
+	}
+
+	(void) pthread_attr_destroy(&attr);
+
+	if (GPOS_OK != eres)
+	{
+		StopWorkers();
+	}
+
+	return eres;
 }
 
 
+//---------------------------------------------------------------------------
+//	@function:
+//		CWorkerPoolManager::StopWorkers
+//
+//	@doc:
+//		Stop and join all pool workers; tasks that are still queued are left
+//		to the threads waiting for them
+//
+//---------------------------------------------------------------------------
+void
+CWorkerPoolManager::StopWorkers()
+{
+	// scope for lock
+	{
+		CAutoMutex am(m_mutex);
+
+		m_stop = true;
+		m_event.Broadcast();
+	}
+
+	for (ULONG ul = 0; ul < m_num_workers; ul++)
+	{
+#ifdef GPOS_DEBUG
+		INT res =
+#endif // GPOS_DEBUG
+		pthread_join(m_threads[ul], NULL);
+
+		GPOS_ASSERT(0 == res);
+	}
+
+	m_num_workers = 0;
+	m_task_scheduler.SetWorkers(0);
+
+	CAutoMutex am(m_mutex);
+	m_stop = false;
+}
+
 // EOF
 
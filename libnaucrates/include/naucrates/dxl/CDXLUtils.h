@@ -76,10 +76,21 @@ namespace gpdxl
 				const CWStringBase *dxl_string,
 				const CHAR *xsd_file_path
 				);
-			
 
+			// parse the given DXL string with the streaming parser, which
+			// does not validate the document
+			static
+			CParseHandlerDXL *GetParseHandlerForTrustedDXLString
+				(
+				CMemoryPool *,
+				const CHAR *dxl_string
+				);
 
 		public:
+			// check if DXL input should be parsed with the streaming parser
+			static
+			BOOL FUseStreamingParser(const CHAR *xsd_file_path);
+
 			// helper functions for serializing DXL document header and footer, respectively
 			static void SerializeHeader(CMemoryPool *, CXMLSerializer *);
 			static void SerializeFooter(CXMLSerializer *);
@@ -96,6 +96,11 @@ namespace gpdxl
 				return m_mdid_type;
 			}
 
+			// replace the type mdid with a copy allocated in the datum's own
+			// memory pool, so that the datum does not refer to the metadata
+			// object the mdid was taken from
+			void DetachMDIdType();
+
 			INT
 			TypeModifier() const;
 
@@ -78,6 +78,11 @@ namespace gpdxl
 			static 
 			TokenParseHandlerFuncMap *m_token_parse_handler_func_map;
 
+			// mappings DXL token -> ParseHandler creator, indexed by token type;
+			// tokens spelled alike share their creator
+			static
+			ParseHandlerOpCreatorFunc **m_token_parse_handler_func_array;
+
 			static 
 			void AddMapping(Edxltoken token_type, ParseHandlerOpCreatorFunc *parse_handler_op_func);
 						
@@ -1682,6 +1687,16 @@ namespace gpdxl
 				CParseHandlerBase *parse_handler_root
 				);
 
+			// return the parse handler creator for operator with the given token
+			static
+			CParseHandlerBase *GetParseHandler
+				(
+				CMemoryPool *mp,
+				Edxltoken token_type,
+				CParseHandlerManager *parse_handler_mgr,
+				CParseHandlerBase *parse_handler_root
+				);
+
 			// factory methods for creating parse handlers
 			static 
 			CParseHandlerDXL *GetParseHandlerDXL
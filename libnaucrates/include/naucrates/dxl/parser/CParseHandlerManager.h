@@ -44,12 +44,16 @@ namespace gpdxl
 	//---------------------------------------------------------------------------
 	class CParseHandlerManager
 	{
+		// the streaming parser dispatches events to the current handler
+		friend class CDXLStreamParser;
+
 		private:
 		
 			// the memory manager used for parsing the current document
 		CDXLMemoryManager *m_dxl_memory_manager;
 			
-			// parser object responsible for parsing the current XML document
+			// parser object responsible for parsing the current XML document;
+			// NULL if the document is parsed by the streaming DXL parser
 			SAX2XMLReader *m_xml_reader;
 			
 			// current parse handler
@@ -60,10 +64,17 @@ namespace gpdxl
 		
 			// steps since last check for aborts
 			ULONG m_iteration_since_last_abortcheck;
+
+			// token of the element being started, as resolved by the streaming
+			// DXL parser; EdxltokenSentinel otherwise
+			Edxltoken m_curr_element_token;
 			
 			// check for aborts at regular intervals
 			void CheckForAborts();
 
+			// install the given handler in the XML reader
+			void SetReaderHandler(CParseHandlerBase *parse_handler_base);
+
 			// private copy ctor
 			CParseHandlerManager(const CParseHandlerManager &);
 			
@@ -104,6 +115,12 @@ namespace gpdxl
 			
 			// Returns the current parse handler if one exists; used for debugging purposes
 			const CParseHandlerBase *GetCurrentParseHandler();
+
+			// token of the element being started, if known
+			Edxltoken GetCurrentElementToken() const
+			{
+				return m_curr_element_token;
+			}
 			
 	};
 }
@@ -0,0 +1,299 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (C) 2020 VMware, Inc. or its affiliates.
+//
+//	@filename:
+//		CDXLStreamParser.h
+//
+//	@doc:
+//		Non-validating streaming parser for trusted DXL documents
+//---------------------------------------------------------------------------
+#ifndef GPDXL_CDXLStreamParser_H
+#define GPDXL_CDXLStreamParser_H
+
+#include "gpos/base.h"
+
+#include "naucrates/dxl/xml/dxltokens.h"
+
+#include <xercesc/sax2/Attributes.hpp>
+
+namespace gpdxl
+{
+	using namespace gpos;
+
+	XERCES_CPP_NAMESPACE_USE
+
+	// fwd decl
+	class CParseHandlerBase;
+	class CParseHandlerManager;
+
+	//---------------------------------------------------------------------------
+	//	@class:
+	//		CDXLStreamParser
+	//
+	//	@doc:
+	//		Parser for UTF-8 encoded DXL documents held in memory, used in place
+	//		of Xerces for input that is known to be well-formed, such as
+	//		documents produced by ORCA itself or by the database.
+	//
+	//		The parser drives the parse handlers installed in a parse handler
+	//		manager through the same SAX callbacks Xerces would invoke. Element
+	//		and attribute names are resolved to DXL tokens through a perfect
+	//		hash and handed to the handlers as the token strings, so that no
+	//		names are transcoded for documents consisting of DXL tokens only.
+	//		Attribute values are transcoded into a buffer that is reused across
+	//		elements.
+	//
+	//		The parser checks that tags are balanced and reports malformed
+	//		markup, but neither validates the document nor supports document
+	//		type declarations. Character data is not reported, as no DXL parse
+	//		handler consumes it.
+	//
+	//---------------------------------------------------------------------------
+	class CDXLStreamParser
+	{
+		private:
+
+			// attribute of the element being parsed
+			struct SAttribute
+			{
+				// name as a DXL token string, or NULL if held in the buffer
+				const XMLCh *m_xmlszName;
+
+				// offset of the name in the buffer
+				ULONG m_ulNameOffset;
+
+				// offset of the value in the buffer
+				ULONG m_ulValueOffset;
+
+				// value, set once all attributes of the element are parsed
+				const XMLCh *m_xmlszValue;
+			};
+
+			//---------------------------------------------------------------------------
+			//	@class:
+			//		CAttributes
+			//
+			//	@doc:
+			//		SAX attribute list over the attributes of the current element
+			//
+			//---------------------------------------------------------------------------
+			class CAttributes : public Attributes
+			{
+				private:
+
+					// attributes, owned by the parser
+					const SAttribute *m_rgattr;
+
+					// number of attributes
+					ULONG m_ulAttrs;
+
+					// private copy ctor
+					CAttributes(const CAttributes &);
+
+				public:
+
+					// ctor
+					CAttributes()
+						:
+						m_rgattr(NULL),
+						m_ulAttrs(0)
+					{}
+
+					// dtor
+					virtual
+					~CAttributes()
+					{}
+
+					// reset to the attributes of a new element
+					void Reset
+						(
+						const SAttribute *rgattr,
+						ULONG ulAttrs
+						)
+					{
+						m_rgattr = rgattr;
+						m_ulAttrs = ulAttrs;
+					}
+
+					// Attributes interface
+					virtual
+					XMLSize_t getLength() const;
+
+					virtual
+					const XMLCh *getURI(const XMLSize_t index) const;
+
+					virtual
+					const XMLCh *getLocalName(const XMLSize_t index) const;
+
+					virtual
+					const XMLCh *getQName(const XMLSize_t index) const;
+
+					virtual
+					const XMLCh *getType(const XMLSize_t index) const;
+
+					virtual
+					const XMLCh *getValue(const XMLSize_t index) const;
+
+					virtual
+					bool getIndex(const XMLCh *const uri, const XMLCh *const local_part, XMLSize_t &index) const;
+
+					virtual
+					int getIndex(const XMLCh *const uri, const XMLCh *const local_part) const;
+
+					virtual
+					bool getIndex(const XMLCh *const qname, XMLSize_t &index) const;
+
+					virtual
+					int getIndex(const XMLCh *const qname) const;
+
+					virtual
+					const XMLCh *getType(const XMLCh *const uri, const XMLCh *const local_part) const;
+
+					virtual
+					const XMLCh *getType(const XMLCh *const qname) const;
+
+					virtual
+					const XMLCh *getValue(const XMLCh *const uri, const XMLCh *const local_part) const;
+
+					virtual
+					const XMLCh *getValue(const XMLCh *const qname) const;
+
+			}; // class CAttributes
+
+			// memory pool
+			CMemoryPool *m_mp;
+
+			// parse handler manager holding the active handler
+			CParseHandlerManager *m_parse_handler_mgr;
+
+			// current position in the document
+			const CHAR *m_szCurrent;
+
+			// end of the document
+			const CHAR *m_szEnd;
+
+			// buffer holding transcoded names and values of the current element
+			XMLCh *m_xmlszBuffer;
+
+			// capacity of the buffer
+			ULONG m_ulBufferCapacity;
+
+			// used part of the buffer
+			ULONG m_ulBufferUsed;
+
+			// attributes of the current element
+			SAttribute *m_rgattr;
+
+			// capacity of the attribute array
+			ULONG m_ulAttrCapacity;
+
+			// attribute list handed to the parse handlers
+			CAttributes m_attrs;
+
+			// start of the names of the open elements
+			const CHAR **m_rgszOpenElements;
+
+			// lengths of the names of the open elements
+			ULONG *m_rgulOpenElementLengths;
+
+			// capacity of the open element stack
+			ULONG m_ulOpenElementCapacity;
+
+			// number of open elements
+			ULONG m_ulOpenElements;
+
+			// private copy ctor
+			CDXLStreamParser(const CDXLStreamParser &);
+
+			// raise a parse error
+			static
+			void RaiseParseError();
+
+			// check if the given character is XML whitespace
+			static
+			BOOL FWhitespace
+				(
+				CHAR c
+				)
+			{
+				return ' ' == c || '\t' == c || '\n' == c || '\r' == c;
+			}
+
+			// current parse handler, NULL once the root handler finished
+			CParseHandlerBase *PphCurrent() const;
+
+			// check if the remaining input starts with the given literal
+			BOOL FStartsWith(const CHAR *szLiteral, ULONG length) const;
+
+			// skip whitespace
+			void SkipWhitespace();
+
+			// skip input up to and including the given terminator
+			void SkipPast(const CHAR *szTerminator, ULONG length);
+
+			// scan a name, returning its length
+			ULONG UlScanName();
+
+			// make room for the given number of characters in the buffer
+			void EnsureBufferCapacity(ULONG ulChars);
+
+			// make room for one more attribute
+			void EnsureAttrCapacity(ULONG ulAttrs);
+
+			// append a character to the buffer
+			void Append
+				(
+				XMLCh xmlch
+				)
+			{
+				m_xmlszBuffer[m_ulBufferUsed++] = xmlch;
+			}
+
+			// transcode the given UTF-8 text into the buffer and return its offset;
+			// entity and character references are expanded if requested
+			ULONG UlTranscode(const CHAR *sz, ULONG length, BOOL fAttributeValue);
+
+			// decode one UTF-8 encoded code point
+			static
+			ULONG UlDecodeUtf8(const CHAR **psz, const CHAR *szEnd);
+
+			// decode an entity or character reference following an ampersand
+			static
+			ULONG UlDecodeReference(const CHAR **psz, const CHAR *szEnd);
+
+			// append a code point to the buffer as UTF-16
+			void AppendCodePoint(ULONG ulCodePoint);
+
+			// return the DXL token string spelling the given name and set its
+			// token; names that are not DXL tokens are transcoded into the
+			// buffer, in which case NULL is returned, the token is set to
+			// EdxltokenSentinel and the offset of the name is set
+			const XMLCh *XmlszLookupName(const CHAR *szName, ULONG length, Edxltoken *ptoken, ULONG *pulOffset);
+
+			// parse a start tag following the opening bracket
+			void ParseStartTag();
+
+			// parse an end tag following the opening bracket and slash
+			void ParseEndTag();
+
+			// notify the current handler about an element end
+			void NotifyEndElement(const CHAR *szName, ULONG length);
+
+		public:
+
+			// ctor
+			CDXLStreamParser(CMemoryPool *mp, CParseHandlerManager *parse_handler_mgr);
+
+			// dtor
+			~CDXLStreamParser();
+
+			// parse the given document, invoking the handlers of the manager
+			void Parse(const CHAR *dxl_string, ULONG length);
+
+	}; // class CDXLStreamParser
+}
+
+#endif // !GPDXL_CDXLStreamParser_H
+
+// EOF
@@ -817,9 +817,37 @@ namespace gpdxl
 			static
 			CDXLMemoryManager *m_dxl_memory_manager;
 
+			// slots of the perfect hash table mapping token names to tokens
+			static
+			Edxltoken *m_pedxltSlots;
+
+			// displacement of each bucket of the perfect hash table
+			static
+			ULONG *m_pulDisplacements;
+
+			// number of slots of the perfect hash table, a power of two
+			static
+			ULONG m_ulSlots;
+
+			// number of buckets of the perfect hash table
+			static
+			ULONG m_ulBuckets;
+
 			// create a string in Xerces XMLCh* format
 			static 
 			XMLCh *XmlstrFromWsz(const WCHAR *wsz);
+
+			// hash function for token names given in UTF-8 format
+			static
+			ULONG UlHashName(const CHAR *sz, ULONG length, ULONG seed);
+
+			// check if the given name spells the given token
+			static
+			BOOL FTokenMatches(Edxltoken token_type, const CHAR *sz, ULONG length);
+
+			// build the perfect hash table over the distinct token names
+			static
+			void InitPerfectHash();
 			
 		public:
 			
@@ -829,6 +857,11 @@ namespace gpdxl
 			
 			static 
 			const XMLCh *XmlstrToken(Edxltoken token_type);
+
+			// look up the token spelled by the given UTF-8 name, which need not
+			// be null-terminated; returns EdxltokenSentinel for unknown names
+			static
+			Edxltoken EdxltokenLookup(const CHAR *sz, ULONG length);
 		
 			// initialize constants. Must be called before constants are accessed.
 			static 
@@ -0,0 +1,138 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (C) 2020 VMware, Inc. or its affiliates.
+//
+//	@filename:
+//		CMDIndexApplicabilityMap.h
+//
+//	@doc:
+//		Map of the partition ranges of a relation to the indexes covering them
+//---------------------------------------------------------------------------
+
+#ifndef GPMD_CMDIndexApplicabilityMap_H
+#define GPMD_CMDIndexApplicabilityMap_H
+
+#include "gpos/base.h"
+#include "gpos/common/CHashMap.h"
+#include "gpos/common/CRefCount.h"
+#include "gpos/string/CWStringDynamic.h"
+
+#include "naucrates/md/IMDPartConstraint.h"
+
+namespace gpmd
+{
+	using namespace gpos;
+
+	//---------------------------------------------------------------------------
+	//	@class:
+	//		CMDIndexApplicabilityMap
+	//
+	//	@doc:
+	//		Groups the indexes of a relation by the partition range they are
+	//		defined on, i.e., by their part constraint. Indexes with equal part
+	//		constraints share a range id, so that callers translate and compare
+	//		the part constraint of a range once instead of once per index.
+	//		The map also lists the partial indexes of the relation, so that
+	//		callers interested in partial indexes only need not look at all
+	//		indexes.
+	//
+	//		The map is built once per relation version by the metadata accessor
+	//		and kept in the metadata cache, keyed by the relation mdid. It only
+	//		holds positions in the index list of the relation.
+	//
+	//---------------------------------------------------------------------------
+	class CMDIndexApplicabilityMap : public CRefCount
+	{
+		private:
+
+			// array of serialized part constraints
+			typedef CDynamicPtrArray<CWStringDynamic, CleanupDelete> CWStringDynamicArray;
+
+			// map of the hash of a serialized part constraint to range ids
+			typedef CHashMap<ULONG, ULongPtrArray, gpos::HashValue<ULONG>, gpos::Equals<ULONG>,
+						CleanupDelete<ULONG>, CleanupRelease<ULongPtrArray> > UlongToUlongPtrArrayMap;
+
+			// memory pool
+			CMemoryPool *m_mp;
+
+			// range id of each index, by index position
+			ULongPtrArray *m_range_id_array;
+
+			// positions of the indexes on each range, by range id
+			ULongPtr2dArray *m_range_index_pos_array;
+
+			// positions of the partial indexes
+			ULongPtrArray *m_partial_index_pos_array;
+
+			// serialized part constraint of each range, by range id
+			CWStringDynamicArray *m_part_constraint_str_array;
+
+			// range ids by the hash of their serialized part constraint
+			UlongToUlongPtrArrayMap *m_hash_range_ids_map;
+
+			// private copy ctor
+			CMDIndexApplicabilityMap(const CMDIndexApplicabilityMap &);
+
+			// serialize the given part constraint, NULL constraints serialize
+			// to the empty string
+			CWStringDynamic *SerializePartConstraint(const IMDPartConstraint *mdpart_constraint) const;
+
+			// id of the range with the given serialized part constraint, adding
+			// a new range if not found; takes ownership of the string
+			ULONG RangeId(CWStringDynamic *part_constraint_str);
+
+		public:
+
+			// ctor
+			explicit
+			CMDIndexApplicabilityMap(CMemoryPool *mp);
+
+			// dtor
+			virtual
+			~CMDIndexApplicabilityMap();
+
+			// add the index at the next position of the index list
+			void AddIndex(BOOL is_partial, const IMDPartConstraint *mdpart_constraint);
+
+			// number of indexes
+			ULONG IndexCount() const
+			{
+				return m_range_id_array->Size();
+			}
+
+			// range id of the index at the given position
+			ULONG RangeIdAt(ULONG index_pos) const
+			{
+				return *(*m_range_id_array)[index_pos];
+			}
+
+			// number of distinct ranges
+			ULONG RangeCount() const
+			{
+				return m_range_index_pos_array->Size();
+			}
+
+			// positions of the indexes on the given range, in index list order
+			const ULongPtrArray *IndexPosForRange(ULONG range_id) const
+			{
+				return (*m_range_index_pos_array)[range_id];
+			}
+
+			// number of partial indexes
+			ULONG PartialIndexCount() const
+			{
+				return m_partial_index_pos_array->Size();
+			}
+
+			// position of the given partial index in the index list
+			ULONG PartialIndexPosAt(ULONG pos) const
+			{
+				return *(*m_partial_index_pos_array)[pos];
+			}
+
+	}; // class CMDIndexApplicabilityMap
+}
+
+#endif // !GPMD_CMDIndexApplicabilityMap_H
+
+// EOF
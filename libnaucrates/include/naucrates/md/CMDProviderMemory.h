@@ -38,13 +38,13 @@ namespace gpmd
 	{
 		protected:
 	
-			// hash map of serialized MD objects indexed by their MD id 
-			typedef CHashMap<IMDId, CWStringDynamic, 
+			// hash map of MD objects indexed by their MD id
+			typedef CHashMap<IMDId, IMDCacheObject,
 							IMDId::MDIdHash, IMDId::MDIdCompare,
-							CleanupRelease, CleanupDelete> MDIdToSerializedMDIdMap;
+							CleanupRelease, CleanupRelease> MDIdToMDObjMap;
 			
 			// metadata objects indexed by their metadata id
-		MDIdToSerializedMDIdMap *m_mdmap;
+			MDIdToMDObjMap *m_mdmap;
 			
 			// load MD objects in the hash map
       void LoadMetadataObjectsFromArray(CMemoryPool *mp, IMDCacheObjectArray *mdcache_obj_array);
@@ -67,6 +67,11 @@ namespace gpmd
 			// returns the DXL string of the requested metadata object
 			virtual 
 			CWStringBase *GetMDObjDXLStr(CMemoryPool *mp, CMDAccessor *md_accessor, IMDId *mdid) const;
+
+			// returns the requested metadata object; objects loaded by the
+			// provider are handed out without a DXL round trip
+			virtual
+			IMDCacheObject *GetMDObj(CMemoryPool *mp, CMDAccessor *md_accessor, IMDId *mdid) const;
 			
 			// return the mdid for the specified system id and type
 			virtual
@@ -93,6 +93,9 @@ namespace gpmd
 			// array of index info
 		CMDIndexInfoArray *m_mdindex_info_array;
 
+			// mapping of index mdid to its position in the index info array
+			MdidToUlongMap *m_index_pos_map;
+
 			// array of trigger ids
 		IMdIdArray *m_mdid_trigger_array;
 
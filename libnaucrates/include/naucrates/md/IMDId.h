@@ -16,6 +16,7 @@
 
 #include "gpos/base.h"
 #include "gpos/common/CDynamicPtrArray.h"
+#include "gpos/common/CHashMap.h"
 #include "gpos/common/CHashSet.h"
 #include "gpos/common/CHashSetIter.h"
 #include "gpos/string/CWStringConst.h"
@@ -225,6 +226,9 @@ namespace gpmd
 
     // iterator over the hash set for column id information for missing statistics
     typedef CHashSetIter<IMDId, IMDId::MDIdHash, IMDId::MDIdCompare, CleanupRelease<IMDId> > MdidHashSetIter;
+
+    // hash map from mdid to position
+    typedef CHashMap<IMDId, ULONG, IMDId::MDIdHash, IMDId::MDIdCompare, CleanupRelease<IMDId>, CleanupDelete<ULONG> > MdidToUlongMap;
 }
 
 
@@ -28,6 +28,9 @@ namespace gpmd
 {
 	using namespace gpos;
 
+	// fwd decl
+	class IMDCacheObject;
+
 	//---------------------------------------------------------------------------
 	//	@class:
 	//		IMDProvider
@@ -56,6 +59,27 @@ namespace gpmd
 			virtual 
 			CWStringBase *GetMDObjDXLStr(CMemoryPool *mp, CMDAccessor *md_accessor, IMDId *mdid) const = 0;
 
+			// returns the DXL strings of the requested metadata objects, in the
+			// order of the given ids; providers that can retrieve several objects
+			// at once, such as the column stats of a relation, override this
+			virtual
+			StringPtrArray *GetMDObjDXLStrArray(CMemoryPool *mp, CMDAccessor *md_accessor, IMdIdArray *mdids) const;
+
+			// returns the requested metadata object with a new reference for the
+			// caller, or NULL if the provider only supplies objects in DXL format;
+			// returned objects are shared and must outlive the given accessor
+			virtual
+			IMDCacheObject *GetMDObj
+				(
+				CMemoryPool *, // mp
+				CMDAccessor *, // md_accessor
+				IMDId * // mdid
+				)
+				const
+			{
+				return NULL;
+			}
+
 			// return the mdid for the specified system id and type
 			virtual 
 			IMDId *MDId(CMemoryPool *mp, CSystemId sysid, IMDType::ETypeInfo type_info) const = 0;
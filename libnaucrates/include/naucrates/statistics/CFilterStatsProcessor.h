@@ -20,6 +20,7 @@
 #include "naucrates/statistics/CJoinStatsProcessor.h"
 #include "naucrates/statistics/CStatisticsUtils.h"
 #include "naucrates/statistics/CScaleFactorUtils.h"
+#include "naucrates/statistics/CStatsPredArrayCmp.h"
 
 namespace gpnaucrates
 {
@@ -50,6 +51,16 @@ namespace gpnaucrates
 				ULONG *target_last_colid
 				);
 
+			// create a new histogram after applying an IN list filter in a single pass
+			static
+			CHistogram *MakeHistArrayCmpFilter
+				(
+				CStatsPredArrayCmp *pred_stats,
+				UlongToHistogramMap *input_histograms,
+				CDouble input_rows,
+				CDouble *num_output_rows
+				);
+
 			// create a new histogram after applying a LIKE filter
 			static
 			CHistogram *MakeHistLikeFilter
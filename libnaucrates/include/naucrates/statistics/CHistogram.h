@@ -346,6 +346,17 @@ namespace gpnaucrates
 						)
 						const;
 
+			// union of the normalized histograms filtered by equality with each
+			// of the given sorted distinct points, computed in a single pass
+			CHistogram *MakeUnionHistogramEqualityFilters
+						(
+						const CPointArray *points,
+						BOOL has_null_point,
+						CDouble rows,
+						CDouble *num_output_rows
+						)
+						const;
+
 			// cleanup residual buckets
 			void CleanupResidualBucket(CBucket *bucket, BOOL bucket_is_residual) const;
 
@@ -393,6 +404,9 @@ namespace gpnaucrates
 			// total number of distinct values
 			CDouble GetNumDistinct() const;
 
+			// frequency of the most frequent value
+			CDouble GetMaxValueFreq() const;
+
 			// is histogram well formed
 			BOOL IsValid() const;
 
@@ -13,6 +13,7 @@
 
 #include "gpos/base.h"
 #include "naucrates/base/IDatum.h"
+#include "naucrates/statistics/CStatsDatum.h"
 #include "gpos/common/CDouble.h"
 
 namespace gpopt
@@ -31,7 +32,9 @@ namespace gpnaucrates
 	//		CPoint
 	//
 	//	@doc:
-	//		One dimensional point in the datum space
+	//		One dimensional point in the datum space. Comparisons between
+	//		points use a snapshot of the stats mapping of the datum taken at
+	//		construction, and only consult the datum itself if it has no mapping
 	//---------------------------------------------------------------------------
 	class CPoint: public CRefCount
 	{
@@ -46,6 +49,9 @@ namespace gpnaucrates
 			// datum corresponding to the point
 			IDatum *m_datum;
 
+			// stats mapping of the datum
+			CStatsDatum m_stats_datum;
+
 		public:
 
 			// c'tor
@@ -101,6 +107,8 @@ namespace gpnaucrates
 			CPoint *MaxPoint(CPoint *point1, CPoint *point2);
 	}; // class CPoint
 
+	// array of points
+	typedef CDynamicPtrArray<CPoint, CleanupRelease> CPointArray;
 }
 
 #endif // !GPNAUCRATES_CPoint_H
@@ -83,6 +83,24 @@ namespace gpnaucrates
         // hashmap from column id to width
       UlongToDoubleMap *m_colid_width_mapping;
 
+			// memory pool of the widths array
+			CMemoryPool *m_mp;
+
+			// widths of the columns in the width map, indexed by column id
+			// minus m_width_array_base, negative for columns without width;
+			// built on the first width lookup of a column set, NULL if the
+			// column ids are too sparse for a dense array
+			mutable DOUBLE *m_width_array;
+
+			// smallest column id in the widths array
+			mutable ULONG m_width_array_base;
+
+			// number of entries in the widths array
+			mutable ULONG m_width_array_size;
+
+			// was the widths array built
+			mutable BOOL m_width_array_built;
+
 			// number of rows
 			CDouble m_rows;
 
@@ -113,6 +131,19 @@ namespace gpnaucrates
       static
       const ULONG no_card_est_risk_default_val;
 
+			// maximum number of widths array entries per column in the width map
+			static
+			const ULONG width_array_max_spread;
+
+			// build the widths array from the width map
+			void BuildWidthArray() const;
+
+			// drop the widths array after the width map changed
+			void ResetWidthArray();
+
+			// width of the given column, falling back to the width of its type
+			DOUBLE ColumnWidth(ULONG colid) const;
+
       // helper method to add histograms where the column ids have been remapped
       static
       void AddHistogramsWithRemap(CMemoryPool *mp, UlongToHistogramMap *src_histograms, UlongToHistogramMap *dest_histograms, UlongToColRefMap *colref_mapping, BOOL must_exist);
@@ -363,6 +363,15 @@ namespace gpnaucrates
 					CBitSet *keys
 					);
 			
+			// frequency of the most frequent combination of values of the given
+			// columns, zero if not all columns have well-defined histograms
+			static
+			CDouble MaxValueFreq
+					(
+					IStatistics *stats,
+					ULongPtrArray *colids
+					);
+
 			// return the default number of distinct values
 			static
 			CDouble DefaultDistinctVals
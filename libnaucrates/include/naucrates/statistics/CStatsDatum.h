@@ -0,0 +1,125 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (C) 2020 VMware, Inc. or its affiliates.
+//
+//	@filename:
+//		CStatsDatum.h
+//
+//	@doc:
+//		Compact value representation of a datum for statistics computation
+//---------------------------------------------------------------------------
+#ifndef GPNAUCRATES_CStatsDatum_H
+#define GPNAUCRATES_CStatsDatum_H
+
+#include "gpos/base.h"
+#include "gpos/common/CDouble.h"
+
+#include "naucrates/base/IDatum.h"
+
+namespace gpnaucrates
+{
+	using namespace gpos;
+	using namespace gpmd;
+
+	//---------------------------------------------------------------------------
+	//	@class:
+	//		CStatsDatum
+	//
+	//	@doc:
+	//		Trivially copyable snapshot of the statistics view of a datum: its
+	//		type, null flag and precomputed LINT and double mappings. Comparing
+	//		two snapshots follows the semantics of IDatum::StatsAreComparable,
+	//		IDatum::StatsAreEqual, IDatum::StatsAreLessThan and
+	//		IDatum::GetStatsDistanceFrom without any virtual calls, except for a
+	//		type comparison between datums of different time-related types.
+	//
+	//		The type id is not owned; the snapshot must not outlive the datum
+	//		it was taken from. Datums without a stats mapping, such as generic
+	//		datums compared by their byte arrays, are left to IDatum.
+	//
+	//---------------------------------------------------------------------------
+	class CStatsDatum
+	{
+		private:
+
+			// type of the datum, owned by the datum
+			const IMDId *m_mdid_type;
+
+			// mapping of the datum to LINT, valid if the datum is mappable
+			LINT m_lint_value;
+
+			// mapping of the datum to double, valid if the datum is mappable
+			DOUBLE m_double_value;
+
+			// is the datum null
+			BOOL m_is_null;
+
+			// can the datum be mapped to LINT
+			BOOL m_is_lint_mappable;
+
+			// can the datum be mapped to double
+			BOOL m_is_double_mappable;
+
+			// is the datum of a time-related type
+			BOOL m_is_time_related;
+
+			// do the two datums share the same type
+			BOOL TypesMatch(const CStatsDatum &stats_datum) const;
+
+		public:
+
+			// initialize from the given datum
+			void Init(const IDatum *datum);
+
+			// can the two datums be compared through their LINT mappings
+			BOOL IsLintComparable
+				(
+				const CStatsDatum &stats_datum
+				)
+				const
+			{
+				return m_is_lint_mappable && stats_datum.m_is_lint_mappable;
+			}
+
+			// can the two datums be compared through one of their mappings
+			BOOL IsMappingComparable
+				(
+				const CStatsDatum &stats_datum
+				)
+				const
+			{
+				return IsLintComparable(stats_datum) ||
+						(m_is_double_mappable && stats_datum.m_is_double_mappable);
+			}
+
+			// are the two datums comparable, see IDatum::StatsAreComparable
+			BOOL StatsAreComparable
+				(
+				const CStatsDatum &stats_datum
+				)
+				const
+			{
+				// time-related types of different kinds are not comparable
+				if (m_is_time_related && stats_datum.m_is_time_related && !TypesMatch(stats_datum))
+				{
+					return false;
+				}
+
+				return IsMappingComparable(stats_datum);
+			}
+
+			// equality based on the mappings, see IDatum::StatsAreEqual
+			BOOL StatsAreEqual(const CStatsDatum &stats_datum) const;
+
+			// less-than based on the mappings, see IDatum::StatsAreLessThan
+			BOOL StatsAreLessThan(const CStatsDatum &stats_datum) const;
+
+			// distance based on the mappings, see IDatum::GetStatsDistanceFrom
+			CDouble GetStatsDistanceFrom(const CStatsDatum &stats_datum) const;
+
+	}; // class CStatsDatum
+}
+
+#endif // !GPNAUCRATES_CStatsDatum_H
+
+// EOF
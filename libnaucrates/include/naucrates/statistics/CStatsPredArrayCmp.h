@@ -0,0 +1,103 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (C) 2020 VMware, Inc. or its affiliates.
+//
+//	@filename:
+//		CStatsPredArrayCmp.h
+//
+//	@doc:
+//		IN list filter on statistics
+//---------------------------------------------------------------------------
+#ifndef GPNAUCRATES_CStatsPredArrayCmp_H
+#define GPNAUCRATES_CStatsPredArrayCmp_H
+
+#include "gpos/base.h"
+#include "naucrates/statistics/CPoint.h"
+#include "naucrates/statistics/CStatsPredDisj.h"
+
+namespace gpnaucrates
+{
+	using namespace gpos;
+
+	//---------------------------------------------------------------------------
+	//	@class:
+	//		CStatsPredArrayCmp
+	//
+	//	@doc:
+	//		Filter of the form col IN (c1, ..., cN), represented as the
+	//		disjunction of the equality filters col = ci. In addition to the
+	//		disjuncts, the filter keeps the distinct constants sorted once at
+	//		construction, so that the filtered histogram can be computed in a
+	//		single pass over the buckets instead of one histogram union per
+	//		constant. Consumers that are unaware of the sorted constants see an
+	//		ordinary disjunction.
+	//
+	//---------------------------------------------------------------------------
+	class CStatsPredArrayCmp : public CStatsPredDisj
+	{
+		private:
+
+			// private copy ctor
+			CStatsPredArrayCmp(const CStatsPredArrayCmp &);
+
+			// private assignment operator
+			CStatsPredArrayCmp& operator=(CStatsPredArrayCmp &);
+
+			// distinct non-null constants in ascending order, NULL if the
+			// constants cannot be ordered among each other
+			CPointArray *m_points;
+
+			// is any of the constants null
+			BOOL m_has_null_point;
+
+			// comparison function for sorting points
+			static
+			INT PointSortCmpFunc(const void *val1, const void *val2);
+
+		public:
+
+			// ctor
+			CStatsPredArrayCmp(CMemoryPool *mp, CStatsPredPtrArry *disj_pred_stats_array);
+
+			// dtor
+			virtual
+			~CStatsPredArrayCmp();
+
+			// is the disjunction an IN list
+			virtual
+			BOOL IsArrayCmp() const
+			{
+				return true;
+			}
+
+			// distinct non-null constants in ascending order, may be NULL
+			const CPointArray *GetSortedPoints() const
+			{
+				return m_points;
+			}
+
+			// is any of the constants null
+			BOOL HasNullPoint() const
+			{
+				return m_has_null_point;
+			}
+
+			// conversion function
+			static
+			CStatsPredArrayCmp *ConvertPredStats
+				(
+				CStatsPredDisj *pred_stats
+				)
+			{
+				GPOS_ASSERT(NULL != pred_stats);
+				GPOS_ASSERT(pred_stats->IsArrayCmp());
+
+				return dynamic_cast<CStatsPredArrayCmp*>(pred_stats);
+			}
+
+	}; // class CStatsPredArrayCmp
+}
+
+#endif // !GPNAUCRATES_CStatsPredArrayCmp_H
+
+// EOF
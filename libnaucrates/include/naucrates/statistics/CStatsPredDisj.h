@@ -74,6 +74,13 @@ namespace gpnaucrates
 			// return the point filter at a particular position
 			CStatsPred *GetPredStats(ULONG pos) const;
 
+			// is the disjunction an IN list, see CStatsPredArrayCmp
+			virtual
+			BOOL IsArrayCmp() const
+			{
+				return false;
+			}
+
 			// filter type id
 			virtual
 			EStatsPredType GetPredStatsType() const
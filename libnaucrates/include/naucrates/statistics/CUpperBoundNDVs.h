@@ -75,6 +75,12 @@ namespace gpnaucrates
                                 return m_upper_bound_ndv;
                         }
 
+                        // columns the upper bound applies to
+                        CColRefSet *GetColRefSet() const
+                        {
+                                return m_column_refset;
+                        }
+
                         // check if the column is present
                         BOOL IsPresent(const CColRef *column_ref) const
                         {
@@ -187,6 +187,38 @@ namespace gpos
 
 		// Expand LOJs in N-aryjoin
 		EopttraceEnableLOJInNAryJoin = 103033,
+
+		// do not share structurally equal scalar expressions through the interning table
+		EopttraceDisableScalarInterning = 103034,
+
+		// parse DXL input that is not validated against the XSD with the
+		// built-in streaming parser instead of Xerces
+		EopttraceStreamingDXLParser = 103035,
+
+		// request column histograms only where statistics derivation uses them,
+		// i.e. for predicate, join, grouping and distribution columns
+		EopttraceDemandDrivenStats = 103036,
+
+		// bind xforms with a static pattern by interpreting their pattern
+		// tree, as done for all other xforms
+		EopttraceDisableStaticBinding = 103037,
+
+		// apply xforms to bindings known to regenerate an existing group
+		// expression, instead of skipping them
+		EopttraceDisableDuplicateBindingBlocking = 103038,
+
+		// compute cost model inputs and costs of all cost contexts, instead
+		// of reusing them from child contexts and contexts with equal inputs
+		EopttraceDisableCostReuse = 103039,
+
+		// derive all plan properties of each cost context, instead of
+		// deriving them on demand and sharing them across cost contexts
+		EopttraceDisablePlanPropsReuse = 103040,
+
+		// create cost context tables and partial plan cost maps along with
+		// each group expression, instead of on their first use
+		EopttraceDisableLazyCostTables = 103041,
+
 		///////////////////////////////////////////////////////
 		///////////////////// statistics flags ////////////////
 		//////////////////////////////////////////////////////
@@ -212,6 +244,9 @@ namespace gpos
 		// Penalize HashJoins with a skewed hash distribute under them
 		EopttracePenalizeSkewedHashJoin = 104006,
 
+		// bypass the cross-query cache of derived statistics
+		EopttraceDisableStatsCache = 104007,
+
 		///////////////////////////////////////////////////////
 		/////////// constant expression evaluator flags ///////
 		///////////////////////////////////////////////////////
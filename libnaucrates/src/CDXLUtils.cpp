@@ -34,6 +34,7 @@
 #include "naucrates/dxl/parser/CParseHandlerManager.h"
 #include "naucrates/dxl/parser/CParseHandlerDummy.h"
 #include "naucrates/dxl/xml/CDXLMemoryManager.h"
+#include "naucrates/dxl/xml/CDXLStreamParser.h"
 #include "naucrates/dxl/xml/CXMLSerializer.h"
 #include "gpopt/mdcache/CMDAccessor.h"
 #include "gpopt/base/COptCtxt.h"
@@ -58,6 +59,66 @@ XERCES_CPP_NAMESPACE_USE
 
 
 
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLUtils::FUseStreamingParser
+//
+//	@doc:
+//		Documents that are validated against an XSD schema are always parsed
+//		with Xerces; all others are parsed with the streaming parser if the
+//		corresponding trace flag is set
+//
+//---------------------------------------------------------------------------
+BOOL
+CDXLUtils::FUseStreamingParser
+	(
+	const CHAR *xsd_file_path
+	)
+{
+	return NULL == xsd_file_path && GPOS_FTRACE(EopttraceStreamingDXLParser);
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLUtils::GetParseHandlerForTrustedDXLString
+//
+//	@doc:
+//		Parse the given DXL string with the streaming parser and return the
+//		top-level parser
+//
+//---------------------------------------------------------------------------
+CParseHandlerDXL *
+CDXLUtils::GetParseHandlerForTrustedDXLString
+	(
+	CMemoryPool *mp,
+	const CHAR *dxl_string
+	)
+{
+	GPOS_ASSERT(NULL != mp);
+	GPOS_ASSERT(NULL != dxl_string);
+
+	CDXLMemoryManager mm(mp);
+	CParseHandlerManager parse_handler_mgr(&mm, NULL /*sax_2_xml_reader*/);
+	CParseHandlerDXL *parse_handler_dxl = CParseHandlerFactory::GetParseHandlerDXL(mp, &parse_handler_mgr);
+	parse_handler_mgr.ActivateParseHandler(parse_handler_dxl);
+
+	GPOS_TRY
+	{
+		CDXLStreamParser parser(mp, &parse_handler_mgr);
+		parser.Parse(dxl_string, clib::Strlen(dxl_string));
+	}
+	GPOS_CATCH_EX(ex)
+	{
+		GPOS_DELETE(parse_handler_dxl);
+		GPOS_RETHROW(ex);
+	}
+	GPOS_CATCH_END;
+
+	GPOS_CHECK_ABORT;
+
+	return parse_handler_dxl;
+}
+
 //---------------------------------------------------------------------------
 //	@function:
 //		CDXLUtils::GetParseHandlerForDXLString
@@ -77,6 +138,12 @@ CDXLUtils::GetParseHandlerForDXLString
 	)
 {
 	GPOS_ASSERT(NULL != mp);
+
+	if (FUseStreamingParser(xsd_file_path))
+	{
+		return GetParseHandlerForTrustedDXLString(mp, dxl_string);
+	}
+
 	// we need to disable OOM simulation here, otherwise xerces throws ABORT signal
 	CAutoTraceFlag auto_trace_flg1(EtraceSimulateOOM, false);
 	CAutoTraceFlag auto_trace_flg2(EtraceSimulateAbort, false);
@@ -170,6 +237,12 @@ CDXLUtils::GetParseHandlerForDXLFile
 	)
 {
 	GPOS_ASSERT(NULL != mp);
+
+	if (FUseStreamingParser(xsd_file_path))
+	{
+		CAutoRg<CHAR> dxl_string(Read(mp, dxl_filename));
+		return GetParseHandlerForTrustedDXLString(mp, dxl_string.Rgt());
+	}
 		
 	// setup own memory manager
 	CDXLMemoryManager mm(mp);
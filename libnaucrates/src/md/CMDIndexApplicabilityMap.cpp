@@ -0,0 +1,165 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (C) 2020 VMware, Inc. or its affiliates.
+//
+//	@filename:
+//		CMDIndexApplicabilityMap.cpp
+//
+//	@doc:
+//		Implementation of the map of partition ranges to indexes
+//---------------------------------------------------------------------------
+
+#include "gpos/io/COstreamString.h"
+
+#include "naucrates/md/CMDIndexApplicabilityMap.h"
+#include "naucrates/dxl/xml/CXMLSerializer.h"
+
+using namespace gpdxl;
+using namespace gpmd;
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CMDIndexApplicabilityMap::CMDIndexApplicabilityMap
+//
+//	@doc:
+//		Ctor
+//
+//---------------------------------------------------------------------------
+CMDIndexApplicabilityMap::CMDIndexApplicabilityMap
+	(
+	CMemoryPool *mp
+	)
+	:
+	m_mp(mp),
+	m_range_id_array(NULL),
+	m_range_index_pos_array(NULL),
+	m_partial_index_pos_array(NULL),
+	m_part_constraint_str_array(NULL),
+	m_hash_range_ids_map(NULL)
+{
+	m_range_id_array = GPOS_NEW(mp) ULongPtrArray(mp);
+	m_range_index_pos_array = GPOS_NEW(mp) ULongPtr2dArray(mp);
+	m_partial_index_pos_array = GPOS_NEW(mp) ULongPtrArray(mp);
+	m_part_constraint_str_array = GPOS_NEW(mp) CWStringDynamicArray(mp);
+	m_hash_range_ids_map = GPOS_NEW(mp) UlongToUlongPtrArrayMap(mp);
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CMDIndexApplicabilityMap::~CMDIndexApplicabilityMap
+//
+//	@doc:
+//		Dtor
+//
+//---------------------------------------------------------------------------
+CMDIndexApplicabilityMap::~CMDIndexApplicabilityMap()
+{
+	m_range_id_array->Release();
+	m_range_index_pos_array->Release();
+	m_partial_index_pos_array->Release();
+	m_part_constraint_str_array->Release();
+	m_hash_range_ids_map->Release();
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CMDIndexApplicabilityMap::SerializePartConstraint
+//
+//	@doc:
+//		Serialize the given part constraint; equal constraints serialize to
+//		equal strings
+//
+//---------------------------------------------------------------------------
+CWStringDynamic *
+CMDIndexApplicabilityMap::SerializePartConstraint
+	(
+	const IMDPartConstraint *mdpart_constraint
+	)
+	const
+{
+	CWStringDynamic *part_constraint_str = GPOS_NEW(m_mp) CWStringDynamic(m_mp);
+	if (NULL != mdpart_constraint)
+	{
+		COstreamString oss(part_constraint_str);
+		CXMLSerializer xml_serializer(m_mp, oss, false /*indentation*/);
+		mdpart_constraint->Serialize(&xml_serializer);
+	}
+
+	return part_constraint_str;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CMDIndexApplicabilityMap::RangeId
+//
+//	@doc:
+//		Id of the range with the given serialized part constraint, adding a
+//		new range if not found
+//
+//---------------------------------------------------------------------------
+ULONG
+CMDIndexApplicabilityMap::RangeId
+	(
+	CWStringDynamic *part_constraint_str
+	)
+{
+	ULONG hash = gpos::HashByteArray
+						(
+						(const BYTE *) part_constraint_str->GetBuffer(),
+						part_constraint_str->Length() * GPOS_SIZEOF(WCHAR)
+						);
+
+	ULongPtrArray *range_ids = m_hash_range_ids_map->Find(&hash);
+	if (NULL == range_ids)
+	{
+		range_ids = GPOS_NEW(m_mp) ULongPtrArray(m_mp);
+		m_hash_range_ids_map->Insert(GPOS_NEW(m_mp) ULONG(hash), range_ids);
+	}
+
+	const ULONG size = range_ids->Size();
+	for (ULONG ul = 0; ul < size; ul++)
+	{
+		ULONG range_id = *(*range_ids)[ul];
+		if (part_constraint_str->Equals((*m_part_constraint_str_array)[range_id]))
+		{
+			GPOS_DELETE(part_constraint_str);
+			return range_id;
+		}
+	}
+
+	ULONG range_id = m_part_constraint_str_array->Size();
+	m_part_constraint_str_array->Append(part_constraint_str);
+	m_range_index_pos_array->Append(GPOS_NEW(m_mp) ULongPtrArray(m_mp));
+	range_ids->Append(GPOS_NEW(m_mp) ULONG(range_id));
+
+	return range_id;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CMDIndexApplicabilityMap::AddIndex
+//
+//	@doc:
+//		Add the index at the next position of the index list of the relation
+//
+//---------------------------------------------------------------------------
+void
+CMDIndexApplicabilityMap::AddIndex
+	(
+	BOOL is_partial,
+	const IMDPartConstraint *mdpart_constraint
+	)
+{
+	ULONG index_pos = m_range_id_array->Size();
+	ULONG range_id = RangeId(SerializePartConstraint(mdpart_constraint));
+
+	m_range_id_array->Append(GPOS_NEW(m_mp) ULONG(range_id));
+	(*m_range_index_pos_array)[range_id]->Append(GPOS_NEW(m_mp) ULONG(index_pos));
+
+	if (is_partial)
+	{
+		m_partial_index_pos_array->Append(GPOS_NEW(m_mp) ULONG(index_pos));
+	}
+}
+
+// EOF
@@ -97,13 +97,14 @@ CMDProviderMemory::LoadMetadataObjectsFromArray
 	GPOS_ASSERT(NULL != mdcache_obj_array);
 
 	// load metadata objects from the file
-	CAutoRef<MDIdToSerializedMDIdMap> md_map;
-	m_mdmap = GPOS_NEW(mp) MDIdToSerializedMDIdMap(mp);
+	CAutoRef<MDIdToMDObjMap> md_map;
+	m_mdmap = GPOS_NEW(mp) MDIdToMDObjMap(mp);
 	md_map = m_mdmap;
 
 	const ULONG size = mdcache_obj_array->Size();
 
-	// load objects into the hash map
+	// load objects into the hash map; the parsed objects are kept as they
+	// are, so that they can be handed out without serializing them
 	for (ULONG ul = 0; ul < size; ul++)
 	{
 		GPOS_CHECK_ABORT;
@@ -111,21 +112,15 @@ CMDProviderMemory::LoadMetadataObjectsFromArray
 		IMDCacheObject *mdcache_obj = (*mdcache_obj_array)[ul];
 		IMDId *mdid_key = mdcache_obj->MDId();
 		mdid_key->AddRef();
-		CAutoRef<IMDId> mdid_key_autoref;
-		mdid_key_autoref = mdid_key;
-		
-		CAutoP<CWStringDynamic> str;
-		str = CDXLUtils::SerializeMDObj(mp, mdcache_obj, true /*fSerializeHeaders*/, false /*findent*/);
-		
-		GPOS_CHECK_ABORT;
-		BOOL fInserted = m_mdmap->Insert(mdid_key, str.Value());
+		mdcache_obj->AddRef();
+
+		BOOL fInserted = m_mdmap->Insert(mdid_key, mdcache_obj);
 		if (!fInserted)
 		{
-			
+			mdid_key->Release();
+			mdcache_obj->Release();
 			GPOS_RAISE(gpdxl::ExmaMD, gpdxl::ExmiMDCacheEntryDuplicate, mdid_key->GetBuffer());
 		}
-		(void) mdid_key_autoref.Reset();
-		(void) str.Reset();
 	}
 	
 	// safely completed loading
@@ -147,73 +142,83 @@ CMDProviderMemory::~CMDProviderMemory()
 
 //---------------------------------------------------------------------------
 //	@function:
-//		CMDProviderMemory::GetMDObjDXLStr
+//		CMDProviderMemory::GetMDObj
 //
 //	@doc:
-//		Returns the DXL of the requested object in the provided memory pool
+//		Returns the requested object with a new reference for the caller.
+//		Objects loaded by the provider are shared with the caller, dummy
+//		statistics objects are created in the provided memory pool
 //
 //---------------------------------------------------------------------------
-CWStringBase *
-CMDProviderMemory::GetMDObjDXLStr
+IMDCacheObject *
+CMDProviderMemory::GetMDObj
 	(
 	CMemoryPool *mp,
 	CMDAccessor *, //md_accessor
 	IMDId *mdid
-	) 
+	)
 	const
 {
 	GPOS_ASSERT(NULL != m_mdmap);
 
-	const CWStringDynamic *pstrObj = m_mdmap->Find(mdid);
-	
-	// result string
-	CAutoP<CWStringDynamic> a_pstrResult;
+	IMDCacheObject *mdobj = m_mdmap->Find(mdid);
+	if (NULL != mdobj)
+	{
+		mdobj->AddRef();
+		return mdobj;
+	}
 
-	a_pstrResult = NULL;
-	
-	if (NULL == pstrObj)
+	// Relstats and colstats are special as they may not
+	// exist in the metadata file. Provider must return dummy objects
+	// in this case.
+	switch(mdid->MdidType())
 	{
-		// Relstats and colstats are special as they may not
-		// exist in the metadata file. Provider must return dummy objects
-		// in this case.
-		switch(mdid->MdidType())
+		case IMDId::EmdidRelStats:
 		{
-			case IMDId::EmdidRelStats:
-			{
-				mdid->AddRef();
-				CAutoRef<CDXLRelStats> a_pdxlrelstats;
-				a_pdxlrelstats = CDXLRelStats::CreateDXLDummyRelStats(mp, mdid);
-				a_pstrResult = CDXLUtils::SerializeMDObj(mp, a_pdxlrelstats.Value(), true /*fSerializeHeaders*/, false /*findent*/);
-				break;
-			}
-			case IMDId::EmdidColStats:
-			{
-				CAutoP<CWStringDynamic> a_pstr;
-				a_pstr = GPOS_NEW(mp) CWStringDynamic(mp, mdid->GetBuffer());
-				CAutoP<CMDName> a_pmdname;
-				a_pmdname = GPOS_NEW(mp) CMDName(mp, a_pstr.Value());
-				mdid->AddRef();
-				CAutoRef<CDXLColStats> a_pdxlcolstats;
-				a_pdxlcolstats = CDXLColStats::CreateDXLDummyColStats(mp, mdid, a_pmdname.Value(), CStatistics::DefaultColumnWidth /* width */);
-				a_pmdname.Reset();
-				a_pstrResult = CDXLUtils::SerializeMDObj(mp, a_pdxlcolstats.Value(), true /*fSerializeHeaders*/, false /*findent*/);
-				break;
-			}
-			default:
-			{
-				GPOS_RAISE(gpdxl::ExmaMD, gpdxl::ExmiMDCacheEntryNotFound, mdid->GetBuffer());
-			}
+			mdid->AddRef();
+			return CDXLRelStats::CreateDXLDummyRelStats(mp, mdid);
+		}
+		case IMDId::EmdidColStats:
+		{
+			CAutoP<CWStringDynamic> a_pstr;
+			a_pstr = GPOS_NEW(mp) CWStringDynamic(mp, mdid->GetBuffer());
+			CAutoP<CMDName> a_pmdname;
+			a_pmdname = GPOS_NEW(mp) CMDName(mp, a_pstr.Value());
+			mdid->AddRef();
+			CDXLColStats *pdxlcolstats = CDXLColStats::CreateDXLDummyColStats(mp, mdid, a_pmdname.Value(), CStatistics::DefaultColumnWidth /* width */);
+			a_pmdname.Reset();
+			return pdxlcolstats;
+		}
+		default:
+		{
+			GPOS_RAISE(gpdxl::ExmaMD, gpdxl::ExmiMDCacheEntryNotFound, mdid->GetBuffer());
 		}
 	}
-	else
-	{
-		// copy string into result
-		a_pstrResult = GPOS_NEW(mp) CWStringDynamic(mp, pstrObj->GetBuffer());
-	}
-	
-	GPOS_ASSERT(NULL != a_pstrResult.Value());
-	
-	return a_pstrResult.Reset();
+
+	return NULL;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CMDProviderMemory::GetMDObjDXLStr
+//
+//	@doc:
+//		Returns the DXL of the requested object in the provided memory pool
+//
+//---------------------------------------------------------------------------
+CWStringBase *
+CMDProviderMemory::GetMDObjDXLStr
+	(
+	CMemoryPool *mp,
+	CMDAccessor *md_accessor,
+	IMDId *mdid
+	) 
+	const
+{
+	CAutoRef<IMDCacheObject> a_pmdobj;
+	a_pmdobj = GetMDObj(mp, md_accessor, mdid);
+
+	return CDXLUtils::SerializeMDObj(mp, a_pmdobj.Value(), true /*fSerializeHeaders*/, false /*findent*/);
 }
 
 //---------------------------------------------------------------------------
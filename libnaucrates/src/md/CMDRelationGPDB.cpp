@@ -65,6 +65,7 @@ CMDRelationGPDB::CMDRelationGPDB
 	m_num_of_partitions(num_of_partitions),
 	m_keyset_array(keyset_array),
 	m_mdindex_info_array(md_index_info_array),
+	m_index_pos_map(NULL),
 	m_mdid_trigger_array(mdid_triggers_array),
 	m_mdid_check_constraint_array(mdid_check_constraint_array),
 	m_mdpart_constraint(mdpart_constraint),
@@ -121,6 +122,20 @@ CMDRelationGPDB::CMDRelationGPDB
 
 		m_col_width_array->Append(GPOS_NEW(mp) CDouble(mdcol->Length()));
 	}
+
+	m_index_pos_map = GPOS_NEW(m_mp) MdidToUlongMap(m_mp);
+	const ULONG indexes = md_index_info_array->Size();
+	for (ULONG ul = 0; ul < indexes; ul++)
+	{
+		IMDId *index_mdid = (*md_index_info_array)[ul]->MDId();
+		index_mdid->AddRef();
+		if (!m_index_pos_map->Insert(index_mdid, GPOS_NEW(m_mp) ULONG(ul)))
+		{
+			// keep the first position of a repeated index, as the former
+			// linear lookup did
+			index_mdid->Release();
+		}
+	}
 	m_dxl_str = CDXLUtils::SerializeMDObj(m_mp, this, false /*fSerializeHeader*/, false /*indentation*/);
 }
 
@@ -150,6 +165,7 @@ CMDRelationGPDB::~CMDRelationGPDB()
 	CRefCount::SafeRelease(m_colpos_nondrop_colpos_map);
 	CRefCount::SafeRelease(m_attrno_nondrop_col_pos_map);
 	CRefCount::SafeRelease(m_nondrop_col_pos_array);
+	m_index_pos_map->Release();
 }
 
 //---------------------------------------------------------------------------
@@ -602,20 +618,14 @@ CMDRelationGPDB::IsPartialIndex
 	)
 	const
 {
-	const ULONG indexes = IndexCount();
-
-	for (ULONG ul = 0; ul < indexes; ++ul)
+	const ULONG *index_pos = m_index_pos_map->Find(mdid);
+	if (NULL == index_pos)
 	{
-		if (CMDIdGPDB::MDIdCompare(IndexMDidAt(ul), mdid))
-		{
-			return (*m_mdindex_info_array)[ul]->IsPartial();
-		}
+		// Not found
+		GPOS_RAISE(ExmaMD, ExmiMDCacheEntryNotFound, mdid->GetBuffer());
 	}
 
-	// Not found
-	GPOS_RAISE(ExmaMD, ExmiMDCacheEntryNotFound, mdid->GetBuffer());
-
-	return false;
+	return (*m_mdindex_info_array)[*index_pos]->IsPartial();
 }
 
 
@@ -304,9 +304,12 @@ CMDTypeGenericGPDB::GetDatumForDXLDatum
 	)
 	const
 {
-	m_mdid->AddRef();
 	CDXLDatumGeneric *dxl_datum_generic = CDXLDatumGeneric::Cast(const_cast<CDXLDatum *>(dxl_datum));
 
+	// the datum does not reference the type's memory, as datums built from
+	// column stats are cached with the stats object and outlive the type
+	CMDIdGPDB *mdid = GPOS_NEW(mp) CMDIdGPDB(*CMDIdGPDB::CastMdid(m_mdid));
+
 	LINT lint_value = 0;
 	if (dxl_datum_generic->IsDatumMappableToLINT())
 	{
@@ -319,10 +322,10 @@ CMDTypeGenericGPDB::GetDatumForDXLDatum
 		double_value = dxl_datum_generic->GetDoubleMapping();
 	}
 
-	return GPOS_NEW(m_mp) CDatumGenericGPDB
+	return GPOS_NEW(mp) CDatumGenericGPDB
 						(
 						mp,
-						m_mdid,
+						mdid,
 						dxl_datum_generic->TypeModifier(),
 						dxl_datum_generic->GetByteArray(),
 						dxl_datum_generic->Length(),
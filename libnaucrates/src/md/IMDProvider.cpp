@@ -9,6 +9,8 @@
 //		Abstract class for retrieving metadata from an external location
 //---------------------------------------------------------------------------
 
+#include "gpos/common/CAutoRef.h"
+
 #include "naucrates/md/IMDProvider.h"
 #include "naucrates/md/CMDIdGPDB.h"
 
@@ -59,4 +61,37 @@ IMDProvider::GetGPDBTypeMdid
 	}
 }
 
+//---------------------------------------------------------------------------
+//	@function:
+//		IMDProvider::GetMDObjDXLStrArray
+//
+//	@doc:
+//		Return the DXL strings of the requested objects, retrieving them
+//		one at a time
+//
+//---------------------------------------------------------------------------
+StringPtrArray *
+IMDProvider::GetMDObjDXLStrArray
+	(
+	CMemoryPool *mp,
+	CMDAccessor *md_accessor,
+	IMdIdArray *mdids
+	)
+	const
+{
+	GPOS_ASSERT(NULL != mdids);
+
+	const ULONG size = mdids->Size();
+	StringPtrArray *pdrgpstr = GPOS_NEW(mp) StringPtrArray(mp, size);
+	CAutoRef<StringPtrArray> a_pdrgpstr;
+	a_pdrgpstr = pdrgpstr;
+
+	for (ULONG ul = 0; ul < size; ul++)
+	{
+		pdrgpstr->Append(GetMDObjDXLStr(mp, md_accessor, (*mdids)[ul]));
+	}
+
+	return a_pdrgpstr.Reset();
+}
+
 // EOF
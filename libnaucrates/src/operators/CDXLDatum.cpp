@@ -17,6 +17,7 @@
 
 #include "naucrates/dxl/operators/CDXLDatum.h"
 #include "naucrates/dxl/xml/CXMLSerializer.h"
+#include "naucrates/md/CMDIdGPDB.h"
 
 using namespace gpos;
 using namespace gpdxl;
@@ -47,6 +48,25 @@ CDXLDatum::CDXLDatum
 	GPOS_ASSERT(m_mdid_type->IsValid());
 }
 
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLDatum::DetachMDIdType
+//
+//	@doc:
+//		Replace the type mdid with a copy allocated in the memory pool of
+//		the datum
+//
+//---------------------------------------------------------------------------
+void
+CDXLDatum::DetachMDIdType()
+{
+	GPOS_ASSERT(IMDId::EmdidGPDB == m_mdid_type->MdidType());
+
+	IMDId *mdid_type = GPOS_NEW(m_mp) CMDIdGPDB(*CMDIdGPDB::CastMdid(m_mdid_type));
+	m_mdid_type->Release();
+	m_mdid_type = mdid_type;
+}
+
 INT
 CDXLDatum::TypeModifier() const
 {
@@ -67,7 +67,7 @@ CParseHandlerArray::StartElement
 		// parse child of array
 		GPOS_ASSERT(NULL != m_dxl_node);
 		
-		CParseHandlerBase *child_parse_handler = CParseHandlerFactory::GetParseHandler(m_mp, CDXLTokens::XmlstrToken(EdxltokenScalar), m_parse_handler_mgr, this);
+		CParseHandlerBase *child_parse_handler = CParseHandlerFactory::GetParseHandler(m_mp, EdxltokenScalar, m_parse_handler_mgr, this);
 		m_parse_handler_mgr->ActivateParseHandler(child_parse_handler);
 		this->Append(child_parse_handler);
 		child_parse_handler->startElement(element_uri, element_local_name, element_qname, attrs);
@@ -78,7 +78,7 @@ CParseHandlerCTEList::StartElement
 		GPOS_ASSERT(NULL != m_dxl_array);
 
 		// start new CTE producer
-		CParseHandlerBase *cte_producer_parse_handler = CParseHandlerFactory::GetParseHandler(m_mp, CDXLTokens::XmlstrToken(EdxltokenLogicalCTEProducer), m_parse_handler_mgr, this);
+		CParseHandlerBase *cte_producer_parse_handler = CParseHandlerFactory::GetParseHandler(m_mp, EdxltokenLogicalCTEProducer, m_parse_handler_mgr, this);
 		m_parse_handler_mgr->ActivateParseHandler(cte_producer_parse_handler);
 		
 		// store parse handler
@@ -73,7 +73,7 @@ CParseHandlerCondList::StartElement
 		// we must have seen a cond list already and initialized the cond list node
 		GPOS_ASSERT(NULL != m_dxl_node);
 		// start new hash cond element
-		CParseHandlerBase *child_parse_handler = CParseHandlerFactory::GetParseHandler(m_mp, CDXLTokens::XmlstrToken(EdxltokenScalar), m_parse_handler_mgr, this);
+		CParseHandlerBase *child_parse_handler = CParseHandlerFactory::GetParseHandler(m_mp, EdxltokenScalar, m_parse_handler_mgr, this);
 		m_parse_handler_mgr->ActivateParseHandler(child_parse_handler);
 		
 		// store parse handler
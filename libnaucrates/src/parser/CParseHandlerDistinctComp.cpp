@@ -73,11 +73,11 @@ CParseHandlerDistinctComp::StartElement
 	// order of their expected appearance
 	
 	// parse handler for right scalar node
-	CParseHandlerBase *right_child_parse_handler = CParseHandlerFactory::GetParseHandler(m_mp, CDXLTokens::XmlstrToken(EdxltokenScalar), m_parse_handler_mgr, this);
+	CParseHandlerBase *right_child_parse_handler = CParseHandlerFactory::GetParseHandler(m_mp, EdxltokenScalar, m_parse_handler_mgr, this);
 	m_parse_handler_mgr->ActivateParseHandler(right_child_parse_handler);
 	
 	// parse handler for left scalar node
-	CParseHandlerBase *left_child_parse_handler = CParseHandlerFactory::GetParseHandler(m_mp, CDXLTokens::XmlstrToken(EdxltokenScalar), m_parse_handler_mgr, this);
+	CParseHandlerBase *left_child_parse_handler = CParseHandlerFactory::GetParseHandler(m_mp, EdxltokenScalar, m_parse_handler_mgr, this);
 	m_parse_handler_mgr->ActivateParseHandler(left_child_parse_handler);
 	
 	// store parse handlers
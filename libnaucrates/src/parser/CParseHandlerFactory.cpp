@@ -26,6 +26,9 @@ XERCES_CPP_NAMESPACE_USE
 CParseHandlerFactory::TokenParseHandlerFuncMap *
 CParseHandlerFactory::m_token_parse_handler_func_map = NULL;
 
+ParseHandlerOpCreatorFunc **
+CParseHandlerFactory::m_token_parse_handler_func_array = NULL;
+
 // adds a new mapping of token to corresponding parse handler
 void
 CParseHandlerFactory::AddMapping
@@ -289,6 +292,15 @@ CParseHandlerFactory::Init
 		SParseHandlerMapping elem = token_parse_handler_map[idx];
 		AddMapping(elem.token_type, elem.parse_handler_op_func);
 	}
+
+	// index the creators by token type, so that callers knowing the token
+	// of an element need not hash its name
+	m_token_parse_handler_func_array = GPOS_NEW_ARRAY(mp, ParseHandlerOpCreatorFunc *, EdxltokenSentinel);
+	for (ULONG ul = 0; ul < EdxltokenSentinel; ul++)
+	{
+		m_token_parse_handler_func_array[ul] =
+			m_token_parse_handler_func_map->Find(CDXLTokens::XmlstrToken((Edxltoken) ul));
+	}
 }
 
 // creates a parse handler instance given an xml tag
@@ -303,6 +315,14 @@ CParseHandlerFactory::GetParseHandler
 {
 	GPOS_ASSERT(NULL != m_token_parse_handler_func_map);
 
+	// the streaming parser records the token of the element it reports, which
+	// saves hashing the element name when the handler dispatches on it
+	Edxltoken token_type = parse_handler_mgr->GetCurrentElementToken();
+	if (EdxltokenSentinel != token_type && CDXLTokens::XmlstrToken(token_type) == token_identifier_str)
+	{
+		return GetParseHandler(mp, token_type, parse_handler_mgr, parse_handler_root);
+	}
+
 	ParseHandlerOpCreatorFunc *create_parse_handler_func = m_token_parse_handler_func_map->Find(token_identifier_str);
 
 	if (create_parse_handler_func != NULL)
@@ -325,6 +345,36 @@ CParseHandlerFactory::GetParseHandler
 	return NULL;
 }
 
+// creates a parse handler instance given the token of an xml tag
+CParseHandlerBase *
+CParseHandlerFactory::GetParseHandler
+	(
+	CMemoryPool *mp,
+	Edxltoken token_type,
+	CParseHandlerManager* parse_handler_mgr,
+	CParseHandlerBase *parse_handler_root
+	)
+{
+	GPOS_ASSERT(NULL != m_token_parse_handler_func_array);
+	GPOS_ASSERT(EdxltokenSentinel > token_type);
+
+	ParseHandlerOpCreatorFunc *create_parse_handler_func = m_token_parse_handler_func_array[token_type];
+
+	if (create_parse_handler_func != NULL)
+	{
+		return (*create_parse_handler_func) (mp, parse_handler_mgr, parse_handler_root);
+	}
+
+	GPOS_RAISE
+	(
+	gpdxl::ExmaDXL,
+	gpdxl::ExmiDXLUnrecognizedOperator,
+	CDXLTokens::GetDXLTokenStr(token_type)->GetBuffer()
+	);
+
+	return NULL;
+}
+
 // creates a parse handler for parsing a DXL document.
 CParseHandlerDXL *
 CParseHandlerFactory::GetParseHandlerDXL
@@ -85,7 +85,7 @@ CParseHandlerFilter::StartElement
 		GPOS_ASSERT(NULL != m_dxl_node);
 		
 		// install a scalar element parser for parsing the condition element
-		CParseHandlerBase *op_parse_handler = CParseHandlerFactory::GetParseHandler(m_mp, CDXLTokens::XmlstrToken(EdxltokenScalar), m_parse_handler_mgr, this);
+		CParseHandlerBase *op_parse_handler = CParseHandlerFactory::GetParseHandler(m_mp, EdxltokenScalar, m_parse_handler_mgr, this);
 
 		m_parse_handler_mgr->ActivateParseHandler(op_parse_handler);
 		
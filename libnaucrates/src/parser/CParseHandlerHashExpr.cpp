@@ -69,7 +69,7 @@ CParseHandlerHashExpr::StartElement
 	
 	// create and activate the parse handler for the child scalar expression node
 	
-	CParseHandlerBase *op_parse_handler = CParseHandlerFactory::GetParseHandler(m_mp, CDXLTokens::XmlstrToken(EdxltokenScalar), m_parse_handler_mgr, this);
+	CParseHandlerBase *op_parse_handler = CParseHandlerFactory::GetParseHandler(m_mp, EdxltokenScalar, m_parse_handler_mgr, this);
 	m_parse_handler_mgr->ActivateParseHandler(op_parse_handler);
 	
 	// store child parse handler
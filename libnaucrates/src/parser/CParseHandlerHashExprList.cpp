@@ -70,7 +70,7 @@ CParseHandlerHashExprList::StartElement
 		// we must have seen a hash expr list already and initialized the hash expr list node
 		GPOS_ASSERT(NULL != m_dxl_node);
 		// start new hash expr element
-		CParseHandlerBase *hash_expr_parse_handler = CParseHandlerFactory::GetParseHandler(m_mp, CDXLTokens::XmlstrToken(EdxltokenScalarHashExpr), m_parse_handler_mgr, this);
+		CParseHandlerBase *hash_expr_parse_handler = CParseHandlerFactory::GetParseHandler(m_mp, EdxltokenScalarHashExpr, m_parse_handler_mgr, this);
 		m_parse_handler_mgr->ActivateParseHandler(hash_expr_parse_handler);
 		
 		// store parse handler
@@ -72,7 +72,7 @@ CParseHandlerIndexCondList::StartElement
 		CParseHandlerBase *op_parse_handler = CParseHandlerFactory::GetParseHandler
 															(
 															m_mp,
-															CDXLTokens::XmlstrToken(EdxltokenScalar),
+															EdxltokenScalar,
 															m_parse_handler_mgr,
 															this
 															);
@@ -74,7 +74,7 @@ CParseHandlerLogicalCTEAnchor::StartElement
 
 	// create and activate the parse handler for the child expression node
 	CParseHandlerBase *child_parse_handler =
-			CParseHandlerFactory::GetParseHandler(m_mp, CDXLTokens::XmlstrToken(EdxltokenLogical), m_parse_handler_mgr, this);
+			CParseHandlerFactory::GetParseHandler(m_mp, EdxltokenLogical, m_parse_handler_mgr, this);
 	m_parse_handler_mgr->ActivateParseHandler(child_parse_handler);
 
 	// store parse handler
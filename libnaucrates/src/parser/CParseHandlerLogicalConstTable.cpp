@@ -71,7 +71,7 @@ CParseHandlerLogicalConstTable::StartElement
 		m_const_tuples_datum_array = GPOS_NEW(m_mp) CDXLDatum2dArray(m_mp);
 
 		// install a parse handler for the columns
-		CParseHandlerBase *col_desc_parse_handler = CParseHandlerFactory::GetParseHandler(m_mp, CDXLTokens::XmlstrToken(EdxltokenColumns), m_parse_handler_mgr, this);
+		CParseHandlerBase *col_desc_parse_handler = CParseHandlerFactory::GetParseHandler(m_mp, EdxltokenColumns, m_parse_handler_mgr, this);
 		m_parse_handler_mgr->ActivateParseHandler(col_desc_parse_handler);
 		
 		// store parse handler
@@ -67,15 +67,15 @@ CParseHandlerLogicalGroupBy::StartElement
 		// create child node parsers
 
 		// parse handler for logical operator
-		CParseHandlerBase *lg_op_parse_handler = CParseHandlerFactory::GetParseHandler(m_mp, CDXLTokens::XmlstrToken(EdxltokenLogical), m_parse_handler_mgr, this);
+		CParseHandlerBase *lg_op_parse_handler = CParseHandlerFactory::GetParseHandler(m_mp, EdxltokenLogical, m_parse_handler_mgr, this);
 		m_parse_handler_mgr->ActivateParseHandler(lg_op_parse_handler);
 
 		// parse handler for the proj list
-		CParseHandlerBase *proj_list_parse_handler = CParseHandlerFactory::GetParseHandler(m_mp, CDXLTokens::XmlstrToken(EdxltokenScalarProjList), m_parse_handler_mgr, this);
+		CParseHandlerBase *proj_list_parse_handler = CParseHandlerFactory::GetParseHandler(m_mp, EdxltokenScalarProjList, m_parse_handler_mgr, this);
 		m_parse_handler_mgr->ActivateParseHandler(proj_list_parse_handler);
 
 		//parse handler for the grouping columns list
-		CParseHandlerBase *grouping_col_list_parse_handler = CParseHandlerFactory::GetParseHandler(m_mp, CDXLTokens::XmlstrToken(EdxltokenScalarGroupingColList), m_parse_handler_mgr, this);
+		CParseHandlerBase *grouping_col_list_parse_handler = CParseHandlerFactory::GetParseHandler(m_mp, EdxltokenScalarGroupingColList, m_parse_handler_mgr, this);
 		m_parse_handler_mgr->ActivateParseHandler(grouping_col_list_parse_handler);
 
 		// store child parse handler in array
@@ -71,11 +71,11 @@ CParseHandlerLogicalInsert::StartElement
 	// create child node parsers
 
 	// parse handler for logical operator
-	CParseHandlerBase *child_parse_handler = CParseHandlerFactory::GetParseHandler(m_mp, CDXLTokens::XmlstrToken(EdxltokenLogical), m_parse_handler_mgr, this);
+	CParseHandlerBase *child_parse_handler = CParseHandlerFactory::GetParseHandler(m_mp, EdxltokenLogical, m_parse_handler_mgr, this);
 	m_parse_handler_mgr->ActivateParseHandler(child_parse_handler);
 
 	//parse handler for the table descriptor
-	CParseHandlerBase *pphTabDesc = CParseHandlerFactory::GetParseHandler(m_mp, CDXLTokens::XmlstrToken(EdxltokenTableDescr), m_parse_handler_mgr, this);
+	CParseHandlerBase *pphTabDesc = CParseHandlerFactory::GetParseHandler(m_mp, EdxltokenTableDescr, m_parse_handler_mgr, this);
 	m_parse_handler_mgr->ActivateParseHandler(pphTabDesc);
 
 	// store child parse handler in array
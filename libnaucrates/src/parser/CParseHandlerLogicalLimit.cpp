@@ -77,17 +77,17 @@ CParseHandlerLogicalLimit::StartElement
 		// create child node parsers
 
 		// parse handler for logical operator
-		CParseHandlerBase *child_parse_handler = CParseHandlerFactory::GetParseHandler(m_mp, CDXLTokens::XmlstrToken(EdxltokenLogical), m_parse_handler_mgr, this);
+		CParseHandlerBase *child_parse_handler = CParseHandlerFactory::GetParseHandler(m_mp, EdxltokenLogical, m_parse_handler_mgr, this);
 		m_parse_handler_mgr->ActivateParseHandler(child_parse_handler);
 
-		CParseHandlerBase *offset_parse_handler = CParseHandlerFactory::GetParseHandler(m_mp, CDXLTokens::XmlstrToken(EdxltokenScalarLimitOffset), m_parse_handler_mgr, this);
+		CParseHandlerBase *offset_parse_handler = CParseHandlerFactory::GetParseHandler(m_mp, EdxltokenScalarLimitOffset, m_parse_handler_mgr, this);
 		m_parse_handler_mgr->ActivateParseHandler(offset_parse_handler);
 
-		CParseHandlerBase *count_parse_handler = CParseHandlerFactory::GetParseHandler(m_mp, CDXLTokens::XmlstrToken(EdxltokenScalarLimitCount), m_parse_handler_mgr, this);
+		CParseHandlerBase *count_parse_handler = CParseHandlerFactory::GetParseHandler(m_mp, EdxltokenScalarLimitCount, m_parse_handler_mgr, this);
 		m_parse_handler_mgr->ActivateParseHandler(count_parse_handler);
 
 		// parse handler for the sorting column list
-		CParseHandlerBase *sort_col_list_parse_handler = CParseHandlerFactory::GetParseHandler(m_mp, CDXLTokens::XmlstrToken(EdxltokenScalarSortColList), m_parse_handler_mgr, this);
+		CParseHandlerBase *sort_col_list_parse_handler = CParseHandlerFactory::GetParseHandler(m_mp, EdxltokenScalarSortColList, m_parse_handler_mgr, this);
 		m_parse_handler_mgr->ActivateParseHandler(sort_col_list_parse_handler);
 
 		// store child parse handler in array
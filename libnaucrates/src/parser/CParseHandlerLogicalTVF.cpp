@@ -86,7 +86,7 @@ CParseHandlerLogicalTVF::StartElement
 	else if (0 == XMLString::compareString(CDXLTokens::XmlstrToken(EdxltokenColumns), element_local_name))
 	{
 		// parse handler for columns
-		CParseHandlerBase *cold_descr_parse_handler = CParseHandlerFactory::GetParseHandler(m_mp, CDXLTokens::XmlstrToken(EdxltokenColumns), m_parse_handler_mgr, this);
+		CParseHandlerBase *cold_descr_parse_handler = CParseHandlerFactory::GetParseHandler(m_mp, EdxltokenColumns, m_parse_handler_mgr, this);
 		m_parse_handler_mgr->ActivateParseHandler(cold_descr_parse_handler);
 
 		// store parse handlers
@@ -97,7 +97,7 @@ CParseHandlerLogicalTVF::StartElement
 	else
 	{
 		// parse scalar child
-		CParseHandlerBase *child_parse_handler = CParseHandlerFactory::GetParseHandler(m_mp, CDXLTokens::XmlstrToken(EdxltokenScalar), m_parse_handler_mgr, this);
+		CParseHandlerBase *child_parse_handler = CParseHandlerFactory::GetParseHandler(m_mp, EdxltokenScalar, m_parse_handler_mgr, this);
 		m_parse_handler_mgr->ActivateParseHandler(child_parse_handler);
 
 		// store parse handlers
@@ -202,7 +202,7 @@ CParseHandlerMDGPDBScalarOp::StartElement
 	else if (0 == XMLString::compareString(CDXLTokens::XmlstrToken(EdxltokenOpClasses), element_local_name))
 	{
 		// parse handler for operator class list
-		CParseHandlerBase *op_class_list_parse_handler = CParseHandlerFactory::GetParseHandler(m_mp, CDXLTokens::XmlstrToken(EdxltokenMetadataIdList), m_parse_handler_mgr, this);
+		CParseHandlerBase *op_class_list_parse_handler = CParseHandlerFactory::GetParseHandler(m_mp, EdxltokenMetadataIdList, m_parse_handler_mgr, this);
 		m_parse_handler_mgr->ActivateParseHandler(op_class_list_parse_handler);
 		this->Append(op_class_list_parse_handler);
 		op_class_list_parse_handler->startElement(element_uri, element_local_name, element_qname, attrs);
@@ -97,7 +97,7 @@ CParseHandlerMDRelation::StartElement
 		if (pphMdlIndexInfo->GetMdIndexInfoArray()->Size() > 0)
 		{
 			// parse handler for part constraints
-			CParseHandlerBase *pphPartConstraint= CParseHandlerFactory::GetParseHandler(m_mp, CDXLTokens::XmlstrToken(EdxltokenScalar), m_parse_handler_mgr, this);
+			CParseHandlerBase *pphPartConstraint= CParseHandlerFactory::GetParseHandler(m_mp, EdxltokenScalar, m_parse_handler_mgr, this);
 			m_parse_handler_mgr->ActivateParseHandler(pphPartConstraint);
 			this->Append(pphPartConstraint);
 		}
@@ -347,19 +347,19 @@ void
 CParseHandlerMDRelation::ParseChildNodes()
 {
 	// parse handler for check constraints
-	CParseHandlerBase *check_constraint_list_parse_handler = CParseHandlerFactory::GetParseHandler(m_mp, CDXLTokens::XmlstrToken(EdxltokenMetadataIdList), m_parse_handler_mgr, this);
+	CParseHandlerBase *check_constraint_list_parse_handler = CParseHandlerFactory::GetParseHandler(m_mp, EdxltokenMetadataIdList, m_parse_handler_mgr, this);
 	m_parse_handler_mgr->ActivateParseHandler(check_constraint_list_parse_handler);
 
 	// parse handler for trigger list
-	CParseHandlerBase *trigger_list_parse_handler = CParseHandlerFactory::GetParseHandler(m_mp, CDXLTokens::XmlstrToken(EdxltokenMetadataIdList), m_parse_handler_mgr, this);
+	CParseHandlerBase *trigger_list_parse_handler = CParseHandlerFactory::GetParseHandler(m_mp, EdxltokenMetadataIdList, m_parse_handler_mgr, this);
 	m_parse_handler_mgr->ActivateParseHandler(trigger_list_parse_handler);
 
 	// parse handler for index info list
-	CParseHandlerBase *index_info_list_parse_handler = CParseHandlerFactory::GetParseHandler(m_mp, CDXLTokens::XmlstrToken(EdxltokenIndexInfoList), m_parse_handler_mgr, this);
+	CParseHandlerBase *index_info_list_parse_handler = CParseHandlerFactory::GetParseHandler(m_mp, EdxltokenIndexInfoList, m_parse_handler_mgr, this);
 	m_parse_handler_mgr->ActivateParseHandler(index_info_list_parse_handler);
 
 	// parse handler for the columns
-	CParseHandlerBase *columns_parse_handler = CParseHandlerFactory::GetParseHandler(m_mp, CDXLTokens::XmlstrToken(EdxltokenMetadataColumns), m_parse_handler_mgr, this);
+	CParseHandlerBase *columns_parse_handler = CParseHandlerFactory::GetParseHandler(m_mp, EdxltokenMetadataColumns, m_parse_handler_mgr, this);
 	m_parse_handler_mgr->ActivateParseHandler(columns_parse_handler);
 
 	// store parse handlers
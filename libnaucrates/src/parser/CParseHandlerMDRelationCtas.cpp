@@ -126,11 +126,11 @@ CParseHandlerMDRelationCtas::StartElement
 						);
 
 	//parse handler for the storage options
-	CParseHandlerBase *ctas_options_parse_handler = CParseHandlerFactory::GetParseHandler(m_mp, CDXLTokens::XmlstrToken(EdxltokenCTASOptions), m_parse_handler_mgr, this);
+	CParseHandlerBase *ctas_options_parse_handler = CParseHandlerFactory::GetParseHandler(m_mp, EdxltokenCTASOptions, m_parse_handler_mgr, this);
 	m_parse_handler_mgr->ActivateParseHandler(ctas_options_parse_handler);
 	
 	// parse handler for the columns
-	CParseHandlerBase *columns_parse_handler = CParseHandlerFactory::GetParseHandler(m_mp, CDXLTokens::XmlstrToken(EdxltokenMetadataColumns), m_parse_handler_mgr, this);
+	CParseHandlerBase *columns_parse_handler = CParseHandlerFactory::GetParseHandler(m_mp, EdxltokenMetadataColumns, m_parse_handler_mgr, this);
 	m_parse_handler_mgr->ActivateParseHandler(columns_parse_handler);
 	
 	// store parse handlers
@@ -35,7 +35,8 @@ CParseHandlerManager::CParseHandlerManager
 	m_dxl_memory_manager(dxl_memory_manager),
 	m_xml_reader(sax_2_xml_reader),
 	m_curr_parse_handler(NULL),
-	m_iteration_since_last_abortcheck(0)
+	m_iteration_since_last_abortcheck(0),
+	m_curr_element_token(EdxltokenSentinel)
 {
 	m_parse_handler_stack = GPOS_NEW(dxl_memory_manager->Pmp()) ParseHandlerStack(dxl_memory_manager->Pmp());
 }
@@ -76,8 +77,7 @@ CParseHandlerManager::ActivateParseHandler(CParseHandlerBase *parse_handler_base
 	GPOS_ASSERT(NULL != parse_handler_base);
 	
 	m_curr_parse_handler = parse_handler_base;
-	m_xml_reader->setContentHandler(parse_handler_base);
-	m_xml_reader->setErrorHandler(parse_handler_base);
+	SetReaderHandler(parse_handler_base);
 }
 
 //---------------------------------------------------------------------------
@@ -106,8 +106,7 @@ CParseHandlerManager::ReplaceHandler
 	}
 	
 	m_curr_parse_handler = parse_handler_base;
-	m_xml_reader->setContentHandler(parse_handler_base);	
-	m_xml_reader->setErrorHandler(parse_handler_base);
+	SetReaderHandler(parse_handler_base);
 }
 
 
@@ -137,8 +136,29 @@ CParseHandlerManager::DeactivateHandler()
 		m_curr_parse_handler = NULL;
 	}
 	
-	m_xml_reader->setContentHandler(m_curr_parse_handler);
-	m_xml_reader->setErrorHandler(m_curr_parse_handler);
+	SetReaderHandler(m_curr_parse_handler);
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CParseHandlerManager::SetReaderHandler
+//
+//	@doc:
+//		Install the given handler in the Xerces reader, if any; the streaming
+//		parser dispatches to the current handler directly
+//
+//---------------------------------------------------------------------------
+void
+CParseHandlerManager::SetReaderHandler
+	(
+	CParseHandlerBase *parse_handler_base
+	)
+{
+	if (NULL != m_xml_reader)
+	{
+		m_xml_reader->setContentHandler(parse_handler_base);
+		m_xml_reader->setErrorHandler(parse_handler_base);
+	}
 }
 
 //---------------------------------------------------------------------------
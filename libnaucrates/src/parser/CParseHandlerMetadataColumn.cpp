@@ -168,7 +168,7 @@ CParseHandlerMetadataColumn::StartElement
 	CParseHandlerBase *pph = CParseHandlerFactory::GetParseHandler
 										(
 										m_mp,
-										CDXLTokens::XmlstrToken(EdxltokenColumnDefaultValue),
+										EdxltokenColumnDefaultValue,
 										m_parse_handler_mgr,
 										this
 										);
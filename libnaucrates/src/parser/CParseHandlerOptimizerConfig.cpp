@@ -94,7 +94,7 @@ CParseHandlerOptimizerConfig::StartElement
 	if (0 == XMLString::compareString(CDXLTokens::XmlstrToken(EdxltokenHint), element_local_name))
 	{
 		// install a parse handler for the hint config
-		CParseHandlerBase *pphHint = CParseHandlerFactory::GetParseHandler(m_mp, CDXLTokens::XmlstrToken(EdxltokenHint), m_parse_handler_mgr, this);
+		CParseHandlerBase *pphHint = CParseHandlerFactory::GetParseHandler(m_mp, EdxltokenHint, m_parse_handler_mgr, this);
 		m_parse_handler_mgr->ActivateParseHandler(pphHint);
 		pphHint->startElement(element_uri, element_local_name, element_qname, attrs);
 		this->Append(pphHint);
@@ -104,7 +104,7 @@ CParseHandlerOptimizerConfig::StartElement
 	else if (0 == XMLString::compareString(CDXLTokens::XmlstrToken(EdxltokenCostModelConfig), element_local_name))
 	{
 		// install a parse handler for the cost model config
-		CParseHandlerBase *pphCostModel = CParseHandlerFactory::GetParseHandler(m_mp, CDXLTokens::XmlstrToken(EdxltokenCostModelConfig), m_parse_handler_mgr, this);
+		CParseHandlerBase *pphCostModel = CParseHandlerFactory::GetParseHandler(m_mp, EdxltokenCostModelConfig, m_parse_handler_mgr, this);
 		m_parse_handler_mgr->ActivateParseHandler(pphCostModel);
 		pphCostModel->startElement(element_uri, element_local_name, element_qname, attrs);
 		this->Append(pphCostModel);
@@ -114,7 +114,7 @@ CParseHandlerOptimizerConfig::StartElement
 	else if (0 == XMLString::compareString(CDXLTokens::XmlstrToken(EdxltokenTraceFlags), element_local_name))
 	{
 		// install a parse handler for the trace flags
-		CParseHandlerBase *pphTraceFlags = CParseHandlerFactory::GetParseHandler(m_mp, CDXLTokens::XmlstrToken(EdxltokenTraceFlags), m_parse_handler_mgr, this);
+		CParseHandlerBase *pphTraceFlags = CParseHandlerFactory::GetParseHandler(m_mp, EdxltokenTraceFlags, m_parse_handler_mgr, this);
 		m_parse_handler_mgr->ActivateParseHandler(pphTraceFlags);
 		pphTraceFlags->startElement(element_uri, element_local_name, element_qname, attrs);
 		this->Append(pphTraceFlags);
@@ -127,19 +127,19 @@ CParseHandlerOptimizerConfig::StartElement
 		GPOS_RAISE(gpdxl::ExmaDXL, gpdxl::ExmiDXLUnexpectedTag, str->GetBuffer());
 	}
 
-	CParseHandlerBase *pphWindowOids = CParseHandlerFactory::GetParseHandler(m_mp, CDXLTokens::XmlstrToken(EdxltokenWindowOids), m_parse_handler_mgr, this);
+	CParseHandlerBase *pphWindowOids = CParseHandlerFactory::GetParseHandler(m_mp, EdxltokenWindowOids, m_parse_handler_mgr, this);
 	m_parse_handler_mgr->ActivateParseHandler(pphWindowOids);
 
 	// install a parse handler for the CTE configuration
-	CParseHandlerBase *pphCTEConfig = CParseHandlerFactory::GetParseHandler(m_mp, CDXLTokens::XmlstrToken(EdxltokenCTEConfig), m_parse_handler_mgr, this);
+	CParseHandlerBase *pphCTEConfig = CParseHandlerFactory::GetParseHandler(m_mp, EdxltokenCTEConfig, m_parse_handler_mgr, this);
 	m_parse_handler_mgr->ActivateParseHandler(pphCTEConfig);
 
 	// install a parse handler for the statistics configuration
-	CParseHandlerBase *pphStatisticsConfig = CParseHandlerFactory::GetParseHandler(m_mp, CDXLTokens::XmlstrToken(EdxltokenStatisticsConfig), m_parse_handler_mgr, this);
+	CParseHandlerBase *pphStatisticsConfig = CParseHandlerFactory::GetParseHandler(m_mp, EdxltokenStatisticsConfig, m_parse_handler_mgr, this);
 	m_parse_handler_mgr->ActivateParseHandler(pphStatisticsConfig);
 
 	// install a parse handler for the enumerator configuration
-	CParseHandlerBase *pphEnumeratorConfig = CParseHandlerFactory::GetParseHandler(m_mp, CDXLTokens::XmlstrToken(EdxltokenEnumeratorConfig), m_parse_handler_mgr, this);
+	CParseHandlerBase *pphEnumeratorConfig = CParseHandlerFactory::GetParseHandler(m_mp, EdxltokenEnumeratorConfig, m_parse_handler_mgr, this);
 	m_parse_handler_mgr->ActivateParseHandler(pphEnumeratorConfig);
 
 	// store parse handlers
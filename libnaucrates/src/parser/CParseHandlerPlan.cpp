@@ -105,7 +105,7 @@ CParseHandlerPlan::StartElement
 	if (0 == XMLString::compareString(CDXLTokens::XmlstrToken(EdxltokenDirectDispatchInfo), element_local_name))
 	{
 		GPOS_ASSERT(0 < this->Length());
-		CParseHandlerBase *direct_dispatch_parse_handler = CParseHandlerFactory::GetParseHandler(m_mp, CDXLTokens::XmlstrToken(EdxltokenDirectDispatchInfo), m_parse_handler_mgr, this);
+		CParseHandlerBase *direct_dispatch_parse_handler = CParseHandlerFactory::GetParseHandler(m_mp, EdxltokenDirectDispatchInfo, m_parse_handler_mgr, this);
 		m_parse_handler_mgr->ActivateParseHandler(direct_dispatch_parse_handler);
 		
 		// store parse handler
@@ -130,7 +130,7 @@ CParseHandlerPlan::StartElement
 
 	// create a parse handler for physical nodes and activate it
 	GPOS_ASSERT(NULL != m_mp);
-	CParseHandlerBase *base_parse_handler = CParseHandlerFactory::GetParseHandler(m_mp, CDXLTokens::XmlstrToken(EdxltokenPhysical), m_parse_handler_mgr, this);
+	CParseHandlerBase *base_parse_handler = CParseHandlerFactory::GetParseHandler(m_mp, EdxltokenPhysical, m_parse_handler_mgr, this);
 	m_parse_handler_mgr->ActivateParseHandler(base_parse_handler);
 	
 	// store parse handler
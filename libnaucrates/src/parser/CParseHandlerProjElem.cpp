@@ -69,7 +69,7 @@ CParseHandlerProjElem::StartElement
 	
 	// create and activate the parse handler for the child scalar expression node
 	
-	CParseHandlerBase *parse_handler_root = CParseHandlerFactory::GetParseHandler(m_mp, CDXLTokens::XmlstrToken(EdxltokenScalar), m_parse_handler_mgr, this);
+	CParseHandlerBase *parse_handler_root = CParseHandlerFactory::GetParseHandler(m_mp, EdxltokenScalar, m_parse_handler_mgr, this);
 	m_parse_handler_mgr->ActivateParseHandler(parse_handler_root);
 	
 	// store parse handler
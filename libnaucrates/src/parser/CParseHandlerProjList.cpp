@@ -71,7 +71,7 @@ CParseHandlerProjList::StartElement
 		GPOS_ASSERT(NULL != m_dxl_node);
 
 		// start new project element
-		CParseHandlerBase *parse_handler_proj_element = CParseHandlerFactory::GetParseHandler(m_mp, CDXLTokens::XmlstrToken(EdxltokenScalarProjElem), m_parse_handler_mgr, this);
+		CParseHandlerBase *parse_handler_proj_element = CParseHandlerFactory::GetParseHandler(m_mp, EdxltokenScalarProjElem, m_parse_handler_mgr, this);
 		m_parse_handler_mgr->ActivateParseHandler(parse_handler_proj_element);
 		
 		// store parse handler
@@ -89,7 +89,7 @@ CParseHandlerProperties::StartElement
 	if (0 == XMLString::compareString(CDXLTokens::XmlstrToken(EdxltokenProperties), element_local_name))
 	{
 		// create and install cost and output column parsers
-		CParseHandlerBase *parse_handler_root = CParseHandlerFactory::GetParseHandler(m_mp, CDXLTokens::XmlstrToken(EdxltokenCost), m_parse_handler_mgr, this);
+		CParseHandlerBase *parse_handler_root = CParseHandlerFactory::GetParseHandler(m_mp, EdxltokenCost, m_parse_handler_mgr, this);
 		m_parse_handler_mgr->ActivateParseHandler(parse_handler_root);
 
 		// store parse handler
@@ -100,7 +100,7 @@ CParseHandlerProperties::StartElement
 		GPOS_ASSERT(1 == this->Length());
 
 		// create and install derived relation statistics parsers
-		CParseHandlerBase *parse_handler_stats = CParseHandlerFactory::GetParseHandler(m_mp, CDXLTokens::XmlstrToken(EdxltokenStatsDerivedRelation), m_parse_handler_mgr, this);
+		CParseHandlerBase *parse_handler_stats = CParseHandlerFactory::GetParseHandler(m_mp, EdxltokenStatsDerivedRelation, m_parse_handler_mgr, this);
 		m_parse_handler_mgr->ActivateParseHandler(parse_handler_stats);
 
 		// store parse handler
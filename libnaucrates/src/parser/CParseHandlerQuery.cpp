@@ -147,13 +147,13 @@ CParseHandlerQuery::StartElement
 	GPOS_ASSERT(NULL != m_mp);
 
 	// create parse handler for the query output node
-	CParseHandlerBase *parse_handler_query_output = CParseHandlerFactory::GetParseHandler(m_mp, CDXLTokens::XmlstrToken(EdxltokenQueryOutput), m_parse_handler_mgr, this);
+	CParseHandlerBase *parse_handler_query_output = CParseHandlerFactory::GetParseHandler(m_mp, EdxltokenQueryOutput, m_parse_handler_mgr, this);
 
 	// create parse handler for the CTE list
-	CParseHandlerBase *parse_handler_cte = CParseHandlerFactory::GetParseHandler(m_mp, CDXLTokens::XmlstrToken(EdxltokenCTEList), m_parse_handler_mgr, this);
+	CParseHandlerBase *parse_handler_cte = CParseHandlerFactory::GetParseHandler(m_mp, EdxltokenCTEList, m_parse_handler_mgr, this);
 
 	// create a parse handler for logical nodes
-	CParseHandlerBase *parse_handler_root = CParseHandlerFactory::GetParseHandler(m_mp, CDXLTokens::XmlstrToken(EdxltokenLogical), m_parse_handler_mgr, this);
+	CParseHandlerBase *parse_handler_root = CParseHandlerFactory::GetParseHandler(m_mp, EdxltokenLogical, m_parse_handler_mgr, this);
 
 	m_parse_handler_mgr->ActivateParseHandler(parse_handler_root);
 	m_parse_handler_mgr->ActivateParseHandler(parse_handler_cte);
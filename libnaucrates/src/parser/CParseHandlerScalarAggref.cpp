@@ -70,7 +70,7 @@ CParseHandlerScalarAggref::StartElement
 		// we must have seen an aggref already and initialized the aggref node
 		GPOS_ASSERT(NULL != m_dxl_node);
 
-		CParseHandlerBase *parse_handler_base = CParseHandlerFactory::GetParseHandler(m_mp, CDXLTokens::XmlstrToken(EdxltokenScalar), m_parse_handler_mgr, this);
+		CParseHandlerBase *parse_handler_base = CParseHandlerFactory::GetParseHandler(m_mp, EdxltokenScalar, m_parse_handler_mgr, this);
 		m_parse_handler_mgr->ActivateParseHandler(parse_handler_base);
 
 		// store parse handlers
@@ -85,7 +85,7 @@ CParseHandlerScalarAssertConstraintList::StartElement
 										);
 		m_dxl_op_assert_constraint = GPOS_NEW(m_mp) CDXLScalarAssertConstraint(m_mp, pstrErrorMsg);
 		
-		CParseHandlerBase *child_parse_handler = CParseHandlerFactory::GetParseHandler(m_mp, CDXLTokens::XmlstrToken(EdxltokenScalar), m_parse_handler_mgr, this);
+		CParseHandlerBase *child_parse_handler = CParseHandlerFactory::GetParseHandler(m_mp, EdxltokenScalar, m_parse_handler_mgr, this);
 		m_parse_handler_mgr->ActivateParseHandler(child_parse_handler);
 
 		this->Append(child_parse_handler);	
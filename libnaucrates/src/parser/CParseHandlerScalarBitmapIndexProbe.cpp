@@ -76,12 +76,12 @@ CParseHandlerScalarBitmapIndexProbe::StartElement
 
 	// parse handler for the index descriptor
 	CParseHandlerBase *index_descr_parse_handler =
-			CParseHandlerFactory::GetParseHandler(m_mp, CDXLTokens::XmlstrToken(EdxltokenIndexDescr), m_parse_handler_mgr, this);
+			CParseHandlerFactory::GetParseHandler(m_mp, EdxltokenIndexDescr, m_parse_handler_mgr, this);
 	m_parse_handler_mgr->ActivateParseHandler(index_descr_parse_handler);
 
 	// parse handler for the index condition list
 	CParseHandlerBase *index_cond_list_parse_handler =
-			CParseHandlerFactory::GetParseHandler(m_mp, CDXLTokens::XmlstrToken(EdxltokenScalarIndexCondList), m_parse_handler_mgr, this);
+			CParseHandlerFactory::GetParseHandler(m_mp, EdxltokenScalarIndexCondList, m_parse_handler_mgr, this);
 	m_parse_handler_mgr->ActivateParseHandler(index_cond_list_parse_handler);
 
 	// store parse handlers
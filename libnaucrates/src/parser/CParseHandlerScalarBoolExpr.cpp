@@ -85,7 +85,7 @@ CParseHandlerScalarBoolExpr::StartElement
 		{
 
 			// This is to support nested BoolExpr. TODO:  - create a separate xml tag for boolean expression
-			CParseHandlerBase *bool_expr_parse_handler = CParseHandlerFactory::GetParseHandler(m_mp, CDXLTokens::XmlstrToken(EdxltokenScalarBoolOr), m_parse_handler_mgr, this);
+			CParseHandlerBase *bool_expr_parse_handler = CParseHandlerFactory::GetParseHandler(m_mp, EdxltokenScalarBoolOr, m_parse_handler_mgr, this);
 			m_parse_handler_mgr->ActivateParseHandler(bool_expr_parse_handler);
 
 			// store parse handlers
@@ -101,7 +101,7 @@ CParseHandlerScalarBoolExpr::StartElement
 			GPOS_RAISE(gpdxl::ExmaDXL, gpdxl::ExmiDXLUnexpectedTag, CDXLUtils::CreateDynamicStringFromXMLChArray(m_parse_handler_mgr->GetDXLMemoryManager(), element_local_name)->GetBuffer());
 		}
 
-		CParseHandlerBase *op_parse_handler = CParseHandlerFactory::GetParseHandler(m_mp, CDXLTokens::XmlstrToken(EdxltokenScalar), m_parse_handler_mgr, this);
+		CParseHandlerBase *op_parse_handler = CParseHandlerFactory::GetParseHandler(m_mp, EdxltokenScalar, m_parse_handler_mgr, this);
 		m_parse_handler_mgr->ActivateParseHandler(op_parse_handler);
 
 		// store parse handlers
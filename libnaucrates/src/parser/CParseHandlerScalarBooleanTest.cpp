@@ -76,7 +76,7 @@ CParseHandlerScalarBooleanTest::StartElement
 		else
 		{
 			CParseHandlerBase *child_parse_handler =
-					CParseHandlerFactory::GetParseHandler(m_mp, CDXLTokens::XmlstrToken(EdxltokenScalar), m_parse_handler_mgr, this);
+					CParseHandlerFactory::GetParseHandler(m_mp, EdxltokenScalar, m_parse_handler_mgr, this);
 
 			m_parse_handler_mgr->ActivateParseHandler(child_parse_handler);
 
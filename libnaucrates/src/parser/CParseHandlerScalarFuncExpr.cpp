@@ -76,7 +76,7 @@ CParseHandlerScalarFuncExpr::StartElement
 		else
 		{
 			// This is to support nested FuncExpr
-			CParseHandlerBase *func_parse_handler = CParseHandlerFactory::GetParseHandler(m_mp, CDXLTokens::XmlstrToken(EdxltokenScalarFuncExpr), m_parse_handler_mgr, this);
+			CParseHandlerBase *func_parse_handler = CParseHandlerFactory::GetParseHandler(m_mp, EdxltokenScalarFuncExpr, m_parse_handler_mgr, this);
 			m_parse_handler_mgr->ActivateParseHandler(func_parse_handler);
 
 			// store parse handlers
@@ -89,7 +89,7 @@ CParseHandlerScalarFuncExpr::StartElement
 	{
 		GPOS_ASSERT(m_inside_func_expr);
 
-		CParseHandlerBase *child_parse_handler = CParseHandlerFactory::GetParseHandler(m_mp, CDXLTokens::XmlstrToken(EdxltokenScalar), m_parse_handler_mgr, this);
+		CParseHandlerBase *child_parse_handler = CParseHandlerFactory::GetParseHandler(m_mp, EdxltokenScalar, m_parse_handler_mgr, this);
 		m_parse_handler_mgr->ActivateParseHandler(child_parse_handler);
 
 		// store parse handlers
@@ -73,7 +73,7 @@ CParseHandlerScalarOpExpr::StartElement
 	{
 		if (2 > m_num_of_children)
 		{
-			CParseHandlerBase *op_parse_handler = CParseHandlerFactory::GetParseHandler(m_mp, CDXLTokens::XmlstrToken(EdxltokenScalar), m_parse_handler_mgr, this);
+			CParseHandlerBase *op_parse_handler = CParseHandlerFactory::GetParseHandler(m_mp, EdxltokenScalar, m_parse_handler_mgr, this);
 
 			m_parse_handler_mgr->ActivateParseHandler(op_parse_handler);
 
@@ -128,15 +128,15 @@ CParseHandlerScalarSubPlan::StartElement
 	m_dxl_subplan_type = GetDXLSubplanType(xmlszSubplanType);
 
 	// parse handler for child physical node
-	CParseHandlerBase *child_parse_handler = CParseHandlerFactory::GetParseHandler(m_mp, CDXLTokens::XmlstrToken(EdxltokenPhysical), m_parse_handler_mgr, this);
+	CParseHandlerBase *child_parse_handler = CParseHandlerFactory::GetParseHandler(m_mp, EdxltokenPhysical, m_parse_handler_mgr, this);
 	m_parse_handler_mgr->ActivateParseHandler(child_parse_handler);
 
 	// parse handler for params
-	CParseHandlerBase *pphParamList = CParseHandlerFactory::GetParseHandler(m_mp, CDXLTokens::XmlstrToken(EdxltokenScalarSubPlanParamList), m_parse_handler_mgr, this);
+	CParseHandlerBase *pphParamList = CParseHandlerFactory::GetParseHandler(m_mp, EdxltokenScalarSubPlanParamList, m_parse_handler_mgr, this);
 	m_parse_handler_mgr->ActivateParseHandler(pphParamList);
 
 	// parse handler for test expression
-	CParseHandlerBase *pphTestExpr = CParseHandlerFactory::GetParseHandler(m_mp, CDXLTokens::XmlstrToken(EdxltokenScalarSubPlanTestExpr), m_parse_handler_mgr, this);
+	CParseHandlerBase *pphTestExpr = CParseHandlerFactory::GetParseHandler(m_mp, EdxltokenScalarSubPlanTestExpr, m_parse_handler_mgr, this);
 	m_parse_handler_mgr->ActivateParseHandler(pphTestExpr);
 
 	// store parse handlers
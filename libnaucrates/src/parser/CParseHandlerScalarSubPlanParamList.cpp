@@ -88,7 +88,7 @@ CParseHandlerScalarSubPlanParamList::StartElement
 		GPOS_ASSERT(m_has_param_list);
 
 		// start new param
-		CParseHandlerBase *parse_handler_subplan_param = CParseHandlerFactory::GetParseHandler(m_mp, CDXLTokens::XmlstrToken(EdxltokenScalarSubPlanParam), m_parse_handler_mgr, this);
+		CParseHandlerBase *parse_handler_subplan_param = CParseHandlerFactory::GetParseHandler(m_mp, EdxltokenScalarSubPlanParam, m_parse_handler_mgr, this);
 		m_parse_handler_mgr->ActivateParseHandler(parse_handler_subplan_param);
 
 		// store parse handler
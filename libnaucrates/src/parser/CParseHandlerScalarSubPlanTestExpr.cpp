@@ -73,7 +73,7 @@ CParseHandlerScalarSubPlanTestExpr::StartElement
 	if (0 != XMLString::compareString(CDXLTokens::XmlstrToken(EdxltokenScalarSubPlanTestExpr), element_local_name))
 	{
 		// install a scalar element parser for parsing the test expression
-		CParseHandlerBase *child_parse_handler = CParseHandlerFactory::GetParseHandler(m_mp, CDXLTokens::XmlstrToken(EdxltokenScalar), m_parse_handler_mgr, this);
+		CParseHandlerBase *child_parse_handler = CParseHandlerFactory::GetParseHandler(m_mp, EdxltokenScalar, m_parse_handler_mgr, this);
 
 		m_parse_handler_mgr->ActivateParseHandler(child_parse_handler);
 
@@ -77,7 +77,7 @@ CParseHandlerScalarSubquery::StartElement
 	m_dxl_op = GPOS_NEW(m_mp) CDXLScalarSubquery(m_mp, colid);
 
 	// parse handler for child node
-	CParseHandlerBase *child_parse_handler = CParseHandlerFactory::GetParseHandler(m_mp, CDXLTokens::XmlstrToken(EdxltokenLogical), m_parse_handler_mgr, this);
+	CParseHandlerBase *child_parse_handler = CParseHandlerFactory::GetParseHandler(m_mp, EdxltokenLogical, m_parse_handler_mgr, this);
 	m_parse_handler_mgr->ActivateParseHandler(child_parse_handler);
 		
 	// store child parse handler in array
@@ -114,10 +114,10 @@ CParseHandlerScalarSubqueryQuantified::StartElement
 	}
 	
 	// parse handler for the child nodes
-	CParseHandlerBase *parse_handler_logical_child = CParseHandlerFactory::GetParseHandler(m_mp, CDXLTokens::XmlstrToken(EdxltokenLogical), m_parse_handler_mgr, this);
+	CParseHandlerBase *parse_handler_logical_child = CParseHandlerFactory::GetParseHandler(m_mp, EdxltokenLogical, m_parse_handler_mgr, this);
 	m_parse_handler_mgr->ActivateParseHandler(parse_handler_logical_child);
 
-	CParseHandlerBase *parse_handler_scalar_child = CParseHandlerFactory::GetParseHandler(m_mp, CDXLTokens::XmlstrToken(EdxltokenScalar), m_parse_handler_mgr, this);
+	CParseHandlerBase *parse_handler_scalar_child = CParseHandlerFactory::GetParseHandler(m_mp, EdxltokenScalar, m_parse_handler_mgr, this);
 	m_parse_handler_mgr->ActivateParseHandler(parse_handler_scalar_child);
 
 	// store child parse handler in array
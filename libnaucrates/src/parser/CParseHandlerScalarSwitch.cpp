@@ -76,7 +76,7 @@ CParseHandlerScalarSwitch::StartElement
 		GPOS_ASSERT(NULL != m_dxl_node && m_arg_processed && !m_default_val_processed);
 
 		// parse case
-		CParseHandlerBase *parse_handler_case = CParseHandlerFactory::GetParseHandler(m_mp, CDXLTokens::XmlstrToken(EdxltokenScalarSwitchCase), m_parse_handler_mgr, this);
+		CParseHandlerBase *parse_handler_case = CParseHandlerFactory::GetParseHandler(m_mp, EdxltokenScalarSwitchCase, m_parse_handler_mgr, this);
 		m_parse_handler_mgr->ActivateParseHandler(parse_handler_case);
 
 		// store parse handlers
@@ -89,7 +89,7 @@ CParseHandlerScalarSwitch::StartElement
 		GPOS_ASSERT(NULL != m_dxl_node && !m_default_val_processed);
 
 		// parse scalar child
-		CParseHandlerBase *child_parse_handler = CParseHandlerFactory::GetParseHandler(m_mp, CDXLTokens::XmlstrToken(EdxltokenScalar), m_parse_handler_mgr, this);
+		CParseHandlerBase *child_parse_handler = CParseHandlerFactory::GetParseHandler(m_mp, EdxltokenScalar, m_parse_handler_mgr, this);
 		m_parse_handler_mgr->ActivateParseHandler(child_parse_handler);
 
 		// store parse handlers
@@ -66,11 +66,11 @@ CParseHandlerScalarSwitchCase::StartElement
 	// order of their expected appearance
 
 	// parse handler for result expression
-	CParseHandlerBase *parse_handler_result = CParseHandlerFactory::GetParseHandler(m_mp, CDXLTokens::XmlstrToken(EdxltokenScalar), m_parse_handler_mgr, this);
+	CParseHandlerBase *parse_handler_result = CParseHandlerFactory::GetParseHandler(m_mp, EdxltokenScalar, m_parse_handler_mgr, this);
 	m_parse_handler_mgr->ActivateParseHandler(parse_handler_result);
 
 	// parse handler for condition expression
-	CParseHandlerBase *parse_handler_condition_expr = CParseHandlerFactory::GetParseHandler(m_mp, CDXLTokens::XmlstrToken(EdxltokenScalar), m_parse_handler_mgr, this);
+	CParseHandlerBase *parse_handler_condition_expr = CParseHandlerFactory::GetParseHandler(m_mp, EdxltokenScalar, m_parse_handler_mgr, this);
 	m_parse_handler_mgr->ActivateParseHandler(parse_handler_condition_expr);
 
 	// store parse handlers
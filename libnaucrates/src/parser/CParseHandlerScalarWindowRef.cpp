@@ -71,7 +71,7 @@ CParseHandlerScalarWindowRef::StartElement
 		GPOS_ASSERT(NULL != m_dxl_node);
 
 		CParseHandlerBase *op_parse_handler =
-				CParseHandlerFactory::GetParseHandler(m_mp, CDXLTokens::XmlstrToken(EdxltokenScalar), m_parse_handler_mgr, this);
+				CParseHandlerFactory::GetParseHandler(m_mp, EdxltokenScalar, m_parse_handler_mgr, this);
 		m_parse_handler_mgr->ActivateParseHandler(op_parse_handler);
 
 		// store parse handlers
@@ -97,7 +97,7 @@ CParseHandlerSearchStage::StartElement
 		GPOS_ASSERT(NULL != m_xforms);
 
 		// start new xform
-		CParseHandlerBase *xform_set_parse_handler = CParseHandlerFactory::GetParseHandler(m_mp, CDXLTokens::XmlstrToken(EdxltokenXform), m_parse_handler_mgr, this);
+		CParseHandlerBase *xform_set_parse_handler = CParseHandlerFactory::GetParseHandler(m_mp, EdxltokenXform, m_parse_handler_mgr, this);
 		m_parse_handler_mgr->ActivateParseHandler(xform_set_parse_handler);
 
 		// store parse handler
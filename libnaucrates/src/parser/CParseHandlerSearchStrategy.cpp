@@ -79,7 +79,7 @@ CParseHandlerSearchStrategy::StartElement
 		GPOS_ASSERT(NULL != m_search_stage_array);
 
 		// start new search stage
-		CParseHandlerBase *search_stage_parse_handler = CParseHandlerFactory::GetParseHandler(m_mp, CDXLTokens::XmlstrToken(EdxltokenSearchStage), m_parse_handler_mgr, this);
+		CParseHandlerBase *search_stage_parse_handler = CParseHandlerFactory::GetParseHandler(m_mp, EdxltokenSearchStage, m_parse_handler_mgr, this);
 		m_parse_handler_mgr->ActivateParseHandler(search_stage_parse_handler);
 
 		// store parse handler
@@ -70,7 +70,7 @@ CParseHandlerSortColList::StartElement
 		GPOS_ASSERT(NULL != m_dxl_node);
 
 		// start new sort column
-		CParseHandlerBase *sort_col_parse_handler = CParseHandlerFactory::GetParseHandler(m_mp, CDXLTokens::XmlstrToken(EdxltokenScalarSortCol), m_parse_handler_mgr, this);
+		CParseHandlerBase *sort_col_parse_handler = CParseHandlerFactory::GetParseHandler(m_mp, EdxltokenScalarSortCol, m_parse_handler_mgr, this);
 		m_parse_handler_mgr->ActivateParseHandler(sort_col_parse_handler);
 		
 		// store parse handler
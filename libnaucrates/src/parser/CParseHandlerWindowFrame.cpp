@@ -65,12 +65,12 @@ CParseHandlerWindowFrame::StartElement
 
 		// parse handler for the trailing window frame edge
 		CParseHandlerBase *trailing_val_parse_handler_base =
-				CParseHandlerFactory::GetParseHandler(m_mp, CDXLTokens::XmlstrToken(EdxltokenScalarWindowFrameTrailingEdge), m_parse_handler_mgr, this);
+				CParseHandlerFactory::GetParseHandler(m_mp, EdxltokenScalarWindowFrameTrailingEdge, m_parse_handler_mgr, this);
 		m_parse_handler_mgr->ActivateParseHandler(trailing_val_parse_handler_base);
 
 		// parse handler for the leading scalar values
 		CParseHandlerBase *leading_val_parse_handler_base =
-				CParseHandlerFactory::GetParseHandler(m_mp, CDXLTokens::XmlstrToken(EdxltokenScalarWindowFrameLeadingEdge), m_parse_handler_mgr, this);
+				CParseHandlerFactory::GetParseHandler(m_mp, EdxltokenScalarWindowFrameLeadingEdge, m_parse_handler_mgr, this);
 		m_parse_handler_mgr->ActivateParseHandler(leading_val_parse_handler_base);
 
 		this->Append(leading_val_parse_handler_base);
@@ -64,7 +64,7 @@ CParseHandlerWindowKey::StartElement
 
 		// parse handler for the sorting column list
 		CParseHandlerBase *sort_col_list_parse_handler =
-				CParseHandlerFactory::GetParseHandler(m_mp, CDXLTokens::XmlstrToken(EdxltokenScalarSortColList), m_parse_handler_mgr, this);
+				CParseHandlerFactory::GetParseHandler(m_mp, EdxltokenScalarSortColList, m_parse_handler_mgr, this);
 		m_parse_handler_mgr->ActivateParseHandler(sort_col_list_parse_handler);
 
 		// store parse handler
@@ -76,7 +76,7 @@ CParseHandlerWindowKey::StartElement
 
 		// parse handler for the leading and trailing scalar values
 		CParseHandlerBase *window_frame_parse_handler_base =
-				CParseHandlerFactory::GetParseHandler(m_mp, CDXLTokens::XmlstrToken(EdxltokenWindowFrame), m_parse_handler_mgr, this);
+				CParseHandlerFactory::GetParseHandler(m_mp, EdxltokenWindowFrame, m_parse_handler_mgr, this);
 		m_parse_handler_mgr->ActivateParseHandler(window_frame_parse_handler_base);
 
 		// store parse handler
@@ -67,7 +67,7 @@ CParseHandlerWindowKeyList::StartElement
 		GPOS_ASSERT(NULL != m_dxl_window_key_array);
 		// start new window key element
 		CParseHandlerBase *window_key_parse_handler =
-				CParseHandlerFactory::GetParseHandler(m_mp, CDXLTokens::XmlstrToken(EdxltokenWindowKey), m_parse_handler_mgr, this);
+				CParseHandlerFactory::GetParseHandler(m_mp, EdxltokenWindowKey, m_parse_handler_mgr, this);
 		m_parse_handler_mgr->ActivateParseHandler(window_key_parse_handler);
 
 		// store parse handler
@@ -67,7 +67,7 @@ CParseHandlerWindowSpecList::StartElement
 		GPOS_ASSERT(NULL != m_window_spec_array);
 		// start new window specification element
 		CParseHandlerBase *window_spec_parse_handler =
-				CParseHandlerFactory::GetParseHandler(m_mp, CDXLTokens::XmlstrToken(EdxltokenWindowSpec), m_parse_handler_mgr, this);
+				CParseHandlerFactory::GetParseHandler(m_mp, EdxltokenWindowSpec, m_parse_handler_mgr, this);
 		m_parse_handler_mgr->ActivateParseHandler(window_spec_parse_handler);
 
 		// store parse handler
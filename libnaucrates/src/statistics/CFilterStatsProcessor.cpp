@@ -522,8 +522,31 @@ CFilterStatsProcessor::MakeHistHashMapDisjFilter
 
 	CDouble cumulative_rows(CStatistics::MinRows.Get());
 
-	// iterate over filters and update corresponding histograms
-	const ULONG filters = disjunctive_pred_stats->GetNumPreds();
+	if (disjunctive_pred_stats->IsArrayCmp())
+	{
+		previous_histogram = MakeHistArrayCmpFilter
+								(
+								CStatsPredArrayCmp::ConvertPredStats(disjunctive_pred_stats),
+								input_histograms,
+								input_rows,
+								&cumulative_rows
+								);
+	}
+
+	const BOOL is_array_cmp_estimated = (NULL != previous_histogram);
+	if (is_array_cmp_estimated)
+	{
+		// same bookkeeping as when processing the equality filters one by one
+		const ULONG colid = disjunctive_pred_stats->GetColId();
+		(void) filter_colids->ExchangeSet(colid);
+		scale_factors->Append(GPOS_NEW(mp) CDouble(previous_scale_factor.Get()));
+		previous_scale_factor = input_rows / std::max(CStatistics::MinRows.Get(), cumulative_rows.Get());
+		previous_colid = colid;
+	}
+
+	// iterate over filters and update corresponding histograms, unless the
+	// IN list was estimated in a single pass
+	const ULONG filters = is_array_cmp_estimated ? 0 : disjunctive_pred_stats->GetNumPreds();
 	for (ULONG ul = 0; ul < filters; ul++)
 	{
 		CStatsPred *child_pred_stats = disjunctive_pred_stats->GetPredStats(ul);
@@ -682,6 +705,50 @@ CFilterStatsProcessor::MakeHistHashMapDisjFilter
 	return disjunctive_result_histograms;
 }
 
+// create a new histogram after applying an IN list filter in a single pass
+// over the sorted constants and the histogram buckets. Returns NULL if the
+// single pass does not apply, in which case the IN list is processed as a
+// disjunction of equality filters
+CHistogram *
+CFilterStatsProcessor::MakeHistArrayCmpFilter
+	(
+	CStatsPredArrayCmp *pred_stats,
+	UlongToHistogramMap *input_histograms,
+	CDouble input_rows,
+	CDouble *num_output_rows
+	)
+{
+	GPOS_ASSERT(NULL != pred_stats);
+	GPOS_ASSERT(NULL != input_histograms);
+
+	const CPointArray *points = pred_stats->GetSortedPoints();
+	if (NULL == points || 2 > pred_stats->GetNumPreds())
+	{
+		return NULL;
+	}
+
+	const ULONG colid = pred_stats->GetColId();
+	CHistogram *histogram = input_histograms->Find(&colid);
+	GPOS_ASSERT(NULL != histogram);
+
+	// histograms without bounds and empty inputs get default estimates per
+	// equality filter
+	if (!histogram->IsWellDefined() || histogram->IsEmpty())
+	{
+		return NULL;
+	}
+
+	// the bucket bounds must be ordered consistently with the constants
+	const CBucketArray *buckets = histogram->ParseDXLToBucketsArray();
+	if (0 < points->Size() && 0 < buckets->Size() &&
+		!(*buckets)[0]->GetLowerBound()->GetDatum()->StatsAreComparable((*points)[0]->GetDatum()))
+	{
+		return NULL;
+	}
+
+	return histogram->MakeUnionHistogramEqualityFilters(points, pred_stats->HasNullPoint(), input_rows, num_output_rows);
+}
+
 //	create a new histograms after applying the filter that is not
 //	an AND/OR predicate
 CHistogram *
@@ -560,6 +560,32 @@ CHistogram::GetNumDistinct
 	return distinct + distinct_null + m_distinct_remaining;
 }
 
+// frequency of the most frequent value, assuming values are uniformly
+// distributed within each bucket; most common values are kept in singleton
+// buckets, and nulls count as a single value
+CDouble
+CHistogram::GetMaxValueFreq
+	()
+	const
+{
+	CDouble max_freq(m_null_freq);
+	const ULONG num_of_buckets = m_histogram_buckets->Size();
+	for (ULONG bucket_index = 0; bucket_index < num_of_buckets; bucket_index++)
+	{
+		CBucket *bucket = (*m_histogram_buckets)[bucket_index];
+		CDouble distinct = std::max(bucket->GetNumDistinct().Get(), 1.0);
+		max_freq = std::max(max_freq, bucket->GetFrequency() / distinct);
+	}
+
+	if (CStatistics::Epsilon < m_freq_remaining)
+	{
+		CDouble distinct_remaining = std::max(m_distinct_remaining.Get(), 1.0);
+		max_freq = std::max(max_freq, m_freq_remaining / distinct_remaining);
+	}
+
+	return max_freq;
+}
+
 // cap the total number of distinct values (NDVs) in buckets to the number of rows
 // creates new histogram of buckets, as this modifies individual buckets in the array
 void
@@ -1788,6 +1814,99 @@ CHistogram::MakeUnionHistogramNormalize
 	return result_histogram;
 }
 
+// construct the histogram resulting from filtering with the equality
+// predicates col = p for each of the given points, normalizing each filtered
+// histogram and unioning them one after the other. Instead of materializing
+// the intermediate unions, the points are matched against the buckets in a
+// single merge pass, as both are sorted. The result and the number of output
+// rows equal those of the pairwise unions for two or more predicates, where
+// each filtered histogram contributes rows * frequency rows per bucket, and
+// nulls and remaining NDVs are accounted for once.
+CHistogram *
+CHistogram::MakeUnionHistogramEqualityFilters
+	(
+	const CPointArray *points,
+	BOOL has_null_point,
+	CDouble rows,
+	CDouble *num_output_rows
+	)
+	const
+{
+	GPOS_ASSERT(NULL != points);
+	GPOS_ASSERT(IsWellDefined());
+	GPOS_ASSERT(!IsEmpty());
+
+	CBucketArray *histogram_buckets = GPOS_NEW(m_mp) CBucketArray(m_mp);
+	CDoubleArray *num_tuples_per_bucket = GPOS_NEW(m_mp) CDoubleArray(m_mp);
+	BOOL has_unmatched_point = false;
+
+	const ULONG num_buckets = m_histogram_buckets->Size();
+	const ULONG num_points = points->Size();
+	ULONG bucket_index = 0;
+	for (ULONG point_index = 0; point_index < num_points; point_index++)
+	{
+		CPoint *point = (*points)[point_index];
+
+		// skip buckets entirely below the point
+		while (bucket_index < num_buckets && (*m_histogram_buckets)[bucket_index]->IsAfter(point))
+		{
+			bucket_index++;
+		}
+
+		if (bucket_index == num_buckets || !(*m_histogram_buckets)[bucket_index]->Contains(point))
+		{
+			has_unmatched_point = true;
+			continue;
+		}
+
+		CBucket *bucket = (*m_histogram_buckets)[bucket_index];
+		CBucket *singleton_bucket = NULL;
+		if (bucket->IsSingleton())
+		{
+			singleton_bucket = bucket->MakeBucketCopy(m_mp);
+		}
+		else
+		{
+			singleton_bucket = bucket->MakeBucketSingleton(m_mp, point);
+		}
+
+		histogram_buckets->Append(singleton_bucket);
+		num_tuples_per_bucket->Append(GPOS_NEW(m_mp) CDouble(singleton_bucket->GetFrequency() * rows));
+	}
+
+	// a null constant selects the null fraction
+	CDouble num_null_rows(0.0);
+	if (has_null_point && CStatistics::Epsilon < m_null_freq)
+	{
+		num_null_rows = m_null_freq * rows;
+	}
+
+	// constants not found in the buckets select one of the remaining NDVs
+	CDouble num_NDV_remain(0.0);
+	CDouble NDV_remain_num_rows(0.0);
+	if (has_unmatched_point && CStatistics::Epsilon < m_distinct_remaining)
+	{
+		num_NDV_remain = CDouble(1.0);
+		NDV_remain_num_rows = std::min(CDouble(1.0), m_freq_remaining / m_distinct_remaining) * rows;
+	}
+
+	CHistogram *result_histogram = MakeHistogramUpdateFreq
+									(
+									histogram_buckets,
+									num_tuples_per_bucket,
+									num_output_rows,
+									num_null_rows,
+									num_NDV_remain,
+									NDV_remain_num_rows
+									);
+
+	// clean up
+	histogram_buckets->Release();
+	num_tuples_per_bucket->Release();
+
+	return result_histogram;
+}
+
 // create a new histogram with updated bucket frequency
 CHistogram *
 CHistogram::MakeHistogramUpdateFreq
@@ -32,6 +32,8 @@ CPoint::CPoint
 	m_datum(datum)
 {
 	GPOS_ASSERT(NULL != m_datum);
+
+	m_stats_datum.Init(m_datum);
 }
 
 //---------------------------------------------------------------------------
@@ -50,6 +52,13 @@ CPoint::Equals
 	const
 {
 	GPOS_ASSERT(NULL != point);
+
+	if (m_stats_datum.IsMappingComparable(point->m_stats_datum))
+	{
+		return m_stats_datum.StatsAreEqual(point->m_stats_datum);
+	}
+
+	// datums without a stats mapping, e.g. generic datums compared byte-wise
 	return m_datum->StatsAreEqual(point->m_datum);
 }
 
@@ -87,7 +96,8 @@ CPoint::IsLessThan
 	const
 {
 	GPOS_ASSERT(NULL != point);
-	return m_datum->StatsAreComparable(point->m_datum) && m_datum->StatsAreLessThan(point->m_datum);
+	return m_stats_datum.StatsAreComparable(point->m_stats_datum) &&
+			m_stats_datum.StatsAreLessThan(point->m_stats_datum);
 }
 
 //---------------------------------------------------------------------------
@@ -123,7 +133,9 @@ CPoint::IsGreaterThan
 	)
 	const
 {
-	return m_datum->StatsAreComparable(point->m_datum) && m_datum->StatsAreGreaterThan(point->m_datum);
+	GPOS_ASSERT(NULL != point);
+	return m_stats_datum.StatsAreComparable(point->m_stats_datum) &&
+			point->m_stats_datum.StatsAreLessThan(m_stats_datum);
 }
 
 //---------------------------------------------------------------------------
@@ -160,9 +172,9 @@ CPoint::Distance
 	const
 {
 	GPOS_ASSERT(NULL != point);
-	if (m_datum->StatsAreComparable(point->m_datum))
+	if (m_stats_datum.StatsAreComparable(point->m_stats_datum))
 	{
-		return CDouble(m_datum->GetStatsDistanceFrom(point->m_datum));
+		return m_stats_datum.GetStatsDistanceFrom(point->m_stats_datum);
 	}
 
 	// default to a non zero constant for overlap
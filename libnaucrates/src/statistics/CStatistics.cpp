@@ -20,6 +20,7 @@
 #include "naucrates/statistics/CLeftAntiSemiJoinStatsProcessor.h"
 #include "naucrates/statistics/CInnerJoinStatsProcessor.h"
 #include "gpos/common/CBitSet.h"
+#include "gpos/common/CBitSetIter.h"
 #include "gpos/memory/CAutoMemoryPool.h"
 
 #include "gpopt/base/CColumnFactory.h"
@@ -56,6 +57,10 @@ const CDouble CStatistics::DefaultDistinctValues(1000.0);
 // the default value for operators that have no cardinality estimation risk
 const ULONG CStatistics::no_card_est_risk_default_val = 1;
 
+// widths array entries per column of the width map beyond which widths are
+// looked up in the map
+const ULONG CStatistics::width_array_max_spread = 8;
+
 // ctor
 CStatistics::CStatistics
 	(
@@ -69,6 +74,11 @@ CStatistics::CStatistics
 	:
 	m_colid_histogram_mapping(col_histogram_mapping),
 	m_colid_width_mapping(colid_width_mapping),
+	m_mp(mp),
+	m_width_array(NULL),
+	m_width_array_base(0),
+	m_width_array_size(0),
+	m_width_array_built(false),
 	m_rows(rows),
 	m_stats_estimation_risk(no_card_est_risk_default_val),
 	m_empty(is_empty),
@@ -92,6 +102,7 @@ CStatistics::~CStatistics()
 	m_colid_histogram_mapping->Release();
 	m_colid_width_mapping->Release();
 	m_src_upper_bound_NDVs->Release();
+	GPOS_DELETE_ARRAY(m_width_array);
 }
 
 // look up the width of a particular column
@@ -204,6 +215,110 @@ CStatistics::Width() const
 	return total_width.Ceil();
 }
 
+// build the widths array from the width map; column ids of a stats object
+// are mostly close to each other, so a dense array indexed by column id
+// replaces a hash lookup per column when costing
+void
+CStatistics::BuildWidthArray() const
+{
+	GPOS_ASSERT(!m_width_array_built);
+	GPOS_ASSERT(NULL == m_width_array);
+
+	m_width_array_built = true;
+
+	const ULONG num_widths = m_colid_width_mapping->Size();
+	if (0 == num_widths)
+	{
+		return;
+	}
+
+	ULONG min_colid = gpos::ulong_max;
+	ULONG max_colid = 0;
+	UlongToDoubleMapIter col_width_map_iterator(m_colid_width_mapping);
+	while (col_width_map_iterator.Advance())
+	{
+		ULONG colid = *(col_width_map_iterator.Key());
+		min_colid = std::min(min_colid, colid);
+		max_colid = std::max(max_colid, colid);
+	}
+
+	const ULONG size = max_colid - min_colid + 1;
+	if (size > num_widths * width_array_max_spread)
+	{
+		// too sparse, keep using the width map
+		return;
+	}
+
+	DOUBLE *width_array = GPOS_NEW_ARRAY(m_mp, DOUBLE, size);
+	for (ULONG ul = 0; ul < size; ul++)
+	{
+		width_array[ul] = -1.0;
+	}
+
+	UlongToDoubleMapIter col_width_map_iterator_fill(m_colid_width_mapping);
+	while (col_width_map_iterator_fill.Advance())
+	{
+		ULONG colid = *(col_width_map_iterator_fill.Key());
+		width_array[colid - min_colid] = col_width_map_iterator_fill.Value()->Get();
+	}
+
+	m_width_array = width_array;
+	m_width_array_base = min_colid;
+	m_width_array_size = size;
+}
+
+// drop the widths array after the width map changed
+void
+CStatistics::ResetWidthArray()
+{
+	GPOS_DELETE_ARRAY(m_width_array);
+	m_width_array = NULL;
+	m_width_array_base = 0;
+	m_width_array_size = 0;
+	m_width_array_built = false;
+}
+
+// width of the given column, falling back to the default width of its
+// type for columns without width information
+DOUBLE
+CStatistics::ColumnWidth
+	(
+	ULONG colid
+	)
+	const
+{
+	GPOS_ASSERT(m_width_array_built);
+
+	DOUBLE width = -1.0;
+	if (NULL != m_width_array)
+	{
+		// column ids below the base wrap around to large positions
+		ULONG pos = colid - m_width_array_base;
+		if (pos < m_width_array_size)
+		{
+			width = m_width_array[pos];
+		}
+	}
+	else
+	{
+		CDouble *width_from_map = m_colid_width_mapping->Find(&colid);
+		if (NULL != width_from_map)
+		{
+			width = width_from_map->Get();
+		}
+	}
+
+	if (0.0 > width)
+	{
+		CColRef *colref = COptCtxt::PoctxtFromTLS()->Pcf()->LookupColRef(colid);
+		GPOS_ASSERT(NULL != colref);
+
+		width = CStatisticsUtils::DefaultColumnWidth(colref->RetrieveType()).Get();
+	}
+
+	return width;
+}
+
 // return the width in bytes of a set of columns
 CDouble
 CStatistics::Width
@@ -214,46 +329,44 @@ CStatistics::Width
 {
 	GPOS_ASSERT(NULL != colids);
 
-	CColumnFactory *col_factory = COptCtxt::PoctxtFromTLS()->Pcf();
-	CDouble total_width(0.0);
+	if (!m_width_array_built)
+	{
+		BuildWidthArray();
+	}
+
+	DOUBLE total_width = 0.0;
 	const ULONG size = colids->Size();
 	for (ULONG idx = 0; idx < size; idx++)
 	{
-		ULONG colid = *((*colids)[idx]);
-		CDouble *width = m_colid_width_mapping->Find(&colid);
-		if (NULL != width)
-		{
-			total_width = total_width + (*width);
-		}
-		else
-		{
-			CColRef *colref = col_factory->LookupColRef(colid);
-			GPOS_ASSERT(NULL != colref);
-
-			total_width = total_width + CStatisticsUtils::DefaultColumnWidth(colref->RetrieveType());
-		}
+		total_width += ColumnWidth(*((*colids)[idx]));
 	}
-	return total_width.Ceil();
+	return CDouble(total_width).Ceil();
 }
 
-// return width in bytes of a set of columns
+// return width in bytes of a set of columns; column ids are read off the
+// bits of the set, without extracting them into an array
 CDouble
 CStatistics::Width
 	(
-	CMemoryPool *mp,
+	CMemoryPool *, // mp
 	CColRefSet *colrefs
 	)
 	const
 {
 	GPOS_ASSERT(NULL != colrefs);
 
-	ULongPtrArray *colids = GPOS_NEW(mp) ULongPtrArray(mp);
-	colrefs->ExtractColIds(mp, colids);
-
-	CDouble width = Width(colids);
-	colids->Release();
+	if (!m_width_array_built)
+	{
+		BuildWidthArray();
+	}
 
-	return width;
+	DOUBLE total_width = 0.0;
+	CBitSetIter bsi(*colrefs);
+	while (bsi.Advance())
+	{
+		total_width += ColumnWidth(bsi.Bit());
+	}
+	return CDouble(total_width).Ceil();
 }
 
 // return dummy statistics object
@@ -581,6 +694,7 @@ CStatistics::AppendStats
 	GPOS_CHECK_ABORT;
 
 	CStatisticsUtils::AddWidthInfo(mp, stats->m_colid_width_mapping, m_colid_width_mapping);
+	ResetWidthArray();
 	GPOS_CHECK_ABORT;
 }
 
@@ -1653,6 +1653,52 @@ CStatisticsUtils::Groups
 }
 
 
+//---------------------------------------------------------------------------
+//	@function:
+//		CStatisticsUtils::MaxValueFreq
+//
+//	@doc:
+//		Frequency of the most frequent combination of values of the given
+//		columns; columns are assumed to be independent, as for the number
+//		of groups. Return zero if any column lacks a well-defined histogram,
+//		since the skew of such columns is unknown
+//
+//---------------------------------------------------------------------------
+CDouble
+CStatisticsUtils::MaxValueFreq
+	(
+	IStatistics *stats,
+	ULongPtrArray *colids
+	)
+{
+	GPOS_ASSERT(NULL != stats);
+	GPOS_ASSERT(NULL != colids);
+
+	const CStatistics *input_stats = CStatistics::CastStats(stats);
+
+	const ULONG size = colids->Size();
+	if (0 == size)
+	{
+		return CDouble(0.0);
+	}
+
+	CDouble max_freq(1.0);
+	for (ULONG ul = 0; ul < size; ul++)
+	{
+		ULONG colid = *(*colids)[ul];
+		const CHistogram *histogram = input_stats->GetHistogram(colid);
+		if (NULL == histogram || !histogram->IsWellDefined() || histogram->IsColStatsMissing())
+		{
+			return CDouble(0.0);
+		}
+
+		max_freq = max_freq * histogram->GetMaxValueFreq();
+	}
+
+	return max_freq;
+}
+
+
 //---------------------------------------------------------------------------
 //	@function:
 //		CStatisticsUtils::GetCumulativeNDVs
@@ -0,0 +1,187 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (C) 2020 VMware, Inc. or its affiliates.
+//
+//	@filename:
+//		CStatsDatum.cpp
+//
+//	@doc:
+//		Implementation of compact datum representation for statistics
+//---------------------------------------------------------------------------
+
+#include "gpos/base.h"
+
+#include "naucrates/statistics/CStatsDatum.h"
+#include "naucrates/md/CMDTypeGenericGPDB.h"
+
+using namespace gpnaucrates;
+using namespace gpmd;
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CStatsDatum::Init
+//
+//	@doc:
+//		Take a snapshot of the statistics view of the given datum
+//
+//---------------------------------------------------------------------------
+void
+CStatsDatum::Init
+	(
+	const IDatum *datum
+	)
+{
+	GPOS_ASSERT(NULL != datum);
+
+	m_mdid_type = datum->MDId();
+	m_is_null = datum->IsNull();
+	m_is_lint_mappable = datum->IsDatumMappableToLINT();
+	m_is_double_mappable = datum->IsDatumMappableToDouble();
+	m_is_time_related = CMDTypeGenericGPDB::IsTimeRelatedType(m_mdid_type);
+	m_lint_value = 0;
+	m_double_value = 0.0;
+
+	if (m_is_null)
+	{
+		return;
+	}
+
+	if (m_is_lint_mappable)
+	{
+		m_lint_value = datum->GetLINTMapping();
+	}
+
+	if (m_is_double_mappable)
+	{
+		m_double_value = datum->GetDoubleMapping().Get();
+	}
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CStatsDatum::TypesMatch
+//
+//	@doc:
+//		Do the two datums share the same type
+//
+//---------------------------------------------------------------------------
+BOOL
+CStatsDatum::TypesMatch
+	(
+	const CStatsDatum &stats_datum
+	)
+	const
+{
+	return m_mdid_type == stats_datum.m_mdid_type ||
+			m_mdid_type->Equals(stats_datum.m_mdid_type);
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CStatsDatum::StatsAreEqual
+//
+//	@doc:
+//		Equality based on mapping to LINT or CDouble
+//
+//---------------------------------------------------------------------------
+BOOL
+CStatsDatum::StatsAreEqual
+	(
+	const CStatsDatum &stats_datum
+	)
+	const
+{
+	GPOS_ASSERT(IsMappingComparable(stats_datum));
+
+	if (m_is_null)
+	{
+		// nulls are equal from stats point of view
+		return stats_datum.m_is_null;
+	}
+
+	if (stats_datum.m_is_null)
+	{
+		return false;
+	}
+
+	if (IsLintComparable(stats_datum))
+	{
+		return m_lint_value == stats_datum.m_lint_value;
+	}
+
+	return CDouble(m_double_value) == CDouble(stats_datum.m_double_value);
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CStatsDatum::StatsAreLessThan
+//
+//	@doc:
+//		Less-than based on mapping to LINT or CDouble
+//
+//---------------------------------------------------------------------------
+BOOL
+CStatsDatum::StatsAreLessThan
+	(
+	const CStatsDatum &stats_datum
+	)
+	const
+{
+	GPOS_ASSERT(IsMappingComparable(stats_datum));
+
+	if (m_is_null)
+	{
+		// nulls are less than everything else except nulls
+		return !stats_datum.m_is_null;
+	}
+
+	if (stats_datum.m_is_null)
+	{
+		return false;
+	}
+
+	if (IsLintComparable(stats_datum))
+	{
+		return m_lint_value < stats_datum.m_lint_value;
+	}
+
+	return CDouble(m_double_value) < CDouble(stats_datum.m_double_value);
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CStatsDatum::GetStatsDistanceFrom
+//
+//	@doc:
+//		Distance function based on mapping to LINT or CDouble; nulls are
+//		handled as in IDatum::GetStatsDistanceFrom
+//
+//---------------------------------------------------------------------------
+CDouble
+CStatsDatum::GetStatsDistanceFrom
+	(
+	const CStatsDatum &stats_datum
+	)
+	const
+{
+	GPOS_ASSERT(IsMappingComparable(stats_datum));
+
+	if (m_is_null)
+	{
+		return CDouble(stats_datum.m_is_null ? 1.0 : 0.0);
+	}
+
+	if (stats_datum.m_is_null)
+	{
+		return CDouble(0.0);
+	}
+
+	if (IsLintComparable(stats_datum))
+	{
+		return CDouble(m_lint_value - stats_datum.m_lint_value);
+	}
+
+	return CDouble(m_double_value) - CDouble(stats_datum.m_double_value);
+}
+
+// EOF
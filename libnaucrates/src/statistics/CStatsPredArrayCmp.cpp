@@ -0,0 +1,131 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (C) 2020 VMware, Inc. or its affiliates.
+//
+//	@filename:
+//		CStatsPredArrayCmp.cpp
+//
+//	@doc:
+//		Implementation of statistics IN list filter
+//---------------------------------------------------------------------------
+
+#include "naucrates/statistics/CStatsPredArrayCmp.h"
+#include "naucrates/statistics/CStatsPredPoint.h"
+
+using namespace gpnaucrates;
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CStatsPredArrayCmp::CStatsPredArrayCmp
+//
+//	@doc:
+//		Ctor; the given filters must be equality filters on the same column
+//
+//---------------------------------------------------------------------------
+CStatsPredArrayCmp::CStatsPredArrayCmp
+	(
+	CMemoryPool *mp,
+	CStatsPredPtrArry *disj_pred_stats_array
+	)
+	:
+	CStatsPredDisj(disj_pred_stats_array),
+	m_points(NULL),
+	m_has_null_point(false)
+{
+	GPOS_ASSERT(gpos::ulong_max != GetColId());
+
+	CPointArray *points = GPOS_NEW(mp) CPointArray(mp);
+	BOOL is_sortable = true;
+
+	const ULONG num_preds = disj_pred_stats_array->Size();
+	for (ULONG ul = 0; is_sortable && ul < num_preds; ul++)
+	{
+		CStatsPredPoint *pred_stats = CStatsPredPoint::ConvertPredStats((*disj_pred_stats_array)[ul]);
+		GPOS_ASSERT(CStatsPred::EstatscmptEq == pred_stats->GetCmpType());
+
+		CPoint *point = pred_stats->GetPredPoint();
+		if (point->GetDatum()->IsNull())
+		{
+			m_has_null_point = true;
+			continue;
+		}
+
+		// the constants must be ordered consistently among each other
+		is_sortable = 0 == points->Size() ||
+				point->GetDatum()->StatsAreComparable((*points)[0]->GetDatum());
+
+		point->AddRef();
+		points->Append(point);
+	}
+
+	if (!is_sortable)
+	{
+		points->Release();
+		return;
+	}
+
+	points->Sort(PointSortCmpFunc);
+
+	// remove duplicate constants
+	m_points = GPOS_NEW(mp) CPointArray(mp);
+	const ULONG num_points = points->Size();
+	for (ULONG ul = 0; ul < num_points; ul++)
+	{
+		CPoint *point = (*points)[ul];
+		if (0 < ul && point->Equals((*points)[ul - 1]))
+		{
+			continue;
+		}
+
+		point->AddRef();
+		m_points->Append(point);
+	}
+
+	points->Release();
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CStatsPredArrayCmp::~CStatsPredArrayCmp
+//
+//	@doc:
+//		Dtor
+//
+//---------------------------------------------------------------------------
+CStatsPredArrayCmp::~CStatsPredArrayCmp()
+{
+	CRefCount::SafeRelease(m_points);
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CStatsPredArrayCmp::PointSortCmpFunc
+//
+//	@doc:
+//		Comparison function for sorting points in ascending order
+//
+//---------------------------------------------------------------------------
+INT
+CStatsPredArrayCmp::PointSortCmpFunc
+	(
+	const void *val1,
+	const void *val2
+	)
+{
+	const CPoint *point1 = *(const CPoint **) val1;
+	const CPoint *point2 = *(const CPoint **) val2;
+
+	if (point1->IsLessThan(point2))
+	{
+		return -1;
+	}
+
+	if (point2->IsLessThan(point1))
+	{
+		return 1;
+	}
+
+	return 0;
+}
+
+// EOF
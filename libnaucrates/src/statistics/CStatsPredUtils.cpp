@@ -29,6 +29,7 @@
 #include "naucrates/md/IMDType.h"
 #include "naucrates/statistics/CStatistics.h"
 #include "naucrates/statistics/CStatsPredDisj.h"
+#include "naucrates/statistics/CStatsPredArrayCmp.h"
 #include "naucrates/statistics/CStatsPredConj.h"
 
 using namespace gpopt;
@@ -1007,6 +1008,8 @@ CStatsPredUtils::ProcessArrayCmp
 		pred_stats_child_array = GPOS_NEW(mp) CStatsPredPtrArry(mp);
 	}
 
+	// are all constants supported point filters
+	BOOL is_point_list = true;
 	for (ULONG ul = 0; ul < constants; ul++)
 	{
 		CExpression *expr_const = CUtils::PScalarArrayExprChildAt(mp, expr_scalar_array, ul);
@@ -1019,6 +1022,7 @@ CStatsPredUtils::ProcessArrayCmp
 			{
 				// stats calculations on such datums unsupported
 				child_pred_stats = GPOS_NEW(mp) CStatsPredUnsupported(col_ref->Id(), stats_cmp_type);
+				is_point_list = false;
 			}
 			else
 			{
@@ -1027,12 +1031,25 @@ CStatsPredUtils::ProcessArrayCmp
 
 			pred_stats_child_array->Append(child_pred_stats);
 		}
+		else
+		{
+			is_point_list = false;
+		}
 		expr_const->Release();
 	}
 
 	if (is_array_cmp_any)
 	{
-		CStatsPredDisj *pstatspredOr = GPOS_NEW(mp) CStatsPredDisj(pred_stats_child_array);
+		CStatsPredDisj *pstatspredOr = NULL;
+		if (is_point_list && CStatsPred::EstatscmptEq == stats_cmp_type && 1 < pred_stats_child_array->Size())
+		{
+			// IN list, keep the constants sorted for estimating the filter in a single pass
+			pstatspredOr = GPOS_NEW(mp) CStatsPredArrayCmp(mp, pred_stats_child_array);
+		}
+		else
+		{
+			pstatspredOr = GPOS_NEW(mp) CStatsPredDisj(pred_stats_child_array);
+		}
 		pred_stats_array->Append(pstatspredOr);
 	}
 }
@@ -0,0 +1,1196 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (C) 2020 VMware, Inc. or its affiliates.
+//
+//	@filename:
+//		CDXLStreamParser.cpp
+//
+//	@doc:
+//		Implementation of the streaming parser for trusted DXL documents
+//---------------------------------------------------------------------------
+
+#include "gpos/base.h"
+
+#include "naucrates/exception.h"
+#include "naucrates/dxl/xml/CDXLStreamParser.h"
+#include "naucrates/dxl/parser/CParseHandlerBase.h"
+#include "naucrates/dxl/parser/CParseHandlerManager.h"
+
+using namespace gpdxl;
+
+// initial number of characters in the transcoding buffer
+#define GPDXL_STREAM_PARSER_BUFFER_SIZE	1024
+
+// initial number of attributes per element
+#define GPDXL_STREAM_PARSER_ATTRS	16
+
+// initial depth of the open element stack
+#define GPDXL_STREAM_PARSER_DEPTH	64
+
+// empty string reported as namespace URI and attribute type
+static const XMLCh xmlszEmpty[] = {0};
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLStreamParser::CDXLStreamParser
+//
+//	@doc:
+//		Ctor
+//
+//---------------------------------------------------------------------------
+CDXLStreamParser::CDXLStreamParser
+	(
+	CMemoryPool *mp,
+	CParseHandlerManager *parse_handler_mgr
+	)
+	:
+	m_mp(mp),
+	m_parse_handler_mgr(parse_handler_mgr),
+	m_szCurrent(NULL),
+	m_szEnd(NULL),
+	m_xmlszBuffer(NULL),
+	m_ulBufferCapacity(GPDXL_STREAM_PARSER_BUFFER_SIZE),
+	m_ulBufferUsed(0),
+	m_rgattr(NULL),
+	m_ulAttrCapacity(GPDXL_STREAM_PARSER_ATTRS),
+	m_rgszOpenElements(NULL),
+	m_rgulOpenElementLengths(NULL),
+	m_ulOpenElementCapacity(GPDXL_STREAM_PARSER_DEPTH),
+	m_ulOpenElements(0)
+{
+	GPOS_ASSERT(NULL != mp);
+	GPOS_ASSERT(NULL != parse_handler_mgr);
+
+	m_xmlszBuffer = GPOS_NEW_ARRAY(m_mp, XMLCh, m_ulBufferCapacity);
+	m_rgattr = GPOS_NEW_ARRAY(m_mp, SAttribute, m_ulAttrCapacity);
+	m_rgszOpenElements = GPOS_NEW_ARRAY(m_mp, const CHAR *, m_ulOpenElementCapacity);
+	m_rgulOpenElementLengths = GPOS_NEW_ARRAY(m_mp, ULONG, m_ulOpenElementCapacity);
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLStreamParser::~CDXLStreamParser
+//
+//	@doc:
+//		Dtor
+//
+//---------------------------------------------------------------------------
+CDXLStreamParser::~CDXLStreamParser()
+{
+	GPOS_DELETE_ARRAY(m_xmlszBuffer);
+	GPOS_DELETE_ARRAY(m_rgattr);
+	GPOS_DELETE_ARRAY(m_rgszOpenElements);
+	GPOS_DELETE_ARRAY(m_rgulOpenElementLengths);
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLStreamParser::RaiseParseError
+//
+//	@doc:
+//		Report malformed input the same way parse errors reported by Xerces
+//		are surfaced
+//
+//---------------------------------------------------------------------------
+void
+CDXLStreamParser::RaiseParseError()
+{
+	GPOS_RAISE(gpdxl::ExmaDXL, gpdxl::ExmiDXLXercesParseError);
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLStreamParser::PphCurrent
+//
+//	@doc:
+//		Handler receiving the next event
+//
+//---------------------------------------------------------------------------
+CParseHandlerBase *
+CDXLStreamParser::PphCurrent() const
+{
+	return m_parse_handler_mgr->m_curr_parse_handler;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLStreamParser::FStartsWith
+//
+//	@doc:
+//		Check if the remaining input starts with the given literal
+//
+//---------------------------------------------------------------------------
+BOOL
+CDXLStreamParser::FStartsWith
+	(
+	const CHAR *szLiteral,
+	ULONG length
+	)
+	const
+{
+	return (ULONG) (m_szEnd - m_szCurrent) >= length &&
+			0 == clib::Memcmp(m_szCurrent, szLiteral, length);
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLStreamParser::SkipWhitespace
+//
+//	@doc:
+//		Skip whitespace
+//
+//---------------------------------------------------------------------------
+void
+CDXLStreamParser::SkipWhitespace()
+{
+	while (m_szCurrent < m_szEnd && FWhitespace(*m_szCurrent))
+	{
+		m_szCurrent++;
+	}
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLStreamParser::SkipPast
+//
+//	@doc:
+//		Skip input up to and including the given terminator
+//
+//---------------------------------------------------------------------------
+void
+CDXLStreamParser::SkipPast
+	(
+	const CHAR *szTerminator,
+	ULONG length
+	)
+{
+	while (!FStartsWith(szTerminator, length))
+	{
+		if (m_szCurrent == m_szEnd)
+		{
+			RaiseParseError();
+		}
+		m_szCurrent++;
+	}
+
+	m_szCurrent += length;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLStreamParser::UlScanName
+//
+//	@doc:
+//		Scan a name starting at the current position
+//
+//---------------------------------------------------------------------------
+ULONG
+CDXLStreamParser::UlScanName()
+{
+	const CHAR *szStart = m_szCurrent;
+	while (m_szCurrent < m_szEnd &&
+			!FWhitespace(*m_szCurrent) &&
+			'/' != *m_szCurrent &&
+			'>' != *m_szCurrent &&
+			'=' != *m_szCurrent)
+	{
+		m_szCurrent++;
+	}
+
+	if (szStart == m_szCurrent)
+	{
+		RaiseParseError();
+	}
+
+	return (ULONG) (m_szCurrent - szStart);
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLStreamParser::EnsureBufferCapacity
+//
+//	@doc:
+//		Make room for the given number of characters in the buffer. Growing
+//		the buffer invalidates pointers into it, which is why names and values
+//		are recorded by their offsets until an element is complete
+//
+//---------------------------------------------------------------------------
+void
+CDXLStreamParser::EnsureBufferCapacity
+	(
+	ULONG ulChars
+	)
+{
+	if (m_ulBufferUsed + ulChars <= m_ulBufferCapacity)
+	{
+		return;
+	}
+
+	ULONG ulCapacity = 2 * m_ulBufferCapacity;
+	while (ulCapacity < m_ulBufferUsed + ulChars)
+	{
+		ulCapacity *= 2;
+	}
+
+	XMLCh *xmlszBuffer = GPOS_NEW_ARRAY(m_mp, XMLCh, ulCapacity);
+	clib::Memcpy(xmlszBuffer, m_xmlszBuffer, m_ulBufferUsed * sizeof(XMLCh));
+	GPOS_DELETE_ARRAY(m_xmlszBuffer);
+
+	m_xmlszBuffer = xmlszBuffer;
+	m_ulBufferCapacity = ulCapacity;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLStreamParser::EnsureAttrCapacity
+//
+//	@doc:
+//		Make room for the given number of attributes
+//
+//---------------------------------------------------------------------------
+void
+CDXLStreamParser::EnsureAttrCapacity
+	(
+	ULONG ulAttrs
+	)
+{
+	if (ulAttrs <= m_ulAttrCapacity)
+	{
+		return;
+	}
+
+	ULONG ulCapacity = 2 * m_ulAttrCapacity;
+	SAttribute *rgattr = GPOS_NEW_ARRAY(m_mp, SAttribute, ulCapacity);
+	clib::Memcpy(rgattr, m_rgattr, m_ulAttrCapacity * sizeof(SAttribute));
+	GPOS_DELETE_ARRAY(m_rgattr);
+
+	m_rgattr = rgattr;
+	m_ulAttrCapacity = ulCapacity;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLStreamParser::UlDecodeUtf8
+//
+//	@doc:
+//		Decode the UTF-8 encoded code point at the given position and advance
+//		the position past it
+//
+//---------------------------------------------------------------------------
+ULONG
+CDXLStreamParser::UlDecodeUtf8
+	(
+	const CHAR **psz,
+	const CHAR *szEnd
+	)
+{
+	const BYTE *pb = (const BYTE *) *psz;
+	ULONG ulCodePoint = pb[0];
+	ULONG ulTrailing = 0;
+
+	if (0x80 > ulCodePoint)
+	{
+		ulTrailing = 0;
+	}
+	else if (0xC0 == (ulCodePoint & 0xE0))
+	{
+		ulCodePoint &= 0x1F;
+		ulTrailing = 1;
+	}
+	else if (0xE0 == (ulCodePoint & 0xF0))
+	{
+		ulCodePoint &= 0x0F;
+		ulTrailing = 2;
+	}
+	else if (0xF0 == (ulCodePoint & 0xF8))
+	{
+		ulCodePoint &= 0x07;
+		ulTrailing = 3;
+	}
+	else
+	{
+		RaiseParseError();
+	}
+
+	if ((const BYTE *) szEnd - pb <= (LINT) ulTrailing)
+	{
+		RaiseParseError();
+	}
+
+	for (ULONG ul = 1; ul <= ulTrailing; ul++)
+	{
+		if (0x80 != (pb[ul] & 0xC0))
+		{
+			RaiseParseError();
+		}
+		ulCodePoint = (ulCodePoint << 6) | (pb[ul] & 0x3F);
+	}
+
+	*psz += 1 + ulTrailing;
+
+	return ulCodePoint;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLStreamParser::UlDecodeReference
+//
+//	@doc:
+//		Decode the predefined entity or character reference following an
+//		ampersand at the given position and advance the position past the
+//		terminating semicolon
+//
+//---------------------------------------------------------------------------
+ULONG
+CDXLStreamParser::UlDecodeReference
+	(
+	const CHAR **psz,
+	const CHAR *szEnd
+	)
+{
+	const CHAR *szStart = *psz;
+	const CHAR *szSemicolon = szStart;
+	while (szSemicolon < szEnd && ';' != *szSemicolon)
+	{
+		szSemicolon++;
+	}
+
+	if (szSemicolon == szEnd || szSemicolon == szStart)
+	{
+		RaiseParseError();
+	}
+
+	const ULONG length = (ULONG) (szSemicolon - szStart);
+	*psz = szSemicolon + 1;
+
+	if ('#' != szStart[0])
+	{
+		const struct
+		{
+			const CHAR *m_sz;
+			ULONG m_ulCodePoint;
+		}
+		rgentity[] =
+		{
+			{"lt", '<'},
+			{"gt", '>'},
+			{"amp", '&'},
+			{"quot", '"'},
+			{"apos", '\''},
+		};
+
+		for (ULONG ul = 0; ul < GPOS_ARRAY_SIZE(rgentity); ul++)
+		{
+			if (length == clib::Strlen(rgentity[ul].m_sz) &&
+				0 == clib::Memcmp(szStart, rgentity[ul].m_sz, length))
+			{
+				return rgentity[ul].m_ulCodePoint;
+			}
+		}
+
+		RaiseParseError();
+	}
+
+	// character reference in decimal or hexadecimal notation
+	const BOOL fHex = (1 < length && 'x' == szStart[1]);
+	ULONG ulPos = fHex ? 2 : 1;
+	if (ulPos == length)
+	{
+		RaiseParseError();
+	}
+
+	ULONG ulCodePoint = 0;
+	for (; ulPos < length; ulPos++)
+	{
+		CHAR c = szStart[ulPos];
+		ULONG ulDigit = 0;
+		if ('0' <= c && '9' >= c)
+		{
+			ulDigit = c - '0';
+		}
+		else if (fHex && 'a' <= c && 'f' >= c)
+		{
+			ulDigit = 10 + c - 'a';
+		}
+		else if (fHex && 'A' <= c && 'F' >= c)
+		{
+			ulDigit = 10 + c - 'A';
+		}
+		else
+		{
+			RaiseParseError();
+		}
+
+		ulCodePoint = ulCodePoint * (fHex ? 16 : 10) + ulDigit;
+		if (0x10FFFF < ulCodePoint)
+		{
+			RaiseParseError();
+		}
+	}
+
+	return ulCodePoint;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLStreamParser::AppendCodePoint
+//
+//	@doc:
+//		Append a code point to the buffer in UTF-16, the encoding of XMLCh
+//
+//---------------------------------------------------------------------------
+void
+CDXLStreamParser::AppendCodePoint
+	(
+	ULONG ulCodePoint
+	)
+{
+	if (0x10000 > ulCodePoint)
+	{
+		Append((XMLCh) ulCodePoint);
+		return;
+	}
+
+	ulCodePoint -= 0x10000;
+	Append((XMLCh) (0xD800 + (ulCodePoint >> 10)));
+	Append((XMLCh) (0xDC00 + (ulCodePoint & 0x3FF)));
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLStreamParser::UlTranscode
+//
+//	@doc:
+//		Transcode UTF-8 text into the buffer and return its offset. Attribute
+//		values get references expanded and whitespace normalized as by a
+//		non-validating XML processor
+//
+//---------------------------------------------------------------------------
+ULONG
+CDXLStreamParser::UlTranscode
+	(
+	const CHAR *sz,
+	ULONG length,
+	BOOL fAttributeValue
+	)
+{
+	// UTF-16 never takes more code units than UTF-8 takes bytes
+	EnsureBufferCapacity(length + 1);
+
+	const ULONG ulOffset = m_ulBufferUsed;
+	const CHAR *szEnd = sz + length;
+	while (sz < szEnd)
+	{
+		const CHAR c = *sz;
+		if (0 == (c & 0x80) && (!fAttributeValue || ('&' != c && !FWhitespace(c))))
+		{
+			// fast path for ASCII
+			Append((XMLCh) c);
+			sz++;
+		}
+		else if (!fAttributeValue || 0 != (c & 0x80))
+		{
+			AppendCodePoint(UlDecodeUtf8(&sz, szEnd));
+		}
+		else if ('&' == c)
+		{
+			sz++;
+			AppendCodePoint(UlDecodeReference(&sz, szEnd));
+		}
+		else
+		{
+			// a line break given as CR LF is normalized to a single space
+			if ('\r' == c && sz + 1 < szEnd && '\n' == sz[1])
+			{
+				sz++;
+			}
+			Append((XMLCh) ' ');
+			sz++;
+		}
+	}
+
+	Append(0);
+
+	return ulOffset;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLStreamParser::XmlszLookupName
+//
+//	@doc:
+//		Resolve a name through the DXL token table, falling back to
+//		transcoding it into the buffer
+//
+//---------------------------------------------------------------------------
+const XMLCh *
+CDXLStreamParser::XmlszLookupName
+	(
+	const CHAR *szName,
+	ULONG length,
+	Edxltoken *ptoken,
+	ULONG *pulOffset
+	)
+{
+	*ptoken = CDXLTokens::EdxltokenLookup(szName, length);
+	if (EdxltokenSentinel != *ptoken)
+	{
+		return CDXLTokens::XmlstrToken(*ptoken);
+	}
+
+	*pulOffset = UlTranscode(szName, length, false /*fAttributeValue*/);
+
+	return NULL;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLStreamParser::ParseStartTag
+//
+//	@doc:
+//		Parse a start tag, including its attributes, and notify the current
+//		handler. Names and values are recorded by buffer offsets and turned
+//		into pointers only once the buffer no longer grows
+//
+//---------------------------------------------------------------------------
+void
+CDXLStreamParser::ParseStartTag()
+{
+	m_ulBufferUsed = 0;
+
+	const CHAR *szName = m_szCurrent;
+	const ULONG ulNameLength = UlScanName();
+
+	ULONG ulAttrs = 0;
+	BOOL fEmptyElement = false;
+	while (true)
+	{
+		SkipWhitespace();
+		if (m_szCurrent == m_szEnd)
+		{
+			RaiseParseError();
+		}
+
+		if ('>' == *m_szCurrent)
+		{
+			m_szCurrent++;
+			break;
+		}
+
+		if ('/' == *m_szCurrent)
+		{
+			m_szCurrent++;
+			if (m_szCurrent == m_szEnd || '>' != *m_szCurrent)
+			{
+				RaiseParseError();
+			}
+			m_szCurrent++;
+			fEmptyElement = true;
+			break;
+		}
+
+		const CHAR *szAttrName = m_szCurrent;
+		const ULONG ulAttrNameLength = UlScanName();
+
+		SkipWhitespace();
+		if (m_szCurrent == m_szEnd || '=' != *m_szCurrent)
+		{
+			RaiseParseError();
+		}
+		m_szCurrent++;
+		SkipWhitespace();
+
+		if (m_szCurrent == m_szEnd || ('"' != *m_szCurrent && '\'' != *m_szCurrent))
+		{
+			RaiseParseError();
+		}
+
+		const CHAR cQuote = *m_szCurrent++;
+		const CHAR *szValue = m_szCurrent;
+		const CHAR *szValueEnd = (const CHAR *) memchr(szValue, cQuote, m_szEnd - szValue);
+		if (NULL == szValueEnd)
+		{
+			RaiseParseError();
+		}
+		m_szCurrent = szValueEnd + 1;
+
+		// namespace declarations are not reported, as by Xerces by default
+		if (5 <= ulAttrNameLength && 0 == clib::Memcmp(szAttrName, "xmlns", 5) &&
+			(5 == ulAttrNameLength || ':' == szAttrName[5]))
+		{
+			continue;
+		}
+
+		EnsureAttrCapacity(ulAttrs + 1);
+		SAttribute &attr = m_rgattr[ulAttrs++];
+		Edxltoken attr_token_type = EdxltokenSentinel;
+		attr.m_xmlszName = XmlszLookupName(szAttrName, ulAttrNameLength, &attr_token_type, &attr.m_ulNameOffset);
+		attr.m_ulValueOffset = UlTranscode(szValue, (ULONG) (szValueEnd - szValue), true /*fAttributeValue*/);
+	}
+
+	// element names are reported without their namespace prefix
+	const CHAR *szLocalName = (const CHAR *) memchr(szName, ':', ulNameLength);
+	szLocalName = (NULL == szLocalName) ? szName : szLocalName + 1;
+	const ULONG ulLocalNameLength = ulNameLength - (ULONG) (szLocalName - szName);
+
+	Edxltoken token_type = EdxltokenSentinel;
+	ULONG ulLocalNameOffset = 0;
+	ULONG ulQNameOffset = 0;
+	const XMLCh *xmlszLocalName = XmlszLookupName(szLocalName, ulLocalNameLength, &token_type, &ulLocalNameOffset);
+	const XMLCh *xmlszQName = xmlszLocalName;
+	if (szLocalName != szName)
+	{
+		ulQNameOffset = UlTranscode(szName, ulNameLength, false /*fAttributeValue*/);
+		xmlszQName = NULL;
+	}
+	else
+	{
+		ulQNameOffset = ulLocalNameOffset;
+	}
+
+	// the buffer is final now
+	xmlszLocalName = (NULL == xmlszLocalName) ? m_xmlszBuffer + ulLocalNameOffset : xmlszLocalName;
+	xmlszQName = (NULL == xmlszQName) ? m_xmlszBuffer + ulQNameOffset : xmlszQName;
+	for (ULONG ul = 0; ul < ulAttrs; ul++)
+	{
+		SAttribute &attr = m_rgattr[ul];
+		if (NULL == attr.m_xmlszName)
+		{
+			attr.m_xmlszName = m_xmlszBuffer + attr.m_ulNameOffset;
+		}
+		attr.m_xmlszValue = m_xmlszBuffer + attr.m_ulValueOffset;
+	}
+	m_attrs.Reset(m_rgattr, ulAttrs);
+
+	CParseHandlerBase *parse_handler_base = PphCurrent();
+	if (NULL != parse_handler_base)
+	{
+		// handlers creating a parse handler for the element dispatch on its
+		// token instead of hashing its name
+		m_parse_handler_mgr->m_curr_element_token = token_type;
+		parse_handler_base->startElement(xmlszEmpty, xmlszLocalName, xmlszQName, m_attrs);
+		m_parse_handler_mgr->m_curr_element_token = EdxltokenSentinel;
+	}
+
+	if (fEmptyElement)
+	{
+		NotifyEndElement(szName, ulNameLength);
+		return;
+	}
+
+	if (m_ulOpenElements == m_ulOpenElementCapacity)
+	{
+		ULONG ulCapacity = 2 * m_ulOpenElementCapacity;
+		const CHAR **rgszOpenElements = GPOS_NEW_ARRAY(m_mp, const CHAR *, ulCapacity);
+		ULONG *rgulOpenElementLengths = GPOS_NEW_ARRAY(m_mp, ULONG, ulCapacity);
+		clib::Memcpy(rgszOpenElements, m_rgszOpenElements, m_ulOpenElements * sizeof(const CHAR *));
+		clib::Memcpy(rgulOpenElementLengths, m_rgulOpenElementLengths, m_ulOpenElements * sizeof(ULONG));
+		GPOS_DELETE_ARRAY(m_rgszOpenElements);
+		GPOS_DELETE_ARRAY(m_rgulOpenElementLengths);
+
+		m_rgszOpenElements = rgszOpenElements;
+		m_rgulOpenElementLengths = rgulOpenElementLengths;
+		m_ulOpenElementCapacity = ulCapacity;
+	}
+
+	m_rgszOpenElements[m_ulOpenElements] = szName;
+	m_rgulOpenElementLengths[m_ulOpenElements] = ulNameLength;
+	m_ulOpenElements++;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLStreamParser::ParseEndTag
+//
+//	@doc:
+//		Parse an end tag, check that it closes the innermost open element
+//		and notify the current handler
+//
+//---------------------------------------------------------------------------
+void
+CDXLStreamParser::ParseEndTag()
+{
+	const CHAR *szName = m_szCurrent;
+	const ULONG ulNameLength = UlScanName();
+
+	SkipWhitespace();
+	if (m_szCurrent == m_szEnd || '>' != *m_szCurrent)
+	{
+		RaiseParseError();
+	}
+	m_szCurrent++;
+
+	if (0 == m_ulOpenElements ||
+		ulNameLength != m_rgulOpenElementLengths[m_ulOpenElements - 1] ||
+		0 != clib::Memcmp(szName, m_rgszOpenElements[m_ulOpenElements - 1], ulNameLength))
+	{
+		RaiseParseError();
+	}
+	m_ulOpenElements--;
+
+	NotifyEndElement(szName, ulNameLength);
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLStreamParser::NotifyEndElement
+//
+//	@doc:
+//		Notify the current handler about the end of an element
+//
+//---------------------------------------------------------------------------
+void
+CDXLStreamParser::NotifyEndElement
+	(
+	const CHAR *szName,
+	ULONG ulNameLength
+	)
+{
+	CParseHandlerBase *parse_handler_base = PphCurrent();
+	if (NULL == parse_handler_base)
+	{
+		return;
+	}
+
+	m_ulBufferUsed = 0;
+
+	const CHAR *szLocalName = (const CHAR *) memchr(szName, ':', ulNameLength);
+	szLocalName = (NULL == szLocalName) ? szName : szLocalName + 1;
+	const ULONG ulLocalNameLength = ulNameLength - (ULONG) (szLocalName - szName);
+
+	Edxltoken token_type = EdxltokenSentinel;
+	ULONG ulLocalNameOffset = 0;
+	const XMLCh *xmlszLocalName = XmlszLookupName(szLocalName, ulLocalNameLength, &token_type, &ulLocalNameOffset);
+	ULONG ulQNameOffset = (szLocalName != szName) ?
+			UlTranscode(szName, ulNameLength, false /*fAttributeValue*/) :
+			ulLocalNameOffset;
+
+	const XMLCh *xmlszQName = NULL;
+	if (szLocalName == szName && NULL != xmlszLocalName)
+	{
+		xmlszQName = xmlszLocalName;
+	}
+	else
+	{
+		xmlszQName = m_xmlszBuffer + ulQNameOffset;
+	}
+
+	if (NULL == xmlszLocalName)
+	{
+		xmlszLocalName = m_xmlszBuffer + ulLocalNameOffset;
+	}
+
+	parse_handler_base->endElement(xmlszEmpty, xmlszLocalName, xmlszQName);
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLStreamParser::Parse
+//
+//	@doc:
+//		Parse the given document. The XML declaration, processing
+//		instructions, comments and character data are skipped
+//
+//---------------------------------------------------------------------------
+void
+CDXLStreamParser::Parse
+	(
+	const CHAR *dxl_string,
+	ULONG length
+	)
+{
+	GPOS_ASSERT(NULL != dxl_string);
+
+	m_szCurrent = dxl_string;
+	m_szEnd = dxl_string + length;
+	m_ulOpenElements = 0;
+
+	// skip a byte order mark
+	if (FStartsWith("\xEF\xBB\xBF", 3))
+	{
+		m_szCurrent += 3;
+	}
+
+	CParseHandlerBase *parse_handler_base = PphCurrent();
+	if (NULL != parse_handler_base)
+	{
+		parse_handler_base->startDocument();
+	}
+
+	BOOL fRootSeen = false;
+	while (m_szCurrent < m_szEnd)
+	{
+		const CHAR *szMarkup = (const CHAR *) memchr(m_szCurrent, '<', m_szEnd - m_szCurrent);
+		if (NULL == szMarkup)
+		{
+			break;
+		}
+		m_szCurrent = szMarkup;
+
+		if (FStartsWith("<?", 2))
+		{
+			SkipPast("?>", 2);
+		}
+		else if (FStartsWith("<!--", 4))
+		{
+			SkipPast("-->", 3);
+		}
+		else if (FStartsWith("<![CDATA[", 9))
+		{
+			SkipPast("]]>", 3);
+		}
+		else if (FStartsWith("<!", 2))
+		{
+			// document type declarations are not supported
+			RaiseParseError();
+		}
+		else if (FStartsWith("</", 2))
+		{
+			m_szCurrent += 2;
+			ParseEndTag();
+		}
+		else
+		{
+			if (fRootSeen && 0 == m_ulOpenElements)
+			{
+				// more than one root element
+				RaiseParseError();
+			}
+
+			m_szCurrent++;
+			fRootSeen = true;
+			ParseStartTag();
+		}
+	}
+
+	if (!fRootSeen || 0 != m_ulOpenElements)
+	{
+		RaiseParseError();
+	}
+
+	parse_handler_base = PphCurrent();
+	if (NULL != parse_handler_base)
+	{
+		parse_handler_base->endDocument();
+	}
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLStreamParser::CAttributes::getLength
+//
+//	@doc:
+//		Number of attributes
+//
+//---------------------------------------------------------------------------
+XMLSize_t
+CDXLStreamParser::CAttributes::getLength() const
+{
+	return m_ulAttrs;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLStreamParser::CAttributes::getURI
+//
+//	@doc:
+//		Namespace URI of the attribute at the given index; DXL attributes
+//		are not qualified
+//
+//---------------------------------------------------------------------------
+const XMLCh *
+CDXLStreamParser::CAttributes::getURI
+	(
+	const XMLSize_t index
+	)
+	const
+{
+	return (index < m_ulAttrs) ? xmlszEmpty : NULL;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLStreamParser::CAttributes::getLocalName
+//
+//	@doc:
+//		Local name of the attribute at the given index
+//
+//---------------------------------------------------------------------------
+const XMLCh *
+CDXLStreamParser::CAttributes::getLocalName
+	(
+	const XMLSize_t index
+	)
+	const
+{
+	return (index < m_ulAttrs) ? m_rgattr[index].m_xmlszName : NULL;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLStreamParser::CAttributes::getQName
+//
+//	@doc:
+//		Qualified name of the attribute at the given index
+//
+//---------------------------------------------------------------------------
+const XMLCh *
+CDXLStreamParser::CAttributes::getQName
+	(
+	const XMLSize_t index
+	)
+	const
+{
+	return getLocalName(index);
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLStreamParser::CAttributes::getType
+//
+//	@doc:
+//		Type of the attribute at the given index; type information requires
+//		validation and is not available
+//
+//---------------------------------------------------------------------------
+const XMLCh *
+CDXLStreamParser::CAttributes::getType
+	(
+	const XMLSize_t index
+	)
+	const
+{
+	return (index < m_ulAttrs) ? xmlszEmpty : NULL;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLStreamParser::CAttributes::getValue
+//
+//	@doc:
+//		Value of the attribute at the given index
+//
+//---------------------------------------------------------------------------
+const XMLCh *
+CDXLStreamParser::CAttributes::getValue
+	(
+	const XMLSize_t index
+	)
+	const
+{
+	return (index < m_ulAttrs) ? m_rgattr[index].m_xmlszValue : NULL;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLStreamParser::CAttributes::getIndex
+//
+//	@doc:
+//		Index of the attribute with the given qualified name. Handlers look
+//		attributes up by DXL token strings, so a pointer comparison settles
+//		most lookups before names are compared
+//
+//---------------------------------------------------------------------------
+bool
+CDXLStreamParser::CAttributes::getIndex
+	(
+	const XMLCh *const qname,
+	XMLSize_t &index
+	)
+	const
+{
+	for (ULONG ul = 0; ul < m_ulAttrs; ul++)
+	{
+		if (qname == m_rgattr[ul].m_xmlszName)
+		{
+			index = ul;
+			return true;
+		}
+	}
+
+	for (ULONG ul = 0; ul < m_ulAttrs; ul++)
+	{
+		if (XMLString::equals(qname, m_rgattr[ul].m_xmlszName))
+		{
+			index = ul;
+			return true;
+		}
+	}
+
+	return false;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLStreamParser::CAttributes::getIndex
+//
+//	@doc:
+//		Index of the attribute with the given qualified name, or -1
+//
+//---------------------------------------------------------------------------
+int
+CDXLStreamParser::CAttributes::getIndex
+	(
+	const XMLCh *const qname
+	)
+	const
+{
+	XMLSize_t index = 0;
+	if (getIndex(qname, index))
+	{
+		return (int) index;
+	}
+
+	return -1;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLStreamParser::CAttributes::getIndex
+//
+//	@doc:
+//		Index of the attribute with the given namespace URI and local name
+//
+//---------------------------------------------------------------------------
+bool
+CDXLStreamParser::CAttributes::getIndex
+	(
+	const XMLCh *const uri,
+	const XMLCh *const local_part,
+	XMLSize_t &index
+	)
+	const
+{
+	if (NULL != uri && 0 != uri[0])
+	{
+		return false;
+	}
+
+	return getIndex(local_part, index);
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLStreamParser::CAttributes::getIndex
+//
+//	@doc:
+//		Index of the attribute with the given namespace URI and local name,
+//		or -1
+//
+//---------------------------------------------------------------------------
+int
+CDXLStreamParser::CAttributes::getIndex
+	(
+	const XMLCh *const uri,
+	const XMLCh *const local_part
+	)
+	const
+{
+	XMLSize_t index = 0;
+	if (getIndex(uri, local_part, index))
+	{
+		return (int) index;
+	}
+
+	return -1;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLStreamParser::CAttributes::getType
+//
+//	@doc:
+//		Type of the attribute with the given namespace URI and local name
+//
+//---------------------------------------------------------------------------
+const XMLCh *
+CDXLStreamParser::CAttributes::getType
+	(
+	const XMLCh *const uri,
+	const XMLCh *const local_part
+	)
+	const
+{
+	XMLSize_t index = 0;
+	if (getIndex(uri, local_part, index))
+	{
+		return getType(index);
+	}
+
+	return NULL;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLStreamParser::CAttributes::getType
+//
+//	@doc:
+//		Type of the attribute with the given qualified name
+//
+//---------------------------------------------------------------------------
+const XMLCh *
+CDXLStreamParser::CAttributes::getType
+	(
+	const XMLCh *const qname
+	)
+	const
+{
+	XMLSize_t index = 0;
+	if (getIndex(qname, index))
+	{
+		return getType(index);
+	}
+
+	return NULL;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLStreamParser::CAttributes::getValue
+//
+//	@doc:
+//		Value of the attribute with the given namespace URI and local name
+//
+//---------------------------------------------------------------------------
+const XMLCh *
+CDXLStreamParser::CAttributes::getValue
+	(
+	const XMLCh *const uri,
+	const XMLCh *const local_part
+	)
+	const
+{
+	XMLSize_t index = 0;
+	if (getIndex(uri, local_part, index))
+	{
+		return getValue(index);
+	}
+
+	return NULL;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLStreamParser::CAttributes::getValue
+//
+//	@doc:
+//		Value of the attribute with the given qualified name
+//
+//---------------------------------------------------------------------------
+const XMLCh *
+CDXLStreamParser::CAttributes::getValue
+	(
+	const XMLCh *const qname
+	)
+	const
+{
+	XMLSize_t index = 0;
+	if (getIndex(qname, index))
+	{
+		return getValue(index);
+	}
+
+	return NULL;
+}
+
+// EOF
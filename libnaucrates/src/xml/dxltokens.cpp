@@ -31,6 +31,27 @@ CDXLTokens::m_mp =  NULL;
 CDXLMemoryManager *
 CDXLTokens::m_dxl_memory_manager = NULL;
 
+Edxltoken *
+CDXLTokens::m_pedxltSlots = NULL;
+
+ULONG *
+CDXLTokens::m_pulDisplacements = NULL;
+
+ULONG
+CDXLTokens::m_ulSlots = 0;
+
+ULONG
+CDXLTokens::m_ulBuckets = 0;
+
+// average number of token names per bucket of the perfect hash table
+#define GPDXL_TOKEN_PHF_BUCKET_SIZE	4
+
+// upper limit on the displacement tried for a single bucket
+#define GPDXL_TOKEN_PHF_MAX_DISPLACEMENT	(1 << 20)
+
+// upper limit on the length of a token name
+#define GPDXL_TOKEN_MAX_LENGTH	256
+
 
 //---------------------------------------------------------------------------
 //	@function:
@@ -740,6 +761,8 @@ CDXLTokens::Init
 		m_pstrmap[mapelem.m_edxlt].m_pstr = GPOS_NEW(m_mp) CWStringConst(m_mp, mapelem.m_wsz);
 		m_pxmlszmap[mapelem.m_edxlt].m_xmlsz = XmlstrFromWsz(mapelem.m_wsz);
 	}
+
+	InitPerfectHash();
 }
 
 //---------------------------------------------------------------------------
@@ -755,10 +778,249 @@ CDXLTokens::Terminate()
 {
 	GPOS_DELETE_ARRAY(m_pstrmap);
 	GPOS_DELETE_ARRAY(m_pxmlszmap);
+	GPOS_DELETE_ARRAY(m_pedxltSlots);
+	GPOS_DELETE_ARRAY(m_pulDisplacements);
 	GPOS_DELETE(m_dxl_memory_manager);
 }
 
 
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLTokens::InitPerfectHash
+//
+//	@doc:
+//		Build a perfect hash table over the distinct token names using hash
+//		and displace: names are distributed over buckets by a first hash, and
+//		buckets, largest first, are assigned the smallest displacement under
+//		which all their names fall into free slots. A lookup then costs two
+//		hash computations and a single name comparison
+//
+//---------------------------------------------------------------------------
+void
+CDXLTokens::InitPerfectHash()
+{
+	GPOS_ASSERT(NULL != m_pxmlszmap);
+
+	m_ulBuckets = 1 + EdxltokenSentinel / GPDXL_TOKEN_PHF_BUCKET_SIZE;
+	m_ulSlots = 1;
+	while (m_ulSlots < 2 * EdxltokenSentinel)
+	{
+		m_ulSlots <<= 1;
+	}
+
+	m_pedxltSlots = GPOS_NEW_ARRAY(m_mp, Edxltoken, m_ulSlots);
+	m_pulDisplacements = GPOS_NEW_ARRAY(m_mp, ULONG, m_ulBuckets);
+	for (ULONG ul = 0; ul < m_ulSlots; ul++)
+	{
+		m_pedxltSlots[ul] = EdxltokenSentinel;
+	}
+
+	// chain the distinct token names of each bucket; several tokens may
+	// share a name, the first one is used as the representative
+	ULONG *pulHead = GPOS_NEW_ARRAY(m_mp, ULONG, m_ulBuckets);
+	ULONG *pulSize = GPOS_NEW_ARRAY(m_mp, ULONG, m_ulBuckets);
+	ULONG *pulNext = GPOS_NEW_ARRAY(m_mp, ULONG, EdxltokenSentinel);
+	for (ULONG ul = 0; ul < m_ulBuckets; ul++)
+	{
+		pulHead[ul] = EdxltokenSentinel;
+		pulSize[ul] = 0;
+		m_pulDisplacements[ul] = 0;
+	}
+
+	CHAR szName[GPDXL_TOKEN_MAX_LENGTH];
+	ULONG ulMaxSize = 0;
+	for (ULONG ulToken = 0; ulToken < EdxltokenSentinel; ulToken++)
+	{
+		const XMLCh *xmlsz = m_pxmlszmap[ulToken].m_xmlsz;
+		if (NULL == xmlsz)
+		{
+			continue;
+		}
+
+		ULONG length = 0;
+		while (0 != xmlsz[length])
+		{
+			GPOS_ASSERT(0x80 > xmlsz[length] && "Token names must be ASCII");
+			GPOS_ASSERT(length + 1 < GPOS_ARRAY_SIZE(szName));
+			szName[length] = (CHAR) xmlsz[length];
+			length++;
+		}
+
+		ULONG ulBucket = UlHashName(szName, length, 0) % m_ulBuckets;
+		BOOL fDuplicate = false;
+		for (ULONG ul = pulHead[ulBucket]; !fDuplicate && EdxltokenSentinel != ul; ul = pulNext[ul])
+		{
+			fDuplicate = FTokenMatches((Edxltoken) ul, szName, length);
+		}
+
+		if (!fDuplicate)
+		{
+			pulNext[ulToken] = pulHead[ulBucket];
+			pulHead[ulBucket] = ulToken;
+			pulSize[ulBucket]++;
+			if (ulMaxSize < pulSize[ulBucket])
+			{
+				ulMaxSize = pulSize[ulBucket];
+			}
+		}
+	}
+
+	// place buckets in decreasing order of their size
+	ULONG *pulSlotsTaken = GPOS_NEW_ARRAY(m_mp, ULONG, ulMaxSize + 1);
+	for (ULONG ulSize = ulMaxSize; 0 < ulSize; ulSize--)
+	{
+		for (ULONG ulBucket = 0; ulBucket < m_ulBuckets; ulBucket++)
+		{
+			if (ulSize != pulSize[ulBucket])
+			{
+				continue;
+			}
+
+			BOOL fPlaced = false;
+			for (ULONG ulDisp = 0; !fPlaced && ulDisp < GPDXL_TOKEN_PHF_MAX_DISPLACEMENT; ulDisp++)
+			{
+				ULONG ulTaken = 0;
+				fPlaced = true;
+				for (ULONG ul = pulHead[ulBucket]; fPlaced && EdxltokenSentinel != ul; ul = pulNext[ul])
+				{
+					const XMLCh *xmlsz = m_pxmlszmap[ul].m_xmlsz;
+					ULONG length = 0;
+					while (0 != xmlsz[length])
+					{
+						szName[length] = (CHAR) xmlsz[length];
+						length++;
+					}
+
+					ULONG ulSlot = UlHashName(szName, length, ulDisp + 1) & (m_ulSlots - 1);
+					fPlaced = (EdxltokenSentinel == m_pedxltSlots[ulSlot]);
+					if (fPlaced)
+					{
+						m_pedxltSlots[ulSlot] = (Edxltoken) ul;
+						pulSlotsTaken[ulTaken++] = ulSlot;
+					}
+				}
+
+				if (!fPlaced)
+				{
+					// undo the partial placement and try the next displacement
+					for (ULONG ul = 0; ul < ulTaken; ul++)
+					{
+						m_pedxltSlots[pulSlotsTaken[ul]] = EdxltokenSentinel;
+					}
+				}
+				else
+				{
+					m_pulDisplacements[ulBucket] = ulDisp;
+				}
+			}
+
+			// names of a bucket that could not be placed are reported as
+			// unknown by lookups, which callers must handle anyway
+			GPOS_ASSERT(fPlaced);
+		}
+	}
+
+	GPOS_DELETE_ARRAY(pulSlotsTaken);
+	GPOS_DELETE_ARRAY(pulNext);
+	GPOS_DELETE_ARRAY(pulSize);
+	GPOS_DELETE_ARRAY(pulHead);
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLTokens::UlHashName
+//
+//	@doc:
+//		Seeded FNV-1a hash over the bytes of a name, followed by a final
+//		mixing step so that the low order bits depend on all input bytes
+//
+//---------------------------------------------------------------------------
+ULONG
+CDXLTokens::UlHashName
+	(
+	const CHAR *sz,
+	ULONG length,
+	ULONG seed
+	)
+{
+	ULONG ulHash = 2166136261U ^ (seed * 2654435761U);
+	for (ULONG ul = 0; ul < length; ul++)
+	{
+		ulHash ^= (BYTE) sz[ul];
+		ulHash *= 16777619U;
+	}
+
+	ulHash ^= ulHash >> 15;
+	ulHash *= 2246822519U;
+	ulHash ^= ulHash >> 13;
+
+	return ulHash;
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLTokens::FTokenMatches
+//
+//	@doc:
+//		Check if the given name spells the given token
+//
+//---------------------------------------------------------------------------
+BOOL
+CDXLTokens::FTokenMatches
+	(
+	Edxltoken token_type,
+	const CHAR *sz,
+	ULONG length
+	)
+{
+	const XMLCh *xmlsz = m_pxmlszmap[token_type].m_xmlsz;
+	for (ULONG ul = 0; ul < length; ul++)
+	{
+		if (xmlsz[ul] != (XMLCh) (BYTE) sz[ul])
+		{
+			// also stops at the terminator of a shorter token name
+			return false;
+		}
+	}
+
+	return 0 == xmlsz[length];
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLTokens::EdxltokenLookup
+//
+//	@doc:
+//		Returns the token spelled by the given name, or EdxltokenSentinel if
+//		the name is not a DXL token. For names shared by several tokens the
+//		first such token is returned
+//
+//---------------------------------------------------------------------------
+Edxltoken
+CDXLTokens::EdxltokenLookup
+	(
+	const CHAR *sz,
+	ULONG length
+	)
+{
+	GPOS_ASSERT(NULL != m_pedxltSlots && "Token map not initialized yet");
+
+	ULONG ulBucket = UlHashName(sz, length, 0) % m_ulBuckets;
+	ULONG ulSlot = UlHashName(sz, length, m_pulDisplacements[ulBucket] + 1) & (m_ulSlots - 1);
+
+	Edxltoken token_type = m_pedxltSlots[ulSlot];
+	if (EdxltokenSentinel != token_type && FTokenMatches(token_type, sz, length))
+	{
+		return token_type;
+	}
+
+	return EdxltokenSentinel;
+}
+
+
 //---------------------------------------------------------------------------
 //	@function:
 //		CDXLTokens::GetDXLTokenStr
@@ -138,6 +138,14 @@ namespace gpdxl
 			static 
 			GPOS_RESULT EresUnittest_RunAllNegativeTests();
 
+			// run the positive tests with the streaming DXL parser
+			static
+			GPOS_RESULT EresUnittest_StreamingParser();
+
+			// compare parse throughput of Xerces and the streaming DXL parser
+			static
+			GPOS_RESULT EresUnittest_ParseThroughput();
+
 	}; // class CParseHandlerTest
 }
 
@@ -159,6 +159,11 @@ namespace gpnaucrates
 			static
 			CStatsPredPtrArry *PdrgppredfilterNumeric(CMemoryPool *mp, ULONG colid, SStatsCmpValElem statsCmpValElem);
 
+			// create an IN list filter on integer constants, either as an IN list
+			// or as a plain disjunction of equality filters
+			static
+			CStatsPred *PstatspredInList(CMemoryPool *mp, ULONG colid, ULONG ulConstants, BOOL fArrayCmp);
+
 			// create a filter on a column with null values
 			static
 			CStatsPred *PstatspredNullableCols(CMemoryPool *mp);
@@ -197,6 +202,10 @@ namespace gpnaucrates
 			static
 			GPOS_RESULT EresUnittest_CStatisticsNestedPred();
 
+			// test IN list filters against the equivalent disjunctions
+			static
+			GPOS_RESULT EresUnittest_CStatisticsFilterArrayCmp();
+
 			// test disjunctive filter
 			static
 			GPOS_RESULT EresUnittest_CStatisticsFilterDisj();
@@ -53,6 +53,10 @@ namespace gpnaucrates
 			static
 			GPOS_RESULT EresUnittest_Skew();
 
+			// frequency of the most frequent value
+			static
+			GPOS_RESULT EresUnittest_MaxValueFreq();
+
 	}; // class CHistogramTest
 }
 
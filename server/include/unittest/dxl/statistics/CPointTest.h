@@ -40,6 +40,9 @@ namespace gpnaucrates
 			static
 			GPOS_RESULT EresUnittest_CPointBool();
 
+			static
+			GPOS_RESULT EresUnittest_CPointStatsMapping();
+
 	}; // class CPointTest
 }
 
@@ -143,6 +143,10 @@ namespace gpnaucrates
 			static
 			GPOS_RESULT EresUnittest_CStatisticsBasic();
 
+			// width of column sets
+			static
+			GPOS_RESULT EresUnittest_Width();
+
 			// statistics basic tests
 			static
 			GPOS_RESULT EresUnittest_CStatisticsBucketTest();
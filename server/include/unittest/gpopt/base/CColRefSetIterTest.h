@@ -33,6 +33,7 @@ namespace gpopt
 			// unittests
 			static GPOS_RESULT EresUnittest();
 			static GPOS_RESULT EresUnittest_Basics();
+			static GPOS_RESULT EresUnittest_IterationTime();
 
 	}; // class CColRefSetIterTest
 }
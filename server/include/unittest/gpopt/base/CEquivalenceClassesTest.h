@@ -23,6 +23,7 @@ namespace gpopt
 			static GPOS_RESULT EresUnittest();
 			static GPOS_RESULT EresUnittest_NotDisjointEquivalanceClasses();
 			static GPOS_RESULT EresUnittest_IntersectEquivalanceClasses();
+			static GPOS_RESULT EresUnittest_MergeEquivalanceClasses();
 			static CColRefSetArray* createEquivalenceClasses(CMemoryPool *mp, CColRefSet *pcrs, int breakpoints[]);
 
 	}; // class CEquivalenceClassesTest
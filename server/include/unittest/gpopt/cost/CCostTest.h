@@ -45,6 +45,8 @@ namespace gpopt
 			static GPOS_RESULT EresUnittest_Parsing();
 			static GPOS_RESULT EresUnittest_ParsingWithException();
 			static GPOS_RESULT EresUnittest_SetParams();
+			static GPOS_RESULT EresUnittest_SkewedHosts();
+			static GPOS_RESULT EresUnittest_SkewedPlan();
 
 	}; // class CCostTest
 }
@@ -13,6 +13,8 @@
 
 #include "gpos/base.h"
 
+#include "gpopt/xforms/CXform.h"
+
 
 namespace gpopt
 {
@@ -29,11 +31,28 @@ namespace gpopt
 	class CBindingTest
 	{
 
+		private:
+
+			// optimize the query in the given minidump and return the
+			// number of bindings of the given xforms
+			static
+			void OptimizeMinidump
+				(
+				CMemoryPool *mp,
+				const CHAR *szFileName,
+				const CXform::EXformId *rgexfid,
+				ULONG ulXforms,
+				ULONG *rgulBindings,
+				ULONG_PTR *pulpBlocked
+				);
+
 		public:
 
 			// unittests
 			static GPOS_RESULT EresUnittest();
 			static GPOS_RESULT EresUnittest_Basic();
+			static GPOS_RESULT EresUnittest_StaticBinding();
+			static GPOS_RESULT EresUnittest_DuplicateBindings();
 
 	}; // class CBindingTest
 }
@@ -14,7 +14,9 @@
 
 #include "gpos/base.h"
 #include "gpos/common/CDynamicPtrArray.h"
+#include "gpos/string/CWStringDynamic.h"
 
+#include "gpopt/base/COptCtxt.h"
 #include "gpopt/base/COptimizationContext.h"
 #include "gpopt/search/CSearchStage.h"
 #include "gpopt/operators/CExpression.h"
@@ -44,6 +46,20 @@ namespace gpopt
 			static
 			GPOS_RESULT EresTestEngine(Pfpexpr rgpf[], ULONG size);
 
+			// optimize the generated expression in a new optimization context,
+			// return the cost of the best plan and the given optimizer counter,
+			// and print the best plan if a string is given
+			static
+			CCost CostOptimize
+				(
+				CMemoryPool *mp,
+				CMDAccessor *md_accessor,
+				Pfpexpr pf,
+				COptCtxt::EOptCounter eoc,
+				ULONG_PTR *pulpCounter,
+				CWStringDynamic *pstrPlan
+				);
+
 #endif // GPOS_DEBUG
 
 			// counter used to mark last successful test
@@ -90,6 +106,26 @@ namespace gpopt
 			static
 			GPOS_RESULT EresUnittest_AppendStats();
 
+			// test of pruning optimization requests by cost lower bounds
+			static
+			GPOS_RESULT EresUnittest_SpacePruning();
+
+			// test of reusing cost model inputs and results across contexts
+			static
+			GPOS_RESULT EresUnittest_CostReuse();
+
+			// test of reusing costs of cost-equivalent contexts
+			static
+			GPOS_RESULT EresUnittest_CostEquivalentReuse();
+
+			// test of deriving plan properties on demand and reusing them
+			static
+			GPOS_RESULT EresUnittest_PlanPropsReuse();
+
+			// test of creating cost context tables on first use
+			static
+			GPOS_RESULT EresUnittest_LazyCostTables();
+
 			// test of recursive memo building with a large number of joins
 			static
 			GPOS_RESULT EresUnittest_BuildMemoLargeJoins();
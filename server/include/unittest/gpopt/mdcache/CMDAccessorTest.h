@@ -76,8 +76,11 @@ namespace gpopt
 			static GPOS_RESULT EresUnittest_Indexes();
 			static GPOS_RESULT EresUnittest_CheckConstraint();
 			static GPOS_RESULT EresUnittest_IndexPartConstraint();
+			static GPOS_RESULT EresUnittest_IndexApplicabilityMap();
 			static GPOS_RESULT EresUnittest_Cast();
 			static GPOS_RESULT EresUnittest_ScCmp();
+			static GPOS_RESULT EresUnittest_HistogramReuse();
+			static GPOS_RESULT EresUnittest_StatsCache();
 			static GPOS_RESULT EresUnittest_PrematureMDIdRelease();
 
 	}; // class CMDAccessorTest
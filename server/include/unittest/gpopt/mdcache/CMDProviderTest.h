@@ -46,6 +46,8 @@ namespace gpdxl
 			static GPOS_RESULT EresUnittest();
 			static GPOS_RESULT EresUnittest_Basic();
 			static GPOS_RESULT EresUnittest_Stats();
+			static GPOS_RESULT EresUnittest_Handoff();
+			static GPOS_RESULT EresUnittest_Batch();
 			static GPOS_RESULT EresUnittest_Negative();
 
 
@@ -78,6 +78,8 @@ namespace gpopt
 			static GPOS_RESULT EresUnittest_Union();
 			static GPOS_RESULT EresUnittest_Const();
 			static GPOS_RESULT EresUnittest_BitmapGet();
+			static GPOS_RESULT EresUnittest_Interning();
+			static GPOS_RESULT EresUnittest_HandleInlineArrays();
 			
 #ifdef GPOS_DEBUG
 			static GPOS_RESULT EresUnittest_ComparisonTypes();
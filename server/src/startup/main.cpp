@@ -24,6 +24,7 @@
 #include "gpopt/engine/CEnumeratorConfig.h"
 #include "gpopt/engine/CStatisticsConfig.h"
 #include "gpopt/mdcache/CMDCache.h"
+#include "gpopt/mdcache/CStatsCache.h"
 #include "gpopt/minidump/CMinidumperUtils.h"
 #include "gpopt/xforms/CXformFactory.h"
 #include "gpopt/optimizer/COptimizerConfig.h"
@@ -282,6 +283,7 @@ void ConfigureTests()
 void Cleanup()
 {
 	CMDCache::Shutdown();
+	CStatsCache::Shutdown();
 	CTestUtils::DestroyMDProvider();
 }
 
@@ -433,7 +435,7 @@ INT main
 {	
 
 	// Use default allocator
-	struct gpos_init_params gpos_params = { NULL };
+	struct gpos_init_params gpos_params = { NULL, 0 /* num_workers */ };
 
 	gpos_init(&gpos_params);
 	gpdxl_init();
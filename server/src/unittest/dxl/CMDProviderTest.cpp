@@ -14,6 +14,8 @@
 #include "gpos/io/ioutils.h"
 #include "gpos/io/COstreamString.h"
 #include "gpos/task/CAutoTaskProxy.h"
+#include "gpos/error/CAutoTrace.h"
+#include "gpos/common/CWallClock.h"
 #include "gpos/test/CUnittest.h"
 
 #include "unittest/gpopt/mdcache/CMDProviderTest.h"
@@ -35,6 +37,9 @@ using namespace gpopt;
 
 const CHAR *CMDProviderTest::file_name = "../data/dxl/metadata/md.xml";
 
+// number of times all objects are fetched when comparing lookup paths
+#define GPOPT_MDPROVIDER_HANDOFF_ITERATIONS 10
+
 //---------------------------------------------------------------------------
 //	@function:
 //		CMDProviderTest::EresUnittest
@@ -50,6 +55,8 @@ CMDProviderTest::EresUnittest()
 		{
 		GPOS_UNITTEST_FUNC(CMDProviderTest::EresUnittest_Basic),
 		GPOS_UNITTEST_FUNC(CMDProviderTest::EresUnittest_Stats),
+		GPOS_UNITTEST_FUNC(CMDProviderTest::EresUnittest_Handoff),
+		GPOS_UNITTEST_FUNC(CMDProviderTest::EresUnittest_Batch),
 		GPOS_UNITTEST_FUNC_THROW
 			(
 			CMDProviderTest::EresUnittest_Negative,
@@ -193,6 +200,127 @@ CMDProviderTest::EresUnittest_Stats()
 	return GPOS_OK;
 }
 
+//---------------------------------------------------------------------------
+//	@function:
+//		CMDProviderTest::EresUnittest_Handoff
+//
+//	@doc:
+//		Test that a memory-based provider hands over the parsed objects and
+//		compare the time needed to fetch all objects directly against the
+//		time needed to fetch and parse their DXL representation
+//
+//---------------------------------------------------------------------------
+GPOS_RESULT
+CMDProviderTest::EresUnittest_Handoff()
+{
+	// create memory pool
+	CAutoMemoryPool amp;
+	CMemoryPool *mp = amp.Pmp();
+
+	CHAR *dxl_string = CDXLUtils::Read(mp, file_name);
+	IMDCacheObjectArray *mdcache_obj_array = CDXLUtils::ParseDXLToIMDObjectArray(mp, dxl_string, NULL /*xsd_file_path*/);
+	GPOS_DELETE_ARRAY(dxl_string);
+
+	CMDProviderMemory *pmdpMemory = GPOS_NEW(mp) CMDProviderMemory(mp, mdcache_obj_array);
+	const ULONG size = mdcache_obj_array->Size();
+
+	{
+		pmdpMemory->AddRef();
+		CAutoMDAccessor amda(mp, pmdpMemory, CTestUtils::m_sysidDefault, CMDCache::Pcache());
+
+		// fetch objects through their DXL representation
+		CWallClock clock;
+		for (ULONG ulIter = 0; ulIter < GPOPT_MDPROVIDER_HANDOFF_ITERATIONS; ulIter++)
+		{
+			for (ULONG ul = 0; ul < size; ul++)
+			{
+				IMDId *mdid = (*mdcache_obj_array)[ul]->MDId();
+				CWStringBase *pstrMDObject = pmdpMemory->GetMDObjDXLStr(mp, amda.Pmda(), mdid);
+				IMDCacheObject *pimdobj = CDXLUtils::ParseDXLToIMDIdCacheObj(mp, pstrMDObject, NULL);
+				GPOS_ASSERT(mdid->Equals(pimdobj->MDId()));
+
+				GPOS_DELETE(pstrMDObject);
+				pimdobj->Release();
+			}
+		}
+		ULONG ulDXLTime = clock.ElapsedMS();
+
+		// fetch the objects handed over by the provider
+		clock.Restart();
+		for (ULONG ulIter = 0; ulIter < GPOPT_MDPROVIDER_HANDOFF_ITERATIONS; ulIter++)
+		{
+			for (ULONG ul = 0; ul < size; ul++)
+			{
+				IMDCacheObject *pimdobjLoaded = (*mdcache_obj_array)[ul];
+				IMDCacheObject *pimdobj = pmdpMemory->GetMDObj(mp, amda.Pmda(), pimdobjLoaded->MDId());
+				GPOS_RTL_ASSERT(pimdobj == pimdobjLoaded);
+
+				pimdobj->Release();
+			}
+		}
+		ULONG ulHandoffTime = clock.ElapsedMS();
+
+		CAutoTrace at(mp);
+		at.Os()
+			<< "Fetching " << size << " objects " << GPOPT_MDPROVIDER_HANDOFF_ITERATIONS << " times: "
+			<< ulDXLTime << "ms through DXL, " << ulHandoffTime << "ms through handoff";
+	}
+
+	mdcache_obj_array->Release();
+	pmdpMemory->Release();
+
+	return GPOS_OK;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CMDProviderTest::EresUnittest_Batch
+//
+//	@doc:
+//		Test fetching the column stats of a relation in a single call, which
+//		must return the same DXL as fetching them one at a time
+//
+//---------------------------------------------------------------------------
+GPOS_RESULT
+CMDProviderTest::EresUnittest_Batch()
+{
+	// create memory pool
+	CAutoMemoryPool amp;
+	CMemoryPool *mp = amp.Pmp();
+
+	CMDProviderMemory *pmdpFile = GPOS_NEW(mp) CMDProviderMemory(mp, file_name);
+
+	{
+		pmdpFile->AddRef();
+		CAutoMDAccessor amda(mp, pmdpFile, CTestUtils::m_sysidDefault, CMDCache::Pcache());
+
+		// column stats of existing and non-existing columns
+		IMdIdArray *mdids = GPOS_NEW(mp) IMdIdArray(mp);
+		for (ULONG ulPos = 0; ulPos < 4; ulPos++)
+		{
+			mdids->Append(GPOS_NEW(mp) CMDIdColStats(GPOS_NEW(mp) CMDIdGPDB(GPOPT_MDCACHE_TEST_OID, 1, 1), ulPos));
+		}
+
+		StringPtrArray *pdrgpstr = pmdpFile->GetMDObjDXLStrArray(mp, amda.Pmda(), mdids);
+		GPOS_RTL_ASSERT(mdids->Size() == pdrgpstr->Size());
+
+		for (ULONG ul = 0; ul < mdids->Size(); ul++)
+		{
+			CWStringBase *pstrColStats = pmdpFile->GetMDObjDXLStr(mp, amda.Pmda(), (*mdids)[ul]);
+			GPOS_RTL_ASSERT(pstrColStats->Equals((*pdrgpstr)[ul]));
+			GPOS_DELETE(pstrColStats);
+		}
+
+		// cleanup
+		pdrgpstr->Release();
+		mdids->Release();
+	}
+
+	pmdpFile->Release();
+
+	return GPOS_OK;
+}
+
 //---------------------------------------------------------------------------
 //	@function:
 //		CMDProviderTest::EresUnittest_Negative
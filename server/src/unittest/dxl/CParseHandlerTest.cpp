@@ -11,14 +11,17 @@
 #include "gpos/error/CException.h"
 #include "gpos/error/CAutoTrace.h"
 #include "gpos/error/CMessage.h"
+#include "gpos/common/CWallClock.h"
 #include "gpos/io/COstreamString.h"
 #include "gpos/string/CWStringDynamic.h"
+#include "gpos/task/CAutoTraceFlag.h"
 
 #include "naucrates/exception.h"
 #include "naucrates/base/CQueryToDXLResult.h"
 #include "naucrates/dxl/xml/CXMLSerializer.h"
 #include "naucrates/dxl/operators/CDXLNode.h"
 #include "naucrates/dxl/CDXLUtils.h"
+#include "naucrates/dxl/parser/CParseHandlerDXL.h"
 
 #include "gpopt/eval/CConstExprEvaluatorDefault.h"
 
@@ -28,6 +31,10 @@
 #include "unittest/gpopt/CTestUtils.h"
 
 #include "naucrates/md/CMDRequest.h"
+#include "naucrates/traceflags/traceflags.h"
+
+// number of times each document is parsed when measuring parse throughput
+#define GPDXL_PARSE_THROUGHPUT_ITERATIONS	20
 
 
 // MD request file
@@ -201,6 +208,9 @@ CParseHandlerTest::EresUnittest()
 
 		// tests that should throw an exception
 		GPOS_UNITTEST_FUNC(CParseHandlerTest::EresUnittest_RunAllNegativeTests),
+
+		GPOS_UNITTEST_FUNC(CParseHandlerTest::EresUnittest_StreamingParser),
+		GPOS_UNITTEST_FUNC(CParseHandlerTest::EresUnittest_ParseThroughput),
 		};
 
 	// skip OOM and Abort simulation for this test, it takes hours
@@ -433,6 +443,113 @@ CParseHandlerTest::EresUnittest_RunAllNegativeTests()
 	return GPOS_OK;
 }
 
+//---------------------------------------------------------------------------
+//	@function:
+//		CParseHandlerTest::EresUnittest_StreamingParser
+//
+//	@doc:
+//		Run the positive tests with the streaming DXL parser, verifying that
+//		it produces the same DXL trees as Xerces
+//
+//---------------------------------------------------------------------------
+GPOS_RESULT
+CParseHandlerTest::EresUnittest_StreamingParser()
+{
+	CAutoTraceFlag atf(EopttraceStreamingDXLParser, true /*value*/);
+
+	if (GPOS_OK != EresUnittest_ScalarExpr() ||
+		GPOS_OK != EresUnittest_Statistics() ||
+		GPOS_OK != EresUnittest_Metadata() ||
+		GPOS_OK != EresUnittest_MDRequest() ||
+		GPOS_OK != EresUnittest_RunPlanTests() ||
+		GPOS_OK != EresUnittest_RunQueryTests())
+	{
+		return GPOS_FAILED;
+	}
+
+	// ill-formed documents are rejected as with Xerces
+	CAutoMemoryPool amp(CAutoMemoryPool::ElcNone);
+	CMemoryPool *mp = amp.Pmp();
+
+	const CHAR *rgszIllFormed[] =
+		{
+		"<dxl:DXLMessage xmlns:dxl=\"http://greenplum.com/dxl/2010/12/\">",
+		"<dxl:DXLMessage xmlns:dxl=\"http://greenplum.com/dxl/2010/12/\"><dxl:Plan></dxl:DXLMessage>",
+		"<dxl:DXLMessage xmlns:dxl=\"http://greenplum.com/dxl/2010/12/\" Id=\"1></dxl:DXLMessage>",
+		};
+
+	for (ULONG ul = 0; ul < GPOS_ARRAY_SIZE(rgszIllFormed); ul++)
+	{
+		BOOL fRaised = false;
+		GPOS_TRY
+		{
+			CParseHandlerDXL *parse_handler_dxl = CDXLUtils::GetParseHandlerForDXLString(mp, rgszIllFormed[ul], NULL /*xsd_file_path*/);
+			GPOS_DELETE(parse_handler_dxl);
+		}
+		GPOS_CATCH_EX(ex)
+		{
+			fRaised = GPOS_MATCH_EX(ex, gpdxl::ExmaDXL, gpdxl::ExmiDXLXercesParseError);
+			GPOS_RESET_EX;
+		}
+		GPOS_CATCH_END;
+
+		if (!fRaised)
+		{
+			return GPOS_FAILED;
+		}
+	}
+
+	return GPOS_OK;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CParseHandlerTest::EresUnittest_ParseThroughput
+//
+//	@doc:
+//		Parse the plan test files repeatedly with Xerces and with the
+//		streaming DXL parser and report the time taken by each
+//
+//---------------------------------------------------------------------------
+GPOS_RESULT
+CParseHandlerTest::EresUnittest_ParseThroughput()
+{
+	CAutoMemoryPool amp;
+	CMemoryPool *mp = amp.Pmp();
+
+	ULONG rgulElapsedMS[2] = {0, 0};
+	ULLONG ullBytes = 0;
+
+	for (ULONG ulFile = 0; ulFile < GPOS_ARRAY_SIZE(m_rgszPlanDXLFileNames); ulFile++)
+	{
+		CHAR *dxl_string = CDXLUtils::Read(mp, m_rgszPlanDXLFileNames[ulFile]);
+		ullBytes += clib::Strlen(dxl_string);
+
+		for (ULONG ulParser = 0; ulParser < GPOS_ARRAY_SIZE(rgulElapsedMS); ulParser++)
+		{
+			CAutoTraceFlag atf(EopttraceStreamingDXLParser, 1 == ulParser);
+
+			CWallClock clock;
+			for (ULONG ul = 0; ul < GPDXL_PARSE_THROUGHPUT_ITERATIONS; ul++)
+			{
+				CParseHandlerDXL *parse_handler_dxl = CDXLUtils::GetParseHandlerForDXLString(mp, dxl_string, NULL /*xsd_file_path*/);
+				GPOS_DELETE(parse_handler_dxl);
+			}
+			rgulElapsedMS[ulParser] += clock.ElapsedMS();
+		}
+
+		GPOS_DELETE_ARRAY(dxl_string);
+	}
+
+	CAutoTrace at(mp);
+	at.Os()
+		<< "Parsed " << ullBytes * GPDXL_PARSE_THROUGHPUT_ITERATIONS << " bytes of DXL: "
+		<< "Xerces " << rgulElapsedMS[0] << "ms, "
+		<< "streaming parser " << rgulElapsedMS[1] << "ms";
+
+	return GPOS_OK;
+}
+
 //---------------------------------------------------------------------------
 //	@function:
 //		CParseHandlerTest::EresParseAndSerializePlan
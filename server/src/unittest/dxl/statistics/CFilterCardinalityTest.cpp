@@ -15,11 +15,14 @@
 
 #include <stdint.h>
 
+#include "gpos/common/CWallClock.h"
+#include "gpos/error/CAutoTrace.h"
 #include "gpos/io/COstreamString.h"
 #include "gpos/string/CWStringDynamic.h"
 
 #include "naucrates/statistics/CStatisticsUtils.h"
 #include "naucrates/statistics/CFilterStatsProcessor.h"
+#include "naucrates/statistics/CStatsPredArrayCmp.h"
 #include "naucrates/dxl/CDXLUtils.h"
 
 #include "unittest/base.h"
@@ -70,6 +73,7 @@ CFilterCardinalityTest::EresUnittest()
 		GPOS_UNITTEST_FUNC(CFilterCardinalityTest::EresUnittest_CStatisticsFilter),
 		GPOS_UNITTEST_FUNC(CFilterCardinalityTest::EresUnittest_CStatisticsFilterConj),
 		GPOS_UNITTEST_FUNC(CFilterCardinalityTest::EresUnittest_CStatisticsFilterDisj),
+		GPOS_UNITTEST_FUNC(CFilterCardinalityTest::EresUnittest_CStatisticsFilterArrayCmp),
 		GPOS_UNITTEST_FUNC(CFilterCardinalityTest::EresUnittest_CStatisticsNestedPred),
 		GPOS_UNITTEST_FUNC(CFilterCardinalityTest::EresUnittest_CStatisticsBasicsFromDXL),
 		GPOS_UNITTEST_FUNC(CFilterCardinalityTest::EresUnittest_CStatisticsAccumulateCard)
@@ -238,6 +242,115 @@ CFilterCardinalityTest::EresUnittest_CStatisticsFilterDisj()
 	return EresUnittest_CStatistics(rgstatsdisjtc, ulTestCases);
 }
 
+// create the filter col IN (c1, ..., cN, NULL) on a mix of constants with
+// and without a matching bucket, including duplicates
+CStatsPred *
+CFilterCardinalityTest::PstatspredInList
+	(
+	CMemoryPool *mp,
+	ULONG colid,
+	ULONG ulConstants,
+	BOOL fArrayCmp
+	)
+{
+	CStatsPredPtrArry *pdrgpstatspredDisj = GPOS_NEW(mp) CStatsPredPtrArry(mp);
+	for (ULONG ul = 0; ul < ulConstants; ul++)
+	{
+		INT iVal = INT((ul * 7) % (2 * ulConstants + 700));
+		pdrgpstatspredDisj->Append(GPOS_NEW(mp) CStatsPredPoint(colid, CStatsPred::EstatscmptEq, CTestUtils::PpointInt4(mp, iVal)));
+	}
+	pdrgpstatspredDisj->Append(GPOS_NEW(mp) CStatsPredPoint(colid, CStatsPred::EstatscmptEq, CTestUtils::PpointInt4NullVal(mp)));
+
+	CStatsPredDisj *disjunctive_pred_stats = NULL;
+	if (fArrayCmp)
+	{
+		disjunctive_pred_stats = GPOS_NEW(mp) CStatsPredArrayCmp(mp, pdrgpstatspredDisj);
+	}
+	else
+	{
+		disjunctive_pred_stats = GPOS_NEW(mp) CStatsPredDisj(pdrgpstatspredDisj);
+	}
+
+	CStatsPredPtrArry *pdrgpstatspred = GPOS_NEW(mp) CStatsPredPtrArry(mp);
+	pdrgpstatspred->Append(disjunctive_pred_stats);
+
+	return GPOS_NEW(mp) CStatsPredConj(pdrgpstatspred);
+}
+
+// IN lists estimated in a single pass must produce the same estimates as
+// the disjunction of their equality filters; also reports the time needed
+// for IN lists of 100 to 100k constants
+GPOS_RESULT
+CFilterCardinalityTest::EresUnittest_CStatisticsFilterArrayCmp()
+{
+	// create memory pool
+	CAutoMemoryPool amp;
+	CMemoryPool *mp = amp.Pmp();
+
+	// histogram of the form [0, 100), ..., [500, 600) with nulls and remaining NDVs
+	UlongToHistogramMap *col_histogram_mapping = GPOS_NEW(mp) UlongToHistogramMap(mp);
+	col_histogram_mapping->Insert(GPOS_NEW(mp) ULONG(1), CCardinalityTestUtils::PhistInt4Remain(mp, 6, 20.0, true /* fNullFreq */, 5.0));
+
+	UlongToDoubleMap *colid_width_mapping = GPOS_NEW(mp) UlongToDoubleMap(mp);
+	colid_width_mapping->Insert(GPOS_NEW(mp) ULONG(1), GPOS_NEW(mp) CDouble(4.0));
+
+	CStatistics *stats = GPOS_NEW(mp) CStatistics
+									(
+									mp,
+									col_histogram_mapping,
+									colid_width_mapping,
+									CDouble(100000.0) /* rows */,
+									false /* is_empty() */
+									);
+
+	const ULONG rgulConstants[] = {2, 10, 100, 1000, 10000, 100000};
+
+	// largest IN list also estimated as a disjunction, whose cost is quadratic
+	const ULONG ulMaxDisjConstants = 1000;
+
+	for (ULONG ul = 0; ul < GPOS_ARRAY_SIZE(rgulConstants); ul++)
+	{
+		const ULONG ulConstants = rgulConstants[ul];
+
+		CStatsPred *pred_stats = PstatspredInList(mp, 1, ulConstants, true /* fArrayCmp */);
+		CWallClock clock;
+		CStatistics *pstatsArrayCmp = CFilterStatsProcessor::MakeStatsFilter(mp, stats, pred_stats, true /* do_cap_NDVs */);
+		ULONG ulArrayCmpTime = clock.ElapsedMS();
+		pred_stats->Release();
+
+		CAutoTrace at(mp);
+		at.Os() << "IN list of " << ulConstants << " constants: " << ulArrayCmpTime << "ms in a single pass";
+
+		if (ulConstants <= ulMaxDisjConstants)
+		{
+			pred_stats = PstatspredInList(mp, 1, ulConstants, false /* fArrayCmp */);
+			clock.Restart();
+			CStatistics *pstatsDisj = CFilterStatsProcessor::MakeStatsFilter(mp, stats, pred_stats, true /* do_cap_NDVs */);
+			ULONG ulDisjTime = clock.ElapsedMS();
+			pred_stats->Release();
+
+			at.Os() << ", " << ulDisjTime << "ms as a disjunction";
+
+			DOUBLE dRowsArrayCmp = pstatsArrayCmp->Rows().Get();
+			DOUBLE dRowsDisj = pstatsDisj->Rows().Get();
+			GPOS_RTL_ASSERT(fabs(dRowsArrayCmp - dRowsDisj) <= 1e-6 * dRowsDisj);
+
+			const CHistogram *histArrayCmp = pstatsArrayCmp->GetHistogram(1);
+			const CHistogram *histDisj = pstatsDisj->GetHistogram(1);
+			GPOS_RTL_ASSERT(histArrayCmp->Buckets() == histDisj->Buckets());
+			GPOS_RTL_ASSERT(fabs((histArrayCmp->GetNumDistinct() - histDisj->GetNumDistinct()).Get()) <= 1e-6 * histDisj->GetNumDistinct().Get());
+
+			pstatsDisj->Release();
+		}
+
+		pstatsArrayCmp->Release();
+	}
+
+	stats->Release();
+
+	return GPOS_OK;
+}
+
 // create an or filter (no duplicate)
 CStatsPred *
 CFilterCardinalityTest::PstatspredDisj1
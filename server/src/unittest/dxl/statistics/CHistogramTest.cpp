@@ -38,6 +38,7 @@ CHistogramTest::EresUnittest()
 		GPOS_UNITTEST_FUNC(CHistogramTest::EresUnittest_CHistogramInt4),
 		GPOS_UNITTEST_FUNC(CHistogramTest::EresUnittest_CHistogramBool),
 		GPOS_UNITTEST_FUNC(CHistogramTest::EresUnittest_Skew),
+		GPOS_UNITTEST_FUNC(CHistogramTest::EresUnittest_MaxValueFreq),
 		GPOS_UNITTEST_FUNC(CHistogramTest::EresUnittest_CHistogramValid)
 		};
 
@@ -288,5 +289,39 @@ CHistogramTest::EresUnittest_Skew()
 	return GPOS_OK;
 }
 
+// frequency of the most frequent value
+GPOS_RESULT
+CHistogramTest::EresUnittest_MaxValueFreq()
+{
+	// create memory pool
+	CAutoMemoryPool amp;
+	CMemoryPool *mp = amp.Pmp();
+
+	// a common value held in a single-value bucket
+	CBucketArray *pdrgppbucket1 = GPOS_NEW(mp) CBucketArray(mp);
+	pdrgppbucket1->Append(CCardinalityTestUtils::PbucketIntegerClosedLowerBound(mp, 1, 100, CDouble(0.4), CDouble(100.0)));
+	pdrgppbucket1->Append(CCardinalityTestUtils::PbucketIntegerClosedLowerBound(mp, 100, 101, CDouble(0.3), CDouble(1.0)));
+	CHistogram *histogram1 = GPOS_NEW(mp) CHistogram(mp, pdrgppbucket1, true /*is_well_defined*/, 0.1 /*null_freq*/, 2.0 /*distinct_remaining*/, 0.2 /*freq_remaining*/);
+
+	// values spread uniformly, nulls being the most frequent value
+	CBucketArray *pdrgppbucket2 = GPOS_NEW(mp) CBucketArray(mp);
+	pdrgppbucket2->Append(CCardinalityTestUtils::PbucketIntegerClosedLowerBound(mp, 1, 100, CDouble(0.45), CDouble(100.0)));
+	pdrgppbucket2->Append(CCardinalityTestUtils::PbucketIntegerClosedLowerBound(mp, 100, 200, CDouble(0.45), CDouble(100.0)));
+	CHistogram *histogram2 = GPOS_NEW(mp) CHistogram(mp, pdrgppbucket2, true /*is_well_defined*/, 0.1 /*null_freq*/, 0.0 /*distinct_remaining*/, 0.0 /*freq_remaining*/);
+
+	{
+		CAutoTrace at(mp);
+		at.Os() << "Max value frequencies: " << histogram1->GetMaxValueFreq() << ", " << histogram2->GetMaxValueFreq();
+	}
+
+	GPOS_RTL_ASSERT(CDouble(0.3) == histogram1->GetMaxValueFreq());
+	GPOS_RTL_ASSERT(CDouble(0.1) == histogram2->GetMaxValueFreq());
+
+	GPOS_DELETE(histogram1);
+	GPOS_DELETE(histogram2);
+
+	return GPOS_OK;
+}
+
 // EOF
 
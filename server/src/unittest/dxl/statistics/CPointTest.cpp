@@ -18,6 +18,7 @@
 #include "gpos/io/COstreamString.h"
 #include "gpos/string/CWStringDynamic.h"
 
+#include "naucrates/base/CDatumInt4GPDB.h"
 #include "naucrates/statistics/CPoint.h"
 
 #include "unittest/base.h"
@@ -35,6 +36,7 @@ CPointTest::EresUnittest()
 		{
 		GPOS_UNITTEST_FUNC(CPointTest::EresUnittest_CPointInt4),
 		GPOS_UNITTEST_FUNC(CPointTest::EresUnittest_CPointBool),
+		GPOS_UNITTEST_FUNC(CPointTest::EresUnittest_CPointStatsMapping),
 		};
 
 	CAutoMemoryPool amp;
@@ -105,5 +107,49 @@ CPointTest::EresUnittest_CPointBool()
 	return GPOS_OK;
 }
 
+// comparisons on the stats mapping of points agree with the datums
+GPOS_RESULT
+CPointTest::EresUnittest_CPointStatsMapping()
+{
+	// create memory pool
+	CAutoMemoryPool amp;
+	CMemoryPool *mp = amp.Pmp();
+
+	const INT rgiValues[] = {-5, 0, 0, 7};
+	const ULONG ulValues = GPOS_ARRAY_SIZE(rgiValues);
+
+	// integer points followed by a null point
+	CPoint *rgppoint[ulValues + 1];
+	for (ULONG ul = 0; ul < ulValues; ul++)
+	{
+		rgppoint[ul] = CTestUtils::PpointInt4(mp, rgiValues[ul]);
+	}
+	IDatum *datum_null = GPOS_NEW(mp) CDatumInt4GPDB(CTestUtils::m_sysidDefault, 0 /* val */, true /* is_null */);
+	rgppoint[ulValues] = GPOS_NEW(mp) CPoint(datum_null);
+
+	for (ULONG ulOuter = 0; ulOuter <= ulValues; ulOuter++)
+	{
+		CPoint *point1 = rgppoint[ulOuter];
+		IDatum *datum1 = point1->GetDatum();
+		for (ULONG ulInner = 0; ulInner <= ulValues; ulInner++)
+		{
+			CPoint *point2 = rgppoint[ulInner];
+			IDatum *datum2 = point2->GetDatum();
+
+			GPOS_RTL_ASSERT(point1->Equals(point2) == datum1->StatsAreEqual(datum2));
+			GPOS_RTL_ASSERT(point1->IsLessThan(point2) == datum1->StatsAreLessThan(datum2));
+			GPOS_RTL_ASSERT(point1->IsGreaterThan(point2) == datum1->StatsAreGreaterThan(datum2));
+			GPOS_RTL_ASSERT(point1->Distance(point2) == datum1->GetStatsDistanceFrom(datum2));
+		}
+	}
+
+	for (ULONG ul = 0; ul <= ulValues; ul++)
+	{
+		rgppoint[ul]->Release();
+	}
+
+	return GPOS_OK;
+}
+
 // EOF
 
@@ -64,6 +64,7 @@ CStatisticsTest::EresUnittest()
 		{
 		GPOS_UNITTEST_FUNC(CStatisticsTest::EresUnittest_CStatisticsBasic),
 		GPOS_UNITTEST_FUNC(CStatisticsTest::EresUnittest_UnionAll),
+		GPOS_UNITTEST_FUNC(CStatisticsTest::EresUnittest_Width),
 		// TODO,  Mar 18 2013 temporarily disabling the test
 		// GPOS_UNITTEST_FUNC(CStatisticsTest::EresUnittest_CStatisticsSelectDerivation),
 		};
@@ -201,6 +202,86 @@ CStatisticsTest::EresUnittest_UnionAll()
 	return GPOS_OK;
 }
 
+// width of column sets, with widths looked up in the dense widths array and
+// in the width map, and with columns falling back to their type width
+GPOS_RESULT
+CStatisticsTest::EresUnittest_Width()
+{
+	CAutoMemoryPool amp;
+	CMemoryPool *mp = amp.Pmp();
+
+	CColumnFactory *col_factory = COptCtxt::PoctxtFromTLS()->Pcf();
+	const IMDTypeInt4 *pmdtypeint4 = COptCtxt::PoctxtFromTLS()->Pmda()->PtMDType<IMDTypeInt4>();
+
+	CColRef *pcrFst = col_factory->PcrCreate(pmdtypeint4, default_type_modifier);
+	CColRef *pcrSnd = col_factory->PcrCreate(pmdtypeint4, default_type_modifier);
+	CColRef *pcrNoWidth = col_factory->PcrCreate(pmdtypeint4, default_type_modifier);
+	const DOUBLE dTypeWidth = CStatisticsUtils::DefaultColumnWidth(pmdtypeint4).Get();
+
+	// a sparse column id makes the second stats object fall back to the width map
+	const ULONG ulSparseColId = pcrSnd->Id() + 1000;
+	const ULONG rgulWidthColIds[][2] =
+		{
+		{pcrFst->Id(), pcrSnd->Id()},
+		{pcrFst->Id(), ulSparseColId},
+		};
+
+	CColRefSet *pcrs = GPOS_NEW(mp) CColRefSet(mp);
+	pcrs->Include(pcrFst);
+	pcrs->Include(pcrNoWidth);
+
+	ULongPtrArray *colids = GPOS_NEW(mp) ULongPtrArray(mp);
+	pcrs->ExtractColIds(mp, colids);
+
+	for (ULONG ul = 0; ul < GPOS_ARRAY_SIZE(rgulWidthColIds); ul++)
+	{
+		UlongToDoubleMap *colid_width_mapping = GPOS_NEW(mp) UlongToDoubleMap(mp);
+		colid_width_mapping->Insert(GPOS_NEW(mp) ULONG(rgulWidthColIds[ul][0]), GPOS_NEW(mp) CDouble(1.0));
+		colid_width_mapping->Insert(GPOS_NEW(mp) ULONG(rgulWidthColIds[ul][1]), GPOS_NEW(mp) CDouble(4.5));
+
+		CStatistics *stats = GPOS_NEW(mp) CStatistics
+											(
+											mp,
+											GPOS_NEW(mp) UlongToHistogramMap(mp),
+											colid_width_mapping,
+											1000.0 /* rows */,
+											false /* is_empty */
+											);
+
+		CDouble dExpected = CDouble(1.0 + dTypeWidth).Ceil();
+		GPOS_RTL_ASSERT(dExpected == stats->Width(mp, pcrs));
+		GPOS_RTL_ASSERT(dExpected == stats->Width(colids));
+
+		// widths of column sets not intersecting the stats object
+		CColRefSet *pcrsNoWidth = GPOS_NEW(mp) CColRefSet(mp);
+		pcrsNoWidth->Include(pcrNoWidth);
+		GPOS_RTL_ASSERT(CDouble(dTypeWidth).Ceil() == stats->Width(mp, pcrsNoWidth));
+		pcrsNoWidth->Release();
+
+		// appending stats adds widths
+		UlongToDoubleMap *colid_width_mapping_append = GPOS_NEW(mp) UlongToDoubleMap(mp);
+		colid_width_mapping_append->Insert(GPOS_NEW(mp) ULONG(pcrNoWidth->Id()), GPOS_NEW(mp) CDouble(2.0));
+		CStatistics *stats_append = GPOS_NEW(mp) CStatistics
+											(
+											mp,
+											GPOS_NEW(mp) UlongToHistogramMap(mp),
+											colid_width_mapping_append,
+											1000.0 /* rows */,
+											false /* is_empty */
+											);
+		stats->AppendStats(mp, stats_append);
+		GPOS_RTL_ASSERT(CDouble(3.0) == stats->Width(mp, pcrs));
+
+		stats_append->Release();
+		stats->Release();
+	}
+
+	colids->Release();
+	pcrs->Release();
+
+	return GPOS_OK;
+}
+
 // gbAgg test when grouping on repeated columns
 GPOS_RESULT
 CStatisticsTest::EresUnittest_GbAggWithRepeatedGbCols()
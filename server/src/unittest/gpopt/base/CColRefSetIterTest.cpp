@@ -9,6 +9,9 @@
 //		Test of ColRefSet iterator
 //---------------------------------------------------------------------------
 
+#include "gpos/common/CWallClock.h"
+#include "gpos/error/CAutoTrace.h"
+
 #include "gpopt/base/CColumnFactory.h"
 #include "gpopt/base/CColRefSetIter.h"
 #include "gpopt/mdcache/CMDCache.h"
@@ -36,7 +39,8 @@ CColRefSetIterTest::EresUnittest()
 {
 	CUnittest rgut[] =
 		{
-		GPOS_UNITTEST_FUNC(CColRefSetIterTest::EresUnittest_Basics)
+		GPOS_UNITTEST_FUNC(CColRefSetIterTest::EresUnittest_Basics),
+		GPOS_UNITTEST_FUNC(CColRefSetIterTest::EresUnittest_IterationTime)
 		};
 
 	return CUnittest::EresExecute(rgut, GPOS_ARRAY_SIZE(rgut));
@@ -117,4 +121,75 @@ CColRefSetIterTest::EresUnittest_Basics()
 	return GPOS_OK;
 }
 
+//---------------------------------------------------------------------------
+//	@function:
+//		CColRefSetIterTest::EresUnittest_IterationTime
+//
+//	@doc:
+//		Microbenchmark of colref decoding; repeatedly iterates over a large
+//		set of column references and reports the elapsed time
+//
+//---------------------------------------------------------------------------
+GPOS_RESULT
+CColRefSetIterTest::EresUnittest_IterationTime()
+{
+	CAutoMemoryPool amp;
+	CMemoryPool *mp = amp.Pmp();
+
+	// Setup an MD cache with a file-based provider
+	CMDProviderMemory *pmdp = CTestUtils::m_pmdpf;
+	pmdp->AddRef();
+	CMDAccessor mda(mp, CMDCache::Pcache());
+	mda.RegisterProvider(CTestUtils::m_sysidDefault, pmdp);
+
+	// install opt context in TLS
+	CAutoOptCtxt aoc
+				(
+				mp,
+				&mda,
+				NULL /* pceeval */,
+				CTestUtils::GetCostModel(mp)
+				);
+
+	CColumnFactory *col_factory = COptCtxt::PoctxtFromTLS()->Pcf();
+	const IMDTypeInt4 *pmdtypeint4 = mda.PtMDType<IMDTypeInt4>();
+
+	// span several chunks of the id-indexed table of the column factory
+	const ULONG num_cols = 3 * GPOPT_COLFACTORY_CHUNK_SIZE;
+	const ULONG num_iterations = 1000;
+
+	CColRefSet *pcrs = GPOS_NEW(mp) CColRefSet(mp);
+	for (ULONG ul = 0; ul < num_cols; ul++)
+	{
+		pcrs->Include(col_factory->PcrCreate(pmdtypeint4, default_type_modifier));
+	}
+
+	CWallClock clock;
+	ULONG count = 0;
+	for (ULONG ul = 0; ul < num_iterations; ul++)
+	{
+		CColRefSetIter crsi(*pcrs);
+		while (crsi.Advance())
+		{
+			CColRef *colref = crsi.Pcr();
+			GPOS_RTL_ASSERT(NULL != colref);
+			GPOS_RTL_ASSERT(crsi.Bit() == colref->Id());
+
+			count++;
+		}
+	}
+	ULONG ulElapsed = clock.ElapsedMS();
+
+	GPOS_RTL_ASSERT(num_cols * num_iterations == count);
+
+	{
+		CAutoTrace at(mp);
+		at.Os() << "Decoded " << count << " column references in " << ulElapsed << "ms";
+	}
+
+	pcrs->Release();
+
+	return GPOS_OK;
+}
+
 // EOF
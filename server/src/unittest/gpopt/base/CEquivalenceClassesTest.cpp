@@ -4,6 +4,7 @@
 //---------------------------------------------------------------------------
 #include "gpopt/base/CColRefSet.h"
 #include "gpopt/base/CColRefSetIter.h"
+#include "gpopt/base/CColRefUnionFind.h"
 #include "gpopt/base/CColumnFactory.h"
 #include "gpopt/mdcache/CMDCache.h"
 #include "gpopt/base/CQueryContext.h"
@@ -25,7 +26,8 @@ CEquivalenceClassesTest::EresUnittest()
 	CUnittest rgut[] =
 		{
 		GPOS_UNITTEST_FUNC(CEquivalenceClassesTest::EresUnittest_NotDisjointEquivalanceClasses),
-		GPOS_UNITTEST_FUNC(CEquivalenceClassesTest::EresUnittest_IntersectEquivalanceClasses)
+		GPOS_UNITTEST_FUNC(CEquivalenceClassesTest::EresUnittest_IntersectEquivalanceClasses),
+		GPOS_UNITTEST_FUNC(CEquivalenceClassesTest::EresUnittest_MergeEquivalanceClasses)
 		};
 
 	return CUnittest::EresExecute(rgut, GPOS_ARRAY_SIZE(rgut));
@@ -171,4 +173,120 @@ CEquivalenceClassesTest::EresUnittest_IntersectEquivalanceClasses()
 
 	return GPOS_OK;
 }
+
+// Check merged equivalence classes, and their order, match adding the classes
+// one at a time
+GPOS_RESULT
+CEquivalenceClassesTest::EresUnittest_MergeEquivalanceClasses()
+{
+	CAutoMemoryPool amp;
+	CMemoryPool *mp = amp.Pmp();
+
+	// Setup an MD cache with a file-based provider
+	CMDProviderMemory *pmdp = CTestUtils::m_pmdpf;
+	pmdp->AddRef();
+	CMDAccessor mda(mp, CMDCache::Pcache());
+	mda.RegisterProvider(CTestUtils::m_sysidDefault, pmdp);
+
+	// install opt context in TLS
+	CAutoOptCtxt aoc
+				(
+				mp,
+				&mda,
+				NULL, /* pceeval */
+				CTestUtils::GetCostModel(mp)
+				);
+
+	// get column factory from optimizer context object
+	CColumnFactory *col_factory = COptCtxt::PoctxtFromTLS()->Pcf();
+
+	CWStringConst strName(GPOS_WSZ_LIT("Test Column"));
+	CName name(&strName);
+
+	const IMDTypeInt4 *pmdtypeint4 = mda.PtMDType<IMDTypeInt4>();
+
+	const ULONG num_cols = 11;
+	CColRef *rgpcr[num_cols];
+	for (ULONG i = 0; i < num_cols; i++)
+	{
+		rgpcr[i] = col_factory->PcrCreate(pmdtypeint4, default_type_modifier, name);
+	}
+
+	// {c0,c1} {c2,c3} {c4,c5} {c6}
+	ULONG rgulFirst[][3] = {{0, 1, 2}, {2, 3, 2}, {4, 5, 2}, {6, 6, 1}};
+
+	// {c1,c2} {c7,c8} {c5,c9}
+	ULONG rgulSecond[][3] = {{1, 2, 2}, {7, 8, 2}, {5, 9, 2}};
+
+	// {c6} {c0,c1,c2,c3} {c7,c8} {c4,c5,c9}
+	ULONG rgulExpected[][4] = {{6, 6, 6, 6}, {0, 1, 2, 3}, {7, 8, 8, 8}, {4, 5, 9, 9}};
+
+	CColRefSetArray *pdrgpcrsFirst = GPOS_NEW(mp) CColRefSetArray(mp);
+	for (ULONG ul = 0; ul < GPOS_ARRAY_SIZE(rgulFirst); ul++)
+	{
+		CColRefSet *pcrs = GPOS_NEW(mp) CColRefSet(mp);
+		pcrs->Include(rgpcr[rgulFirst[ul][0]]);
+		pcrs->Include(rgpcr[rgulFirst[ul][1]]);
+		pdrgpcrsFirst->Append(pcrs);
+	}
+
+	CColRefSetArray *pdrgpcrsSecond = GPOS_NEW(mp) CColRefSetArray(mp);
+	for (ULONG ul = 0; ul < GPOS_ARRAY_SIZE(rgulSecond); ul++)
+	{
+		CColRefSet *pcrs = GPOS_NEW(mp) CColRefSet(mp);
+		pcrs->Include(rgpcr[rgulSecond[ul][0]]);
+		pcrs->Include(rgpcr[rgulSecond[ul][1]]);
+		pdrgpcrsSecond->Append(pcrs);
+	}
+
+	CColRefSetArray *pdrgpcrsExpected = GPOS_NEW(mp) CColRefSetArray(mp);
+	for (ULONG ul = 0; ul < GPOS_ARRAY_SIZE(rgulExpected); ul++)
+	{
+		CColRefSet *pcrs = GPOS_NEW(mp) CColRefSet(mp);
+		for (ULONG ulCol = 0; ulCol < 4; ulCol++)
+		{
+			pcrs->Include(rgpcr[rgulExpected[ul][ulCol]]);
+		}
+		pdrgpcrsExpected->Append(pcrs);
+	}
+
+	CColRefSetArray *pdrgpcrsMerged = CUtils::PdrgpcrsMergeEquivClasses(mp, pdrgpcrsFirst, pdrgpcrsSecond);
+	GPOS_RTL_ASSERT(CUtils::FEquivalanceClassesDisjoint(mp, pdrgpcrsMerged));
+	GPOS_RTL_ASSERT(pdrgpcrsExpected->Size() == pdrgpcrsMerged->Size());
+	for (ULONG ul = 0; ul < pdrgpcrsExpected->Size(); ul++)
+	{
+		GPOS_RTL_ASSERT((*pdrgpcrsExpected)[ul]->Equals((*pdrgpcrsMerged)[ul]));
+	}
+
+	// the input classes are left unchanged
+	GPOS_RTL_ASSERT(2 == (*pdrgpcrsFirst)[0]->Size());
+	GPOS_RTL_ASSERT(2 == (*pdrgpcrsSecond)[0]->Size());
+
+	// membership queries
+	CColRefUnionFind *pcruf = GPOS_NEW(mp) CColRefUnionFind(mp);
+	pcruf->AddEquivClasses(pdrgpcrsFirst);
+	pcruf->AddEquivClasses(pdrgpcrsSecond);
+
+	CColRefSet *pcrs = GPOS_NEW(mp) CColRefSet(mp);
+	pcrs->Include(rgpcr[0]);
+	pcrs->Include(rgpcr[3]);
+	GPOS_RTL_ASSERT(pcruf->FSameClass(pcrs));
+
+	pcrs->Include(rgpcr[4]);
+	GPOS_RTL_ASSERT(!pcruf->FSameClass(pcrs));
+
+	pcrs->Release();
+	pcrs = GPOS_NEW(mp) CColRefSet(mp);
+	pcrs->Include(rgpcr[10]);
+	GPOS_RTL_ASSERT(!pcruf->FSameClass(pcrs));
+
+	pcrs->Release();
+	pcruf->Release();
+	pdrgpcrsMerged->Release();
+	pdrgpcrsExpected->Release();
+	pdrgpcrsSecond->Release();
+	pdrgpcrsFirst->Release();
+
+	return GPOS_OK;
+}
 // EOF
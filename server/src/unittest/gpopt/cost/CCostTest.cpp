@@ -17,7 +17,9 @@
 #include "gpopt/eval/CConstExprEvaluatorDefault.h"
 #include "gpopt/minidump/CMinidumperUtils.h"
 #include "gpopt/optimizer/COptimizerConfig.h"
+#include "gpopt/operators/CLogicalGet.h"
 #include "gpopt/operators/CLogicalInnerJoin.h"
+#include "gpopt/operators/CScalarProjectList.h"
 
 #include "naucrates/dxl/CDXLUtils.h"
 #include "naucrates/dxl/parser/CParseHandlerDXL.h"
@@ -47,6 +49,8 @@ CCostTest::EresUnittest()
 		GPOS_UNITTEST_FUNC(CCostTest::EresUnittest_Params),
 		GPOS_UNITTEST_FUNC(CCostTest::EresUnittest_Parsing),
 		GPOS_UNITTEST_FUNC(EresUnittest_SetParams),
+		GPOS_UNITTEST_FUNC(EresUnittest_SkewedHosts),
+		GPOS_UNITTEST_FUNC(EresUnittest_SkewedPlan),
 
 		// TODO: : re-enable test after resolving exception throwing problem on OSX
 		// GPOS_UNITTEST_FUNC_THROW(CCostTest::EresUnittest_ParsingWithException, gpdxl::ExmaDXL, gpdxl::ExmiDXLUnexpectedTag),
@@ -417,4 +421,136 @@ CCostTest::EresUnittest_SetParams()
 	return GPOS_OK;
 }
 
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CCostTest::EresUnittest_SkewedHosts
+//
+//	@doc:
+//		Test rows per host of skewed hash distributions under different
+//		values of the skew weight param
+//
+//---------------------------------------------------------------------------
+GPOS_RESULT
+CCostTest::EresUnittest_SkewedHosts()
+{
+	CAutoMemoryPool amp;
+	CMemoryPool *mp = amp.Pmp();
+
+	CCostModelGPDB *pcm = GPOS_NEW(mp) CCostModelGPDB(mp, GPOPT_TEST_SEGMENTS);
+	ICostModelParams *pcp = pcm->GetCostModelParams();
+	GPOS_RTL_ASSERT(NULL != pcp->PcpLookup("HashSkewWeight"));
+
+	const CDouble dRows(1000.0);
+	const CDouble dMaxValueFreq(0.5);
+	const CDouble dRowsAvg = pcm->DRowsPerHost(dRows);
+	const CDouble dRowsMax = dRows * (dMaxValueFreq + (1.0 - dMaxValueFreq) / GPOPT_TEST_SEGMENTS);
+
+	// skew is not costed by default
+	GPOS_RTL_ASSERT(dRowsAvg == pcm->DRowsMaxHost(dRows, dMaxValueFreq));
+
+	// cost by the most loaded host
+	pcp->SetParam(CCostModelParamsGPDB::EcpHashSkewWeight, 1.0, 0.0, 1.0);
+	GPOS_RTL_ASSERT(dRowsMax == pcm->DRowsMaxHost(dRows, dMaxValueFreq));
+
+	// unknown skew
+	GPOS_RTL_ASSERT(dRowsAvg == pcm->DRowsMaxHost(dRows, CDouble(0.0)));
+
+	// halfway between the average and the most loaded host
+	pcp->SetParam(CCostModelParamsGPDB::EcpHashSkewWeight, 0.5, 0.0, 1.0);
+	GPOS_RTL_ASSERT((dRowsAvg + dRowsMax) / 2.0 == pcm->DRowsMaxHost(dRows, dMaxValueFreq));
+
+	{
+		CAutoTrace at(mp);
+		at.Os() << "Rows per host: average " << dRowsAvg << ", most loaded host " << dRowsMax;
+	}
+
+	pcm->Release();
+
+	return GPOS_OK;
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CCostTest::EresUnittest_SkewedPlan
+//
+//	@doc:
+//		Test that the skew weight param, set by name, is taken into account
+//		by plan search; grouping on a skewed column redistributes the input
+//		on that column, so the best plan gets more expensive once the most
+//		loaded host is costed
+//
+//---------------------------------------------------------------------------
+GPOS_RESULT
+CCostTest::EresUnittest_SkewedPlan()
+{
+	CAutoMemoryPool amp;
+	CMemoryPool *mp = amp.Pmp();
+
+	// setup a file-based provider
+	CMDProviderMemory *pmdp = CTestUtils::m_pmdpf;
+	pmdp->AddRef();
+	CMDAccessor mda(mp, CMDCache::Pcache(), CTestUtils::m_sysidDefault, pmdp);
+
+	ICostModel *pcm = GPOS_NEW(mp) CCostModelGPDB(mp, GPOPT_TEST_SEGMENTS);
+
+	// install opt context in TLS
+	CAutoOptCtxt aoc(mp, &mda, NULL, /* pceeval */ pcm);
+
+	// group by the first column of the test table, the histogram of which
+	// has a value holding a quarter of the rows
+	CExpression *pexprGet = CTestUtils::PexprLogicalGet(mp);
+	CColRefArray *colref_array = GPOS_NEW(mp) CColRefArray(mp);
+	colref_array->Append((*CLogicalGet::PopConvert(pexprGet->Pop())->PdrgpcrOutput())[0]);
+	CExpression *pexpr = CUtils::PexprLogicalGbAggGlobal
+						(
+						mp,
+						colref_array,
+						pexprGet,
+						GPOS_NEW(mp) CExpression(mp, GPOS_NEW(mp) CScalarProjectList(mp))
+						);
+
+	// optimize with the default weight, then costing the most loaded host
+	const CDouble rgdWeight[] = {CDouble(0.0), CDouble(1.0)};
+	CExpression *rgpexprPlan[GPOS_ARRAY_SIZE(rgdWeight)];
+	for (ULONG ul = 0; ul < GPOS_ARRAY_SIZE(rgdWeight); ul++)
+	{
+		ICostModelParams::SCostParam *pcp = pcm->GetCostModelParams()->PcpLookup("HashSkewWeight");
+		GPOS_RTL_ASSERT(NULL != pcp);
+		pcm->GetCostModelParams()->SetParam(pcp->Id(), rgdWeight[ul], pcp->GetLowerBoundVal(), pcp->GetUpperBoundVal());
+
+		CEngine eng(mp);
+
+		// generate query context
+		CQueryContext *pqc = CTestUtils::PqcGenerate(mp, pexpr);
+
+		// Initialize engine
+		eng.Init(pqc, NULL /*search_stage_array*/);
+
+		// optimize query
+		eng.Optimize();
+
+		// extract plan
+		rgpexprPlan[ul] = eng.PexprExtractPlan();
+		GPOS_ASSERT(NULL != rgpexprPlan[ul]);
+
+		GPOS_DELETE(pqc);
+	}
+
+	{
+		CAutoTrace at(mp);
+		at.Os() << "\nPLAN WITHOUT SKEW: \n" << *rgpexprPlan[0];
+		at.Os() << "\nPLAN WITH SKEW: \n" << *rgpexprPlan[1];
+	}
+	GPOS_RTL_ASSERT(rgpexprPlan[1]->Cost() > rgpexprPlan[0]->Cost());
+
+	// clean up
+	pexpr->Release();
+	rgpexprPlan[0]->Release();
+	rgpexprPlan[1]->Release();
+
+	return GPOS_OK;
+}
+
 // EOF
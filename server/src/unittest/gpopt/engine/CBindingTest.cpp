@@ -8,6 +8,9 @@
 //	@doc:
 //		Test for checking bindings extracted for an expression
 //---------------------------------------------------------------------------
+#include "gpos/common/CWallClock.h"
+#include "gpos/task/CAutoTraceFlag.h"
+
 #include "gpopt/engine/CEngine.h"
 #include "gpopt/minidump/CMinidumperUtils.h"
 #include "gpopt/translate/CTranslatorDXLToExpr.h"
@@ -19,16 +22,123 @@
 static
 const CHAR *szQueryFile= "../data/dxl/minidump/ExtractOneBindingFromScalarGroups.mdp";
 
+static
+const CHAR *szJoinQueryFile= "../data/dxl/minidump/TPCH-Q5.mdp";
+
+// xforms binding static patterns
+static
+const CXform::EXformId rgexfidStatic[] =
+	{
+	CXform::ExfJoinCommutativity,
+	CXform::ExfJoinAssociativity,
+	CXform::ExfInnerJoin2HashJoin,
+	CXform::ExfInnerJoin2NLJoin,
+	CXform::ExfExpandNAryJoinDPv2
+	};
+
 GPOS_RESULT
 CBindingTest::EresUnittest()
 {
 	CUnittest rgut[] =
 		{
-		GPOS_UNITTEST_FUNC(CBindingTest::EresUnittest_Basic)
+		GPOS_UNITTEST_FUNC(CBindingTest::EresUnittest_Basic),
+		GPOS_UNITTEST_FUNC(CBindingTest::EresUnittest_StaticBinding),
+		GPOS_UNITTEST_FUNC(CBindingTest::EresUnittest_DuplicateBindings)
 		};
 
 	return CUnittest::EresExecute(rgut, GPOS_ARRAY_SIZE(rgut));
 }
+//---------------------------------------------------------------------------
+//	@function:
+//		CBindingTest::OptimizeMinidump
+//
+//	@doc:
+//		Optimize the query in the given minidump and return the number of
+//		bindings of the given xforms in the first search stage, and the
+//		number of bindings blocked as duplicates
+//
+//---------------------------------------------------------------------------
+void
+CBindingTest::OptimizeMinidump
+	(
+	CMemoryPool *mp,
+	const CHAR *szFileName,
+	const CXform::EXformId *rgexfid,
+	ULONG ulXforms,
+	ULONG *rgulBindings, // output: number of bindings of each xform
+	ULONG_PTR *pulpBlocked // output: number of duplicate bindings blocked
+	)
+{
+	// load dump file
+	CDXLMinidump *pdxlmd = CMinidumperUtils::PdxlmdLoad(mp, szFileName);
+	GPOS_CHECK_ABORT;
+
+	// set up MD providers
+	CMDProviderMemory *pmdp = GPOS_NEW(mp) CMDProviderMemory(mp, szFileName);
+	pmdp->AddRef();
+
+	const CSystemIdArray *pdrgpsysid = pdxlmd->GetSysidPtrArray();
+	CMDProviderArray *pdrgpmdp = GPOS_NEW(mp) CMDProviderArray(mp);
+	pdrgpmdp->Append(pmdp);
+
+	for (ULONG ul = 1; ul < pdrgpsysid->Size(); ul++)
+	{
+		pmdp->AddRef();
+		pdrgpmdp->Append(pmdp);
+	}
+
+	CMDAccessor mda(mp, CMDCache::Pcache(), pdrgpsysid, pdrgpmdp);
+
+	CBitSet *pbsEnabled = NULL;
+	CBitSet *pbsDisabled = NULL;
+	SetTraceflags(mp, pdxlmd->Pbs(), &pbsEnabled, &pbsDisabled);
+
+	// setup opt ctx
+	CAutoOptCtxt aoc(mp, &mda, NULL /* pceeval */, CTestUtils::GetCostModel(mp));
+
+	// translate DXL Tree -> Expr Tree
+	CTranslatorDXLToExpr *pdxltr = GPOS_NEW(mp) CTranslatorDXLToExpr(mp, &mda);
+	CExpression *pexprTranslated =	pdxltr->PexprTranslateQuery
+	                                     (
+	                                     pdxlmd->GetQueryDXLRoot(),
+	                                     pdxlmd->PdrgpdxlnQueryOutput(),
+	                                     pdxlmd->GetCTEProducerDXLArray()
+	                                     );
+
+	gpdxl::ULongPtrArray *pdrgul = pdxltr->PdrgpulOutputColRefs();
+	gpmd::CMDNameArray *pdrgpmdname = pdxltr->Pdrgpmdname();
+
+	CQueryContext *pqc = CQueryContext::PqcGenerate(mp, pexprTranslated, pdrgul, pdrgpmdname, true /*fDeriveStats*/);
+
+	// initialize engine and optimize query
+	CEngine eng(mp);
+	eng.Init(pqc, NULL /*search_stage_array*/);
+	eng.Optimize();
+
+	// extract plan
+	CExpression *pexprPlan = eng.PexprExtractPlan();
+	GPOS_ASSERT(NULL != pexprPlan);
+
+	UlongPtrArray *number_of_bindings = eng.GetNumberOfBindings();
+	ULONG search_stage = 0;
+	for (ULONG ul = 0; ul < ulXforms; ul++)
+	{
+		rgulBindings[ul] = (ULONG) (*number_of_bindings)[search_stage][rgexfid[ul]];
+	}
+	*pulpBlocked = COptCtxt::PoctxtFromTLS()->UlpCounter(COptCtxt::EocDuplicateBindingsBlocked);
+
+	// clean up
+	pexprPlan->Release();
+	pdrgpmdp->Release();
+	GPOS_DELETE(pqc);
+	GPOS_DELETE(pdxlmd);
+	GPOS_DELETE(pdxltr);
+	pexprTranslated->Release();
+	pmdp->Release();
+	CRefCount::SafeRelease(pbsEnabled);
+	CRefCount::SafeRelease(pbsDisabled);
+}
+
 // Consider the below input query tree:
 // +--CLogicalInnerJoin
 //    |--CLogicalGet "t1"
@@ -92,74 +202,106 @@ CBindingTest::EresUnittest_Basic()
 	CAutoMemoryPool amp(CAutoMemoryPool::ElcNone);
 	CMemoryPool *mp = amp.Pmp();
 
-	// load dump file
-	CDXLMinidump *pdxlmd = CMinidumperUtils::PdxlmdLoad(mp, szQueryFile);
-	GPOS_CHECK_ABORT;
+	const CXform::EXformId exfid = CXform::ExfInnerJoinWithInnerSelect2IndexGetApply;
+	ULONG bindings_for_xform = 0;
+	ULONG_PTR ulpBlocked = 0;
+	OptimizeMinidump(mp, szQueryFile, &exfid, 1 /*ulXforms*/, &bindings_for_xform, &ulpBlocked);
 
-	// set up MD providers
-	CMDProviderMemory *pmdp = GPOS_NEW(mp) CMDProviderMemory(mp, szQueryFile);
-	pmdp->AddRef();
+	GPOS_RESULT eres = GPOS_FAILED;
 
-	const CSystemIdArray *pdrgpsysid = pdxlmd->GetSysidPtrArray();
-	CMDProviderArray *pdrgpmdp = GPOS_NEW(mp) CMDProviderArray(mp);
-	pdrgpmdp->Append(pmdp);
+	if (bindings_for_xform == EXPECTED_BINDING)
+		eres = GPOS_OK;
 
-	for (ULONG ul = 1; ul < pdrgpsysid->Size(); ul++)
-	{
-		pmdp->AddRef();
-		pdrgpmdp->Append(pmdp);
-	}
+	return eres;
+}
 
-	CMDAccessor mda(mp, CMDCache::Pcache(), pdrgpsysid, pdrgpmdp);
+//---------------------------------------------------------------------------
+//	@function:
+//		CBindingTest::EresUnittest_StaticBinding
+//
+//	@doc:
+//		Check that xforms with static patterns extract the same bindings
+//		as the interpreted binder, and print the optimization time of both
+//
+//---------------------------------------------------------------------------
+GPOS_RESULT
+CBindingTest::EresUnittest_StaticBinding()
+{
+	CAutoMemoryPool amp(CAutoMemoryPool::ElcNone);
+	CMemoryPool *mp = amp.Pmp();
 
-	CBitSet *pbsEnabled = NULL;
-	CBitSet *pbsDisabled = NULL;
-	SetTraceflags(mp, pdxlmd->Pbs(), &pbsEnabled, &pbsDisabled);
+	const ULONG ulXforms = GPOS_ARRAY_SIZE(rgexfidStatic);
+	ULONG rgulStatic[GPOS_ARRAY_SIZE(rgexfidStatic)];
+	ULONG rgulInterpreted[GPOS_ARRAY_SIZE(rgexfidStatic)];
+	ULONG_PTR ulpBlocked = 0;
 
-	// setup opt ctx
-	CAutoOptCtxt aoc(mp, &mda, NULL /* pceeval */, CTestUtils::GetCostModel(mp));
+	CWallClock clock;
+	OptimizeMinidump(mp, szJoinQueryFile, rgexfidStatic, ulXforms, rgulStatic, &ulpBlocked);
+	ULONG ulElapsedStatic = clock.ElapsedMS();
 
-	// translate DXL Tree -> Expr Tree
-	CTranslatorDXLToExpr *pdxltr = GPOS_NEW(mp) CTranslatorDXLToExpr(mp, &mda);
-	CExpression *pexprTranslated =	pdxltr->PexprTranslateQuery
-	                                     (
-	                                     pdxlmd->GetQueryDXLRoot(),
-	                                     pdxlmd->PdrgpdxlnQueryOutput(),
-	                                     pdxlmd->GetCTEProducerDXLArray()
-	                                     );
+	{
+		CAutoTraceFlag atf(EopttraceDisableStaticBinding, true /*value*/);
 
-	gpdxl::ULongPtrArray *pdrgul = pdxltr->PdrgpulOutputColRefs();
-	gpmd::CMDNameArray *pdrgpmdname = pdxltr->Pdrgpmdname();
+		clock.Restart();
+		OptimizeMinidump(mp, szJoinQueryFile, rgexfidStatic, ulXforms, rgulInterpreted, &ulpBlocked);
+	}
+	ULONG ulElapsedInterpreted = clock.ElapsedMS();
 
-	CQueryContext *pqc = CQueryContext::PqcGenerate(mp, pexprTranslated, pdrgul, pdrgpmdname, true /*fDeriveStats*/);
+	CAutoTrace at(mp);
+	IOstream &os(at.Os());
+	os << "Optimization time, static binding: " << ulElapsedStatic
+		<< "ms, interpreted binding: " << ulElapsedInterpreted << "ms" << std::endl;
 
-	// initialize engine and optimize query
-	CEngine eng(mp);
-	eng.Init(pqc, NULL /*search_stage_array*/);
-	eng.Optimize();
+	for (ULONG ul = 0; ul < ulXforms; ul++)
+	{
+		if (rgulStatic[ul] != rgulInterpreted[ul])
+		{
+			os << "Mismatching bindings for xform " << rgexfidStatic[ul]
+				<< ": " << rgulStatic[ul] << " vs. " << rgulInterpreted[ul] << std::endl;
+			return GPOS_FAILED;
+		}
+	}
 
-	// extract plan
-	CExpression *pexprPlan = eng.PexprExtractPlan();
-	GPOS_ASSERT(NULL != pexprPlan);
+	return GPOS_OK;
+}
+//---------------------------------------------------------------------------
+//	@function:
+//		CBindingTest::EresUnittest_DuplicateBindings
+//
+//	@doc:
+//		Check that associativity bindings undoing an earlier associativity
+//		step are blocked, and that blocking them does not add bindings
+//
+//---------------------------------------------------------------------------
+GPOS_RESULT
+CBindingTest::EresUnittest_DuplicateBindings()
+{
+	CAutoMemoryPool amp(CAutoMemoryPool::ElcNone);
+	CMemoryPool *mp = amp.Pmp();
 
-	UlongPtrArray *number_of_bindings = eng.GetNumberOfBindings();
-	ULONG search_stage = 0;
-	ULONG bindings_for_xform = (ULONG) (*number_of_bindings)[search_stage][CXform::ExfInnerJoinWithInnerSelect2IndexGetApply];
+	const CXform::EXformId exfid = CXform::ExfJoinAssociativity;
+	ULONG ulBindings = 0;
+	ULONG ulBindingsUnblocked = 0;
+	ULONG_PTR ulpBlocked = 0;
+	ULONG_PTR ulpBlockedUnblocked = 0;
 
-	GPOS_RESULT eres = GPOS_FAILED;
+	OptimizeMinidump(mp, szJoinQueryFile, &exfid, 1 /*ulXforms*/, &ulBindings, &ulpBlocked);
+	{
+		CAutoTraceFlag atf(EopttraceDisableDuplicateBindingBlocking, true /*value*/);
+		OptimizeMinidump(mp, szJoinQueryFile, &exfid, 1 /*ulXforms*/, &ulBindingsUnblocked, &ulpBlockedUnblocked);
+	}
 
-	if (bindings_for_xform == EXPECTED_BINDING)
-		eres = GPOS_OK;
+	CAutoTrace at(mp);
+	at.Os() << "Duplicate bindings blocked: " << ulpBlocked
+		<< ", associativity bindings: " << ulBindings
+		<< " vs. " << ulBindingsUnblocked << " without blocking" << std::endl;
 
-	// clean up
-	pexprPlan->Release();
-	pdrgpmdp->Release();
-	GPOS_DELETE(pqc);
-	GPOS_DELETE(pdxlmd);
-	GPOS_DELETE(pdxltr);
-	pexprTranslated->Release();
-	pmdp->Release();
+	if (0 == ulpBlocked || 0 != ulpBlockedUnblocked || ulBindings > ulBindingsUnblocked)
+	{
+		return GPOS_FAILED;
+	}
 
-	return eres;
+	return GPOS_OK;
 }
+
 // EOF
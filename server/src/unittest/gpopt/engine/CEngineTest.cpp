@@ -8,6 +8,8 @@
 //	@doc:
 //		Test for CEngine
 //---------------------------------------------------------------------------
+#include "gpos/io/COstreamString.h"
+#include "gpos/string/CWStringDynamic.h"
 #include "gpos/task/CAutoTraceFlag.h"
 
 #include "gpopt/base/CUtils.h"
@@ -43,6 +45,11 @@ CEngineTest::EresUnittest()
 #ifdef GPOS_DEBUG
 		GPOS_UNITTEST_FUNC(EresUnittest_BuildMemo),
 		GPOS_UNITTEST_FUNC(EresUnittest_AppendStats),
+		GPOS_UNITTEST_FUNC(EresUnittest_SpacePruning),
+		GPOS_UNITTEST_FUNC(EresUnittest_CostReuse),
+		GPOS_UNITTEST_FUNC(EresUnittest_CostEquivalentReuse),
+		GPOS_UNITTEST_FUNC(EresUnittest_PlanPropsReuse),
+		GPOS_UNITTEST_FUNC(EresUnittest_LazyCostTables),
 		GPOS_UNITTEST_FUNC(EresUnittest_BuildMemoWithSubqueries),
 		GPOS_UNITTEST_FUNC(EresUnittest_BuildMemoWithGrouping),
 		GPOS_UNITTEST_FUNC(EresUnittest_BuildMemoWithTVF),
@@ -343,6 +350,282 @@ CEngineTest::EresUnittest_AppendStats()
 }
 
 
+//---------------------------------------------------------------------------
+//	@function:
+//		CEngineTest::CostOptimize
+//
+//	@doc:
+//		Optimize the expression returned by the given generator in a new
+//		optimization context; return the cost of the best plan and the
+//		value of the given optimizer counter after optimization, and print
+//		the best plan to the given string if one is passed
+//
+//---------------------------------------------------------------------------
+CCost
+CEngineTest::CostOptimize
+	(
+	CMemoryPool *mp,
+	CMDAccessor *md_accessor,
+	Pfpexpr pf,
+	COptCtxt::EOptCounter eoc,
+	ULONG_PTR *pulpCounter,
+	CWStringDynamic *pstrPlan
+	)
+{
+	GPOS_ASSERT(NULL != pulpCounter);
+
+	// install opt context in TLS
+	CAutoOptCtxt aoc
+					(
+					mp,
+					md_accessor,
+					NULL,  /* pceeval */
+					CTestUtils::GetCostModel(mp)
+					);
+
+	CExpression *pexpr = pf(mp);
+	CQueryContext *pqc = CTestUtils::PqcGenerate(mp, pexpr);
+
+	CEngine eng(mp);
+	eng.Init(pqc, NULL /*search_stage_array*/);
+	eng.Optimize();
+
+	CExpression *pexprPlan = eng.PexprExtractPlan();
+	GPOS_ASSERT(NULL != pexprPlan);
+
+	CCost cost = pexprPlan->Cost();
+	*pulpCounter = COptCtxt::PoctxtFromTLS()->UlpCounter(eoc);
+
+	if (NULL != pstrPlan)
+	{
+		COstreamString oss(pstrPlan);
+		oss << *pexprPlan;
+	}
+
+	pexpr->Release();
+	pexprPlan->Release();
+	GPOS_DELETE(pqc);
+
+	return cost;
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CEngineTest::EresUnittest_SpacePruning
+//
+//	@doc:
+//		Test of pruning optimization requests by cost lower bounds; an
+//		aggregate over a join must have optimization requests pruned, and
+//		pruning must not change the cost of the best plan
+//
+//---------------------------------------------------------------------------
+GPOS_RESULT
+CEngineTest::EresUnittest_SpacePruning()
+{
+	CAutoMemoryPool amp;
+	CMemoryPool *mp = amp.Pmp();
+
+	// setup a file-based provider
+	CMDProviderMemory *pmdp = CTestUtils::m_pmdpf;
+	pmdp->AddRef();
+	CMDAccessor mda(mp, CMDCache::Pcache(), CTestUtils::m_sysidDefault, pmdp);
+
+	ULONG_PTR ulpPrunedFull = 0;
+	CCost costFull = CostOptimize(mp, &mda, CTestUtils::PexprLogicalGbAggOverJoin, COptCtxt::EocCostContextsPruned, &ulpPrunedFull, NULL /*pstrPlan*/);
+
+	ULONG_PTR ulpPruned = 0;
+	CCost costPruned(0.0);
+	{
+		CAutoTraceFlag atf(EopttraceEnableSpacePruning, true /*value*/);
+		costPruned = CostOptimize(mp, &mda, CTestUtils::PexprLogicalGbAggOverJoin, COptCtxt::EocCostContextsPruned, &ulpPruned, NULL /*pstrPlan*/);
+	}
+
+	GPOS_RTL_ASSERT(0 == ulpPrunedFull);
+	GPOS_RTL_ASSERT(0 < ulpPruned);
+	GPOS_RTL_ASSERT(costFull == costPruned);
+
+	return GPOS_OK;
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CEngineTest::EresUnittest_CostReuse
+//
+//	@doc:
+//		Test of reusing cost model inputs of child contexts and costs of
+//		contexts with equal inputs; reuse must happen for an aggregate over
+//		a join, and must not change the cost of the best plan
+//
+//---------------------------------------------------------------------------
+GPOS_RESULT
+CEngineTest::EresUnittest_CostReuse()
+{
+	CAutoMemoryPool amp;
+	CMemoryPool *mp = amp.Pmp();
+
+	// setup a file-based provider
+	CMDProviderMemory *pmdp = CTestUtils::m_pmdpf;
+	pmdp->AddRef();
+	CMDAccessor mda(mp, CMDCache::Pcache(), CTestUtils::m_sysidDefault, pmdp);
+
+	ULONG_PTR ulpResultsReusedOff = 0;
+	CCost costOff(0.0);
+	{
+		CAutoTraceFlag atf(EopttraceDisableCostReuse, true /*value*/);
+		costOff = CostOptimize(mp, &mda, CTestUtils::PexprLogicalGbAggOverJoin, COptCtxt::EocCostResultsReused, &ulpResultsReusedOff, NULL /*pstrPlan*/);
+	}
+
+	ULONG_PTR ulpInputsReused = 0;
+	CCost costInputs = CostOptimize(mp, &mda, CTestUtils::PexprLogicalGbAggOverJoin, COptCtxt::EocCostInputsReused, &ulpInputsReused, NULL /*pstrPlan*/);
+
+	ULONG_PTR ulpResultsReused = 0;
+	CCost costResults = CostOptimize(mp, &mda, CTestUtils::PexprLogicalGbAggOverJoin, COptCtxt::EocCostResultsReused, &ulpResultsReused, NULL /*pstrPlan*/);
+
+	GPOS_RTL_ASSERT(0 == ulpResultsReusedOff);
+	GPOS_RTL_ASSERT(0 < ulpInputsReused);
+	GPOS_RTL_ASSERT(0 < ulpResultsReused);
+	GPOS_RTL_ASSERT(costOff == costInputs);
+	GPOS_RTL_ASSERT(costOff == costResults);
+
+	return GPOS_OK;
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CEngineTest::EresUnittest_CostEquivalentReuse
+//
+//	@doc:
+//		Test of reusing costs of contexts that request different plan
+//		properties from the same child contexts; reuse must happen for an
+//		aggregate over a join, and must not change the best plan or its cost
+//
+//---------------------------------------------------------------------------
+GPOS_RESULT
+CEngineTest::EresUnittest_CostEquivalentReuse()
+{
+	CAutoMemoryPool amp;
+	CMemoryPool *mp = amp.Pmp();
+
+	// setup a file-based provider
+	CMDProviderMemory *pmdp = CTestUtils::m_pmdpf;
+	pmdp->AddRef();
+	CMDAccessor mda(mp, CMDCache::Pcache(), CTestUtils::m_sysidDefault, pmdp);
+
+	CWStringDynamic strPlanOff(mp);
+	ULONG_PTR ulpSavedOff = 0;
+	CCost costOff(0.0);
+	{
+		CAutoTraceFlag atf(EopttraceDisableCostReuse, true /*value*/);
+		costOff = CostOptimize(mp, &mda, CTestUtils::PexprLogicalGbAggOverJoin, COptCtxt::EocCostComputationsSaved, &ulpSavedOff, &strPlanOff);
+	}
+
+	CWStringDynamic strPlanOn(mp);
+	ULONG_PTR ulpSavedOn = 0;
+	CCost costOn = CostOptimize(mp, &mda, CTestUtils::PexprLogicalGbAggOverJoin, COptCtxt::EocCostComputationsSaved, &ulpSavedOn, &strPlanOn);
+
+	GPOS_RTL_ASSERT(0 == ulpSavedOff);
+	GPOS_RTL_ASSERT(0 < ulpSavedOn);
+	GPOS_RTL_ASSERT(costOff == costOn);
+	GPOS_RTL_ASSERT(strPlanOff.Equals(&strPlanOn));
+
+	return GPOS_OK;
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CEngineTest::EresUnittest_PlanPropsReuse
+//
+//	@doc:
+//		Test of deriving plan properties on demand and reusing them across
+//		cost contexts; for an aggregate over a join some properties must be
+//		skipped and some reused, and the best plan must stay the same
+//
+//---------------------------------------------------------------------------
+GPOS_RESULT
+CEngineTest::EresUnittest_PlanPropsReuse()
+{
+	CAutoMemoryPool amp;
+	CMemoryPool *mp = amp.Pmp();
+
+	// setup a file-based provider
+	CMDProviderMemory *pmdp = CTestUtils::m_pmdpf;
+	pmdp->AddRef();
+	CMDAccessor mda(mp, CMDCache::Pcache(), CTestUtils::m_sysidDefault, pmdp);
+
+	CWStringDynamic strPlanOff(mp);
+	ULONG_PTR ulpSkippedOff = 0;
+	ULONG_PTR ulpReusedOff = 0;
+	CCost costOff(0.0);
+	{
+		CAutoTraceFlag atf(EopttraceDisablePlanPropsReuse, true /*value*/);
+		costOff = CostOptimize(mp, &mda, CTestUtils::PexprLogicalGbAggOverJoin, COptCtxt::EocPlanPropsSkipped, &ulpSkippedOff, &strPlanOff);
+		(void) CostOptimize(mp, &mda, CTestUtils::PexprLogicalGbAggOverJoin, COptCtxt::EocPlanPropsReused, &ulpReusedOff, NULL /*pstrPlan*/);
+	}
+
+	CWStringDynamic strPlanOn(mp);
+	ULONG_PTR ulpSkippedOn = 0;
+	ULONG_PTR ulpReusedOn = 0;
+	CCost costOn = CostOptimize(mp, &mda, CTestUtils::PexprLogicalGbAggOverJoin, COptCtxt::EocPlanPropsSkipped, &ulpSkippedOn, &strPlanOn);
+	(void) CostOptimize(mp, &mda, CTestUtils::PexprLogicalGbAggOverJoin, COptCtxt::EocPlanPropsReused, &ulpReusedOn, NULL /*pstrPlan*/);
+
+	GPOS_RTL_ASSERT(0 == ulpSkippedOff);
+	GPOS_RTL_ASSERT(0 == ulpReusedOff);
+	GPOS_RTL_ASSERT(0 < ulpSkippedOn);
+	GPOS_RTL_ASSERT(0 < ulpReusedOn);
+	GPOS_RTL_ASSERT(costOff == costOn);
+	GPOS_RTL_ASSERT(strPlanOff.Equals(&strPlanOn));
+
+	return GPOS_OK;
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CEngineTest::EresUnittest_LazyCostTables
+//
+//	@doc:
+//		Test of creating cost context tables of group expressions when the
+//		first cost context is inserted; fewer tables must be created than
+//		when each group expression creates its table along with itself, and
+//		the best plan and its cost must be the same
+//
+//---------------------------------------------------------------------------
+GPOS_RESULT
+CEngineTest::EresUnittest_LazyCostTables()
+{
+	CAutoMemoryPool amp;
+	CMemoryPool *mp = amp.Pmp();
+
+	// setup a file-based provider
+	CMDProviderMemory *pmdp = CTestUtils::m_pmdpf;
+	pmdp->AddRef();
+	CMDAccessor mda(mp, CMDCache::Pcache(), CTestUtils::m_sysidDefault, pmdp);
+
+	CWStringDynamic strPlanEager(mp);
+	ULONG_PTR ulpTablesEager = 0;
+	CCost costEager(0.0);
+	{
+		CAutoTraceFlag atf(EopttraceDisableLazyCostTables, true /*value*/);
+		costEager = CostOptimize(mp, &mda, CTestUtils::PexprLogicalGbAggOverJoin, COptCtxt::EocCostTablesCreated, &ulpTablesEager, &strPlanEager);
+	}
+
+	CWStringDynamic strPlanLazy(mp);
+	ULONG_PTR ulpTablesLazy = 0;
+	CCost costLazy = CostOptimize(mp, &mda, CTestUtils::PexprLogicalGbAggOverJoin, COptCtxt::EocCostTablesCreated, &ulpTablesLazy, &strPlanLazy);
+
+	GPOS_RTL_ASSERT(0 < ulpTablesLazy);
+	GPOS_RTL_ASSERT(ulpTablesLazy < ulpTablesEager);
+	GPOS_RTL_ASSERT(costEager == costLazy);
+	GPOS_RTL_ASSERT(strPlanEager.Equals(&strPlanLazy));
+
+	return GPOS_OK;
+}
+
+
 //---------------------------------------------------------------------------
 //	@function:
 //		CEngineTest::EresUnittest_BuildMemoLargeJoins
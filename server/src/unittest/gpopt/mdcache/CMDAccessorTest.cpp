@@ -15,6 +15,7 @@
 
 #include "gpos/memory/CCacheFactory.h"
 #include "gpos/task/CAutoTaskProxy.h"
+#include "gpos/task/CAutoTraceFlag.h"
 
 
 #include "naucrates/md/CMDProviderMemory.h"
@@ -33,6 +34,8 @@
 #include "naucrates/md/IMDPartConstraint.h"
 #include "naucrates/md/IMDCast.h"
 #include "naucrates/md/IMDScCmp.h"
+#include "naucrates/md/IMDColStats.h"
+#include "naucrates/md/CMDIdColStats.h"
 
 #include "naucrates/exception.h"
 
@@ -40,7 +43,15 @@
 #include "naucrates/base/IDatumBool.h"
 #include "naucrates/base/IDatumOid.h"
 
+#include "naucrates/statistics/IStatistics.h"
+
+#include "gpopt/base/COptCtxt.h"
+#include "gpopt/base/CColRefSet.h"
+#include "gpopt/base/CUtils.h"
+#include "gpopt/base/CReqdPropRelational.h"
 #include "gpopt/eval/CConstExprEvaluatorDefault.h"
+#include "gpopt/operators/CLogicalGet.h"
+#include "gpopt/mdcache/CStatsCache.h"
 #include "gpopt/optimizer/COptimizerConfig.h"
 
 #include "unittest/base.h"
@@ -84,8 +95,11 @@ CMDAccessorTest::EresUnittest()
 		GPOS_UNITTEST_FUNC(CMDAccessorTest::EresUnittest_Indexes),
 		GPOS_UNITTEST_FUNC(CMDAccessorTest::EresUnittest_CheckConstraint),
 		GPOS_UNITTEST_FUNC(CMDAccessorTest::EresUnittest_IndexPartConstraint),
+		GPOS_UNITTEST_FUNC(CMDAccessorTest::EresUnittest_IndexApplicabilityMap),
 		GPOS_UNITTEST_FUNC(CMDAccessorTest::EresUnittest_Cast),
-		GPOS_UNITTEST_FUNC(CMDAccessorTest::EresUnittest_ScCmp)
+		GPOS_UNITTEST_FUNC(CMDAccessorTest::EresUnittest_ScCmp),
+		GPOS_UNITTEST_FUNC(CMDAccessorTest::EresUnittest_HistogramReuse),
+		GPOS_UNITTEST_FUNC(CMDAccessorTest::EresUnittest_StatsCache)
 		};
 
 	return CUnittest::EresExecute(rgut, GPOS_ARRAY_SIZE(rgut));
@@ -610,6 +624,82 @@ CMDAccessorTest::EresUnittest_IndexPartConstraint()
 	return GPOS_OK;
 }
 
+//---------------------------------------------------------------------------
+//	@function:
+//		CMDAccessorTest::EresUnittest_IndexApplicabilityMap
+//
+//	@doc:
+//		Test the map of partition ranges to indexes of a partitioned table,
+//		and that it is built once and shared across metadata accessors
+//
+//---------------------------------------------------------------------------
+GPOS_RESULT
+CMDAccessorTest::EresUnittest_IndexApplicabilityMap()
+{
+	CAutoMemoryPool amp;
+	CMemoryPool *mp = amp.Pmp();
+
+	// Setup an MD cache with a file-based provider
+	CMDProviderMemory *pmdp = CTestUtils::m_pmdpf;
+	pmdp->AddRef();
+	CMDAccessor mda(mp, CMDCache::Pcache(), CTestUtils::m_sysidDefault, pmdp);
+
+	// lookup a partitioned relation with indexes in the MD cache
+	CMDIdGPDB *rel_mdid =  GPOS_NEW(mp) CMDIdGPDB(GPOPT_TEST_REL_OID22);
+	const IMDRelation *pmdrel = mda.RetrieveRel(rel_mdid);
+	const ULONG ulIndexes = pmdrel->IndexCount();
+	GPOS_RTL_ASSERT(0 < ulIndexes);
+
+	// the map is built once per accessor
+	const CMDIndexApplicabilityMap *md_index_map = mda.RetrieveIndexApplicabilityMap(pmdrel);
+	GPOS_RTL_ASSERT(md_index_map == mda.RetrieveIndexApplicabilityMap(pmdrel));
+	GPOS_RTL_ASSERT(ulIndexes == md_index_map->IndexCount());
+	GPOS_RTL_ASSERT(0 < md_index_map->RangeCount());
+	GPOS_RTL_ASSERT(md_index_map->RangeCount() <= ulIndexes);
+
+	ULONG ulPartialIndexes = 0;
+	for (ULONG ul = 0; ul < ulIndexes; ul++)
+	{
+		IMDId *pmdidIndex = pmdrel->IndexMDidAt(ul);
+		if (pmdrel->IsPartialIndex(pmdidIndex))
+		{
+			GPOS_RTL_ASSERT(ul == md_index_map->PartialIndexPosAt(ulPartialIndexes));
+			ulPartialIndexes++;
+		}
+
+		// each index is listed on its range, and shares the part constraint
+		// of the first index on the range
+		const ULongPtrArray *pdrgpulIndexPos = md_index_map->IndexPosForRange(md_index_map->RangeIdAt(ul));
+		BOOL fFound = false;
+		for (ULONG ulPos = 0; ulPos < pdrgpulIndexPos->Size(); ulPos++)
+		{
+			fFound = fFound || (ul == *(*pdrgpulIndexPos)[ulPos]);
+		}
+		GPOS_RTL_ASSERT(fFound);
+
+		const IMDIndex *pmdindex = mda.RetrieveIndex(pmdidIndex);
+		const IMDIndex *pmdindexFirst = mda.RetrieveIndex(pmdrel->IndexMDidAt(*(*pdrgpulIndexPos)[0]));
+		GPOS_RTL_ASSERT((NULL == pmdindex->MDPartConstraint()) == (NULL == pmdindexFirst->MDPartConstraint()));
+	}
+	GPOS_RTL_ASSERT(ulPartialIndexes == md_index_map->PartialIndexCount());
+
+	// the map is kept in the metadata cache and shared by later accessors
+	{
+		CMDKey mdkey(rel_mdid);
+		CCacheAccessor<CMDIndexApplicabilityMap*, CMDKey*> imapcacc(CMDCache::PcacheIndexApplicabilityMaps());
+		imapcacc.Lookup(&mdkey);
+		GPOS_RTL_ASSERT(md_index_map == imapcacc.Val());
+
+		pmdp->AddRef();
+		CMDAccessor mdaSnd(mp, CMDCache::Pcache(), CTestUtils::m_sysidDefault, pmdp);
+		GPOS_RTL_ASSERT(md_index_map == mdaSnd.RetrieveIndexApplicabilityMap(mdaSnd.RetrieveRel(rel_mdid)));
+	}
+
+	rel_mdid->Release();
+
+	return GPOS_OK;
+}
+
 //---------------------------------------------------------------------------
 //	@function:
 //		CMDAccessorTest::EresUnittest_Cast
@@ -718,6 +808,164 @@ CMDAccessorTest::EresUnittest_ScCmp()
 	return GPOS_OK;
 }
 
+//---------------------------------------------------------------------------
+//	@function:
+//		CMDAccessorTest::EresUnittest_HistogramReuse
+//
+//	@doc:
+//		Test that histogram buckets translated from column stats are kept
+//		in the histogram cache and shared by later statistics objects for
+//		the same relation, within and across metadata accessors
+//
+//---------------------------------------------------------------------------
+GPOS_RESULT
+CMDAccessorTest::EresUnittest_HistogramReuse()
+{
+	CAutoMemoryPool amp;
+	CMemoryPool *mp = amp.Pmp();
+
+	// start from an empty histogram cache
+	CMDCache::Reset();
+
+	// setup a file-based provider
+	CMDProviderMemory *pmdp = CTestUtils::m_pmdpf;
+	pmdp->AddRef();
+	CMDAccessor mda(mp, CMDCache::Pcache(), CTestUtils::m_sysidDefault, pmdp);
+
+	// install opt context in TLS
+	CAutoOptCtxt aoc
+					(
+					mp,
+					&mda,
+					NULL,  /* pceeval */
+					CTestUtils::GetCostModel(mp)
+					);
+
+	CWStringConst strName(GPOS_WSZ_LIT("BaseTable"));
+	CWStringConst strAlias(GPOS_WSZ_LIT("BaseTableAlias"));
+	CExpression *pexprGet = CTestUtils::PexprLogicalGet(mp, &strName, &strAlias, GPOPT_TEST_REL_OID1);
+	CLogicalGet *popGet = CLogicalGet::PopConvert(pexprGet->Pop());
+	IMDId *rel_mdid = popGet->Ptabdesc()->MDId();
+
+	CColRefSet *pcrsHist = GPOS_NEW(mp) CColRefSet(mp, popGet->PdrgpcrOutput());
+	CColRefSet *pcrsWidth = GPOS_NEW(mp) CColRefSet(mp);
+
+	IStatistics *pstatsFst = mda.Pstats(mp, rel_mdid, pcrsHist, pcrsWidth);
+
+	// buckets of the first column were translated into the histogram cache
+	rel_mdid->AddRef();
+	CMDIdColStats *mdid_col_stats = GPOS_NEW(mp) CMDIdColStats(CMDIdGPDB::CastMdid(rel_mdid), 0 /* pos */);
+	const IMDColStats *pmdcolstats = mda.Pmdcolstats(mdid_col_stats);
+	CMDKey mdkey(mdid_col_stats);
+	CBucketArray *buckets = NULL;
+	{
+		CCacheAccessor<CBucketArray*, CMDKey*> histcacc(CMDCache::PcacheHistograms());
+		histcacc.Lookup(&mdkey);
+		buckets = histcacc.Val();
+	}
+	GPOS_RTL_ASSERT(NULL != buckets);
+	GPOS_RTL_ASSERT(pmdcolstats->Buckets() == buckets->Size());
+
+	// a second reference to the relation reuses the translated buckets
+	IStatistics *pstatsSnd = mda.Pstats(mp, rel_mdid, pcrsHist, pcrsWidth);
+	GPOS_RTL_ASSERT(pstatsFst->Rows() == pstatsSnd->Rows());
+
+	// so does another accessor, as for a later query
+	{
+		pmdp->AddRef();
+		CMDAccessor mdaSnd(mp, CMDCache::Pcache(), CTestUtils::m_sysidDefault, pmdp);
+		IStatistics *pstatsThd = mdaSnd.Pstats(mp, rel_mdid, pcrsHist, pcrsWidth);
+		GPOS_RTL_ASSERT(pstatsFst->Rows() == pstatsThd->Rows());
+		pstatsThd->Release();
+
+		CCacheAccessor<CBucketArray*, CMDKey*> histcacc(CMDCache::PcacheHistograms());
+		histcacc.Lookup(&mdkey);
+		GPOS_RTL_ASSERT(buckets == histcacc.Val());
+	}
+
+	// cleanup
+	mdid_col_stats->Release();
+	pstatsFst->Release();
+	pstatsSnd->Release();
+	pcrsHist->Release();
+	pcrsWidth->Release();
+	pexprGet->Release();
+
+	return GPOS_OK;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CMDAccessorTest::EresUnittest_StatsCache
+//
+//	@doc:
+//		Test that filter statistics over a base table are served from the
+//		statistics cache for a later expression with different column ids,
+//		and that the cache is bypassed when the trace flag is set
+//
+//---------------------------------------------------------------------------
+GPOS_RESULT
+CMDAccessorTest::EresUnittest_StatsCache()
+{
+	CAutoMemoryPool amp;
+	CMemoryPool *mp = amp.Pmp();
+
+	// setup a file-based provider
+	CMDProviderMemory *pmdp = CTestUtils::m_pmdpf;
+	pmdp->AddRef();
+	CMDAccessor mda(mp, CMDCache::Pcache(), CTestUtils::m_sysidDefault, pmdp);
+
+	// install opt context in TLS
+	CAutoOptCtxt aoc
+					(
+					mp,
+					&mda,
+					NULL,  /* pceeval */
+					CTestUtils::GetCostModel(mp)
+					);
+	COptCtxt *poctxt = COptCtxt::PoctxtFromTLS();
+
+	GPOS_ASSERT(!CStatsCache::FInitialized());
+	CStatsCache::Init();
+
+	CWStringConst strName(GPOS_WSZ_LIT("BaseTable"));
+	CWStringConst strAlias(GPOS_WSZ_LIT("BaseTableAlias"));
+
+	// derive the same filter three times, the last time bypassing the cache
+	const ULONG ulDerivations = 3;
+	DOUBLE rgdRows[ulDerivations];
+	for (ULONG ul = 0; ul < ulDerivations; ul++)
+	{
+		CAutoTraceFlag atf(EopttraceDisableStatsCache, ulDerivations - 1 == ul);
+
+		CExpression *pexprGet = CTestUtils::PexprLogicalGet(mp, &strName, &strAlias, GPOPT_TEST_REL_OID1);
+		CColRef *colref = (*CLogicalGet::PopConvert(pexprGet->Pop())->PdrgpcrOutput())[0];
+		CExpression *pexprPred = CUtils::PexprScalarEqCmp(mp, colref, CUtils::PexprScalarConstInt4(mp, 5 /*val*/));
+		CExpression *pexpr = CUtils::PexprLogicalSelect(mp, pexprGet, pexprPred);
+
+		CReqdPropRelational *prprel = GPOS_NEW(mp) CReqdPropRelational(GPOS_NEW(mp) CColRefSet(mp));
+		IStatisticsArray *stats_ctxt = GPOS_NEW(mp) IStatisticsArray(mp);
+		IStatistics *stats = pexpr->PstatsDerive(prprel, stats_ctxt);
+		rgdRows[ul] = stats->Rows().Get();
+
+		prprel->Release();
+		stats_ctxt->Release();
+		pexpr->Release();
+	}
+
+	GPOS_RTL_ASSERT(1 == poctxt->UlpCounter(COptCtxt::EocStatsCacheMisses));
+	GPOS_RTL_ASSERT(1 == poctxt->UlpCounter(COptCtxt::EocStatsCacheHits));
+	for (ULONG ul = 1; ul < ulDerivations; ul++)
+	{
+		GPOS_RTL_ASSERT(CDouble(rgdRows[0]) == CDouble(rgdRows[ul]));
+	}
+
+	// cached entries pin metadata of the file-based provider
+	CStatsCache::Shutdown();
+
+	return GPOS_OK;
+}
+
 //---------------------------------------------------------------------------
 //	@function:
 //		CMDAccessorTest::EresUnittest_Negative
@@ -66,7 +66,8 @@ CExpressionPreprocessorTest::EresUnittest()
 		GPOS_UNITTEST_FUNC(EresUnittest_CollapseInnerJoin),
 		GPOS_UNITTEST_FUNC(EresUnittest_PreProcessConvert2InPredicate),
 		GPOS_UNITTEST_FUNC(EresUnittest_PreProcessConvertArrayWithEquals),
-		GPOS_UNITTEST_FUNC(EresUnittest_PreProcessConvert2InPredicateDeepExpressionTree)
+		GPOS_UNITTEST_FUNC(EresUnittest_PreProcessConvert2InPredicateDeepExpressionTree),
+		GPOS_UNITTEST_FUNC(EresUnittest_PreProcessSharesUnchangedSubtrees)
 		};
 
 	return CUnittest::EresExecute(rgut, GPOS_ARRAY_SIZE(rgut));
@@ -2455,5 +2456,69 @@ CExpressionPreprocessorTest::EresUnittest_PreProcessConvert2InPredicateDeepExpre
 	return GPOS_OK;
 }
 
+//---------------------------------------------------------------------------
+//	@function:
+//		CExpressionPreprocessorTest::EresUnittest_PreProcessSharesUnchangedSubtrees
+//
+//	@doc:
+//		Test that preprocessing passes share the subtrees they do not rewrite
+//		with their input, and return the input itself if nothing changed
+//
+//---------------------------------------------------------------------------
+GPOS_RESULT
+CExpressionPreprocessorTest::EresUnittest_PreProcessSharesUnchangedSubtrees()
+{
+	CAutoTraceFlag atf(EopttraceArrayConstraints, true /*value*/);
+
+	CAutoMemoryPool amp;
+	CMemoryPool *mp = amp.Pmp();
+
+	// reset metadata cache
+	CMDCache::Reset();
+
+	// setup a file-based provider
+	CMDProviderMemory *pmdp = CTestUtils::m_pmdpf;
+	pmdp->AddRef();
+	CMDAccessor mda(mp, CMDCache::Pcache(), CTestUtils::m_sysidDefault, pmdp);
+
+	CAutoOptCtxt aoc(mp, &mda, NULL /*pceeval*/, CTestUtils::GetCostModel(mp));
+
+	// select with predicate (x = 1 OR x = 2) joined with an unfiltered get
+	CExpression *pexprGet = CTestUtils::PexprLogicalGet(mp);
+	CColRef *colref = pexprGet->DeriveOutputColumns()->PcrAny();
+	CExpression *pexprDisjunct =
+			GPOS_NEW(mp) CExpression(
+									mp,
+									GPOS_NEW(mp) CScalarBoolOp(mp, CScalarBoolOp::EboolopOr),
+									CUtils::PexprScalarEqCmp(mp, colref, CUtils::PexprScalarConstInt4(mp, 1 /*val*/)),
+									CUtils::PexprScalarEqCmp(mp, colref, CUtils::PexprScalarConstInt4(mp, 2 /*val*/))
+									);
+	CExpression *pexprSelect = CUtils::PexprLogicalSelect(mp, pexprGet, pexprDisjunct);
+	CAutoRef<CExpression> apexprJoin
+		(
+		CTestUtils::PexprLogicalJoin<CLogicalInnerJoin>(mp, pexprSelect, CTestUtils::PexprLogicalGet(mp))
+		);
+
+	// only the path to the rewritten disjunction is copied
+	CAutoRef<CExpression> apexprConvert(CExpressionPreprocessor::PexprConvert2In(mp, apexprJoin.Value()));
+	GPOS_RTL_ASSERT(apexprConvert.Value() != apexprJoin.Value());
+	GPOS_RTL_ASSERT((*apexprConvert)[0] != (*apexprJoin)[0]);
+	GPOS_RTL_ASSERT((*(*apexprConvert)[0])[0] == (*(*apexprJoin)[0])[0]);
+	GPOS_RTL_ASSERT((*apexprConvert)[1] == (*apexprJoin)[1]);
+	GPOS_RTL_ASSERT((*apexprConvert)[2] == (*apexprJoin)[2]);
+
+	// passes that have nothing left to rewrite return their input
+	CAutoRef<CExpression> apexprConvertAgain(CExpressionPreprocessor::PexprConvert2In(mp, apexprConvert.Value()));
+	GPOS_RTL_ASSERT(apexprConvertAgain.Value() == apexprConvert.Value());
+
+	CAutoRef<CExpression> apexprUnnested(CExpressionUtils::PexprUnnest(mp, apexprConvert.Value()));
+	GPOS_RTL_ASSERT(apexprUnnested.Value() == apexprConvert.Value());
+
+	CAutoRef<CExpression> apexprDeduped(CExpressionUtils::PexprDedupChildren(mp, apexprConvert.Value()));
+	GPOS_RTL_ASSERT(apexprDeduped.Value() == apexprConvert.Value());
+
+	return GPOS_OK;
+}
+
 // EOF
 
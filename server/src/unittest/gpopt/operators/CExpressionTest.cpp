@@ -22,6 +22,7 @@
 #include "gpopt/eval/CConstExprEvaluatorDefault.h"
 #include "gpopt/mdcache/CAutoMDAccessor.h"
 #include "gpopt/operators/ops.h"
+#include "gpopt/operators/CExpressionInterner.h"
 #include "gpopt/operators/CLogicalDynamicGetBase.h"
 
 #include "unittest/base.h"
@@ -91,6 +92,8 @@ CExpressionTest::EresUnittest()
 		GPOS_UNITTEST_FUNC(CExpressionTest::EresUnittest_Union),
 		GPOS_UNITTEST_FUNC(CExpressionTest::EresUnittest_BitmapGet),
 		GPOS_UNITTEST_FUNC(CExpressionTest::EresUnittest_Const),
+		GPOS_UNITTEST_FUNC(CExpressionTest::EresUnittest_Interning),
+		GPOS_UNITTEST_FUNC(CExpressionTest::EresUnittest_HandleInlineArrays),
 #ifdef GPOS_DEBUG
 		GPOS_UNITTEST_FUNC(CExpressionTest::EresUnittest_ComparisonTypes),
 #endif // GPOS_DEBUG
@@ -573,6 +576,145 @@ CExpressionTest::EresUnittest_Const()
 	return GPOS_OK;
 }
 
+//---------------------------------------------------------------------------
+//	@function:
+//		CExpressionTest::EresUnittest_Interning
+//
+//	@doc:
+//		Test sharing of structurally equal scalar expressions
+//
+//---------------------------------------------------------------------------
+GPOS_RESULT
+CExpressionTest::EresUnittest_Interning()
+{
+	CAutoMemoryPool amp;
+	CMemoryPool *mp = amp.Pmp();
+
+	// setup a file-based provider
+	CMDProviderMemory *pmdp = CTestUtils::m_pmdpf;
+	pmdp->AddRef();
+	CMDAccessor mda(mp, CMDCache::Pcache(), CTestUtils::m_sysidDefault, pmdp);
+
+	// install opt context in TLS
+	CAutoOptCtxt aoc
+					(
+					mp,
+					&mda,
+					NULL,  /* pceeval */
+					CTestUtils::GetCostModel(mp)
+					);
+
+	const IMDTypeInt4 *pmdtypeint4 = mda.PtMDType<IMDTypeInt4>(CTestUtils::m_sysidDefault);
+	CColumnFactory *col_factory = COptCtxt::PoctxtFromTLS()->Pcf();
+	CColRef *pcrA = col_factory->PcrCreate(pmdtypeint4, default_type_modifier);
+	CColRef *pcrB = col_factory->PcrCreate(pmdtypeint4, default_type_modifier);
+
+	CExpressionInterner *pinterner = COptCtxt::PoctxtFromTLS()->Pinterner();
+	const ULONG ulSizeBefore = pinterner->Size();
+
+	// two separately built copies of a = b share one instance
+	CExpression *pexprEq = CUtils::PexprInternScalar(CUtils::PexprScalarEqCmp(mp, pcrA, pcrB));
+	CExpression *pexprEqCopy = CUtils::PexprInternScalar(CUtils::PexprScalarEqCmp(mp, pcrA, pcrB));
+	GPOS_RTL_ASSERT(pexprEq == pexprEqCopy);
+	GPOS_RTL_ASSERT(pexprEq->FInterned());
+
+	// equality is commutative, so b = a is the same expression
+	CExpression *pexprEqSwapped = CUtils::PexprInternScalar(CUtils::PexprScalarEqCmp(mp, pcrB, pcrA));
+	GPOS_RTL_ASSERT(pexprEq == pexprEqSwapped);
+
+	// a < b and b < a are different expressions
+	CExpression *pexprLt = CUtils::PexprInternScalar(CUtils::PexprScalarCmp(mp, pcrA, pcrB, IMDType::EcmptL));
+	CExpression *pexprLtSwapped = CUtils::PexprInternScalar(CUtils::PexprScalarCmp(mp, pcrB, pcrA, IMDType::EcmptL));
+	GPOS_RTL_ASSERT(pexprLt != pexprLtSwapped);
+	GPOS_RTL_ASSERT(!CUtils::Equals(pexprLt, pexprLtSwapped));
+
+	// conjunctions with reordered children share one instance as well
+	CExpression *pexprAnd = CUtils::PexprInternScalar(CPredicateUtils::PexprConjunction(mp, pexprEq, pexprLt));
+	CExpression *pexprAndReordered = CUtils::PexprInternScalar(CPredicateUtils::PexprConjunction(mp, pexprLt, pexprEq));
+	GPOS_RTL_ASSERT(pexprAnd == pexprAndReordered);
+	GPOS_RTL_ASSERT((*pexprAnd)[0] == pexprEq);
+
+	// the idents of a and b, a = b, a < b, b < a, and the conjunction
+	GPOS_RTL_ASSERT(ulSizeBefore + 6 == pinterner->Size());
+
+	pexprEq->Release();
+	pexprEqCopy->Release();
+	pexprEqSwapped->Release();
+	pexprLt->Release();
+	pexprLtSwapped->Release();
+	pexprAnd->Release();
+	pexprAndReordered->Release();
+
+	return GPOS_OK;
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CExpressionTest::EresUnittest_HandleInlineArrays
+//
+//	@doc:
+//		Test that expression handles keep the child arrays of operators of
+//		small arity inline, and allocate them for larger arity only
+//
+//---------------------------------------------------------------------------
+GPOS_RESULT
+CExpressionTest::EresUnittest_HandleInlineArrays()
+{
+	CAutoMemoryPool amp;
+	CMemoryPool *mp = amp.Pmp();
+
+	// setup a file-based provider
+	CMDProviderMemory *pmdp = CTestUtils::m_pmdpf;
+	pmdp->AddRef();
+	CMDAccessor mda(mp, CMDCache::Pcache(), CTestUtils::m_sysidDefault, pmdp);
+
+	// install opt context in TLS
+	CAutoOptCtxt aoc
+					(
+					mp,
+					&mda,
+					NULL,  /* pceeval */
+					CTestUtils::GetCostModel(mp)
+					);
+	COptCtxt *poctxt = COptCtxt::PoctxtFromTLS();
+
+	typedef CExpression *(*Pfpexpr)(CMemoryPool*);
+
+	// a binary join, and an n-ary join of five relations
+	Pfpexpr rgpf[] =
+		{
+		CTestUtils::PexprLogicalJoin<CLogicalInnerJoin>,
+		CTestUtils::PexprLogicalNAryJoin,
+		};
+
+	// does deriving stats of the expression allocate child arrays
+	BOOL rgfAllocates[] = {false, true};
+
+	for (ULONG ul = 0; ul < GPOS_ARRAY_SIZE(rgpf); ul++)
+	{
+		CExpression *pexpr = rgpf[ul](mp);
+
+		ULONG_PTR ulpInline = poctxt->UlpCounter(COptCtxt::EocHandleArraysInline);
+		ULONG_PTR ulpAllocated = poctxt->UlpCounter(COptCtxt::EocHandleArraysAllocated);
+
+		CReqdPropRelational *prprel = GPOS_NEW(mp) CReqdPropRelational(GPOS_NEW(mp) CColRefSet(mp));
+		IStatisticsArray *stats_ctxt = GPOS_NEW(mp) IStatisticsArray(mp);
+		IStatistics *stats = pexpr->PstatsDerive(prprel, stats_ctxt);
+		GPOS_RTL_ASSERT(NULL != stats);
+
+		// the gets below the joins are handled inline in any case
+		GPOS_RTL_ASSERT(ulpInline < poctxt->UlpCounter(COptCtxt::EocHandleArraysInline));
+		GPOS_RTL_ASSERT(rgfAllocates[ul] == (ulpAllocated < poctxt->UlpCounter(COptCtxt::EocHandleArraysAllocated)));
+
+		prprel->Release();
+		stats_ctxt->Release();
+		pexpr->Release();
+	}
+
+	return GPOS_OK;
+}
+
 
 #ifdef GPOS_DEBUG
 //---------------------------------------------------------------------------